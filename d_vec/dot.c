@@ -16,11 +16,20 @@
 double
 _d_vec_dot(const double *vec1, const double *vec2, slong len2)
 {
-    double sum = 0;
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
     slong i;
 
-    for (i = 0; i < len2; i++)
-        sum += vec1[i] * vec2[i];
+    /* four independent sums, so that the loop can be vectorised */
+    for (i = 0; i + 4 <= len2; i += 4)
+    {
+        s0 += vec1[i] * vec2[i];
+        s1 += vec1[i + 1] * vec2[i + 1];
+        s2 += vec1[i + 2] * vec2[i + 2];
+        s3 += vec1[i + 3] * vec2[i + 3];
+    }
 
-    return sum;
+    for ( ; i < len2; i++)
+        s0 += vec1[i] * vec2[i];
+
+    return (s0 + s1) + (s2 + s3);
 }
@@ -17,19 +17,30 @@ double
 _d_vec_dot_heuristic(const double *vec1, const double *vec2, slong len2,
                      double *err)
 {
-    double psum = 0, nsum = 0, p, n, d, t;
+    double psum, nsum, p0 = 0, p1 = 0, n0 = 0, n1 = 0, p, n, d, t, u;
     int pexp, nexp;
     slong i;
 
-    for (i = 0; i < len2; i++)
+    /* two independent pairs of sums, split by sign without branches */
+    for (i = 0; i + 2 <= len2; i += 2)
     {
         t = vec1[i] * vec2[i];
-        if (t >= 0)
-            psum += t;
-        else
-            nsum += t;
+        u = vec1[i + 1] * vec2[i + 1];
+        p0 += FLINT_MAX(t, 0.0);
+        n0 += FLINT_MIN(t, 0.0);
+        p1 += FLINT_MAX(u, 0.0);
+        n1 += FLINT_MIN(u, 0.0);
     }
-    nsum = -nsum;
+
+    if (i < len2)
+    {
+        t = vec1[i] * vec2[i];
+        p0 += FLINT_MAX(t, 0.0);
+        n0 += FLINT_MIN(t, 0.0);
+    }
+
+    psum = p0 + p1;
+    nsum = -(n0 + n1);
 
     if (err != NULL)
     {
@@ -16,11 +16,19 @@
 double
 _d_vec_norm(const double *vec, slong len)
 {
-    double sum = 0;
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
     slong i;
 
-    for (i = 0; i < len; i++)
-        sum += vec[i] * vec[i];
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        s0 += vec[i] * vec[i];
+        s1 += vec[i + 1] * vec[i + 1];
+        s2 += vec[i + 2] * vec[i + 2];
+        s3 += vec[i + 3] * vec[i + 3];
+    }
 
-    return sum;
+    for ( ; i < len; i++)
+        s0 += vec[i] * vec[i];
+
+    return (s0 + s1) + (s2 + s3);
 }
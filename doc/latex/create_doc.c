@@ -29,6 +29,8 @@ static char * docsin[] = {
     "../../fmpz_poly_mat/doc/fmpz_poly_mat.txt", 
     "../../nmod_vec/doc/nmod_vec.txt",
     "../../nmod_mat/doc/nmod_mat.txt",
+    "../../nmod_sparse_mat/doc/nmod_sparse_mat.txt",
+    "../../gf2_mat/doc/gf2_mat.txt",
     "../../nmod_poly/doc/nmod_poly.txt",
     "../../nmod_poly_factor/doc/nmod_poly_factor.txt",
     "../../nmod_poly_mat/doc/nmod_poly_mat.txt",
@@ -83,6 +85,8 @@ static char * docsout[] = {
     "input/fmpz_poly_mat.tex", 
     "input/nmod_vec.tex",
     "input/nmod_mat.tex",
+    "input/nmod_sparse_mat.tex",
+    "input/gf2_mat.tex",
     "input/nmod_poly.tex",
     "input/nmod_poly_factor.tex",
     "input/nmod_poly_mat.tex",
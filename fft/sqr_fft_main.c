@@ -0,0 +1,20 @@
+/* 
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+
+/* the truncated transforms only do one forward FFT when i1 == i2 */
+void flint_mpn_sqr_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1)
+{
+   flint_mpn_mul_fft_main(r1, i1, n1, i1, n1);
+}
@@ -0,0 +1,79 @@
+/* 
+    Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+int
+main(void)
+{
+    mp_bitcnt_t depth, w;
+    
+    FLINT_TEST_INIT(state);
+
+    flint_printf("sqr_fft_main....");
+    fflush(stdout);
+
+    
+    _flint_rand_init_gmp(state);
+
+    for (depth = 6; depth <= 12; depth++)
+    {
+        for (w = 1; w <= 3 - (depth >= 12); w++)
+        {
+            int iter = 1 + 200*(depth <= 8) + 80*(depth <= 9) + 10*(depth <= 10), i;
+            
+            for (i = 0; i < iter; i++)
+            {
+               mp_size_t n = (UWORD(1)<<depth);
+               mp_bitcnt_t bits1 = (n*w - (depth + 1))/2; 
+               mp_size_t len1 = n + n_randint(state, 2*n) + 1;
+
+               mp_bitcnt_t b1 = len1*bits1;
+               mp_size_t n1;
+               mp_size_t j;
+               mp_limb_t * i1, *r1, *r2;
+
+               n1 = (b1 - 1)/FLINT_BITS + 1;
+
+               i1 = flint_malloc(5*n1*sizeof(mp_limb_t));
+               r1 = i1 + n1;
+               r2 = r1 + 2*n1;
+   
+               flint_mpn_urandomb(i1, state->gmp_state, b1);
+  
+               mpn_sqr(r2, i1, n1);
+               flint_mpn_sqr_fft_main(r1, i1, n1);
+           
+               for (j = 0; j < 2*n1; j++)
+               {
+                   if (r1[j] != r2[j]) 
+                   {
+                       flint_printf("error in limb %wd, %wx != %wx\n", j, r1[j], r2[j]);
+                       abort();
+                   }
+               }
+
+               flint_free(i1);
+            }
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,15 +10,50 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpq_mat.h"
 
-int
-fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
-                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+/* entries reconstructed with a common running denominator */
+#define RECONSTRUCT_BLOCK 64
+
+typedef struct
 {
-    fmpz_t num, den, t, u, d;
-    slong i, j;
+    fmpq_mat_struct * X;
+    const fmpz_mat_struct * Xmod;
+    const fmpz * mod;
+    slong start;
+    slong step;
+    int * failed;
+    pthread_mutex_t * mutex;
+}
+reconstruct_arg_t;
+
+static int
+_fmpq_mat_reconstruct_failed(reconstruct_arg_t * arg)
+{
+    int failed;
 
+    if (arg->mutex == NULL)
+        return 0;
+
+    pthread_mutex_lock(arg->mutex);
+    failed = *arg->failed;
+    pthread_mutex_unlock(arg->mutex);
+
+    return failed;
+}
+
+/*
+    Reconstructs the entries e0, ..., e1 - 1 in row major order. The
+    product d of the denominators found so far is usually a large factor
+    of the next denominator, so the reconstruction is applied to d x
+    rather than to x.
+*/
+static int
+_fmpq_mat_reconstruct_block(reconstruct_arg_t * arg, slong e0, slong e1)
+{
+    fmpz_t num, den, t, u, d;
+    slong e, c = arg->Xmod->c;
     int success = 1;
 
     fmpz_init(num);
@@ -28,30 +64,26 @@ fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
 
     fmpz_one(d);
 
-    for (i = 0; i < Xmod->r; i++)
+    for (e = e0; e < e1 && success; e++)
     {
-        for (j = 0; j < Xmod->c; j++)
-        {
-            /* TODO: handle various special cases efficiently; zeros,
-                     small integers, etc. */
-            fmpz_mul(t, d, fmpz_mat_entry(Xmod, i, j));
-            fmpz_fdiv_qr(u, t, t, mod);
+        slong i = e / c, j = e % c;
+
+        fmpz_mul(t, d, fmpz_mat_entry(arg->Xmod, i, j));
+        fmpz_fdiv_qr(u, t, t, arg->mod);
 
-            success = _fmpq_reconstruct_fmpz(num, den, t, mod);
+        success = _fmpq_reconstruct_fmpz(num, den, t, arg->mod);
 
+        if (success)
+        {
             fmpz_mul(den, den, d);
             fmpz_set(d, den);
 
-            if (!success)
-                goto cleanup;
-
-            fmpz_set(fmpq_mat_entry_num(X, i, j), num);
-            fmpz_set(fmpq_mat_entry_den(X, i, j), den);
-            fmpq_canonicalise(fmpq_mat_entry(X, i, j));
+            fmpz_set(fmpq_mat_entry_num(arg->X, i, j), num);
+            fmpz_set(fmpq_mat_entry_den(arg->X, i, j), den);
+            fmpq_canonicalise(fmpq_mat_entry(arg->X, i, j));
         }
     }
 
-cleanup:
     fmpz_clear(num);
     fmpz_clear(den);
     fmpz_clear(d);
@@ -60,3 +92,108 @@ cleanup:
 
     return success;
 }
+
+/*
+    Reconstructs the blocks start, start + step, ... of RECONSTRUCT_BLOCK
+    entries. The running denominator restarts at each block, so the result
+    does not depend on how the blocks are divided between the threads.
+    Gives up as soon as any entry, in this or any other thread, fails.
+*/
+static int
+_fmpq_mat_reconstruct_range(reconstruct_arg_t * arg)
+{
+    slong b, len = arg->Xmod->r * arg->Xmod->c;
+    int success = 1;
+
+    for (b = arg->start; b * RECONSTRUCT_BLOCK < len; b += arg->step)
+    {
+        if (_fmpq_mat_reconstruct_failed(arg))
+        {
+            success = 0;
+            break;
+        }
+
+        success = _fmpq_mat_reconstruct_block(arg, b * RECONSTRUCT_BLOCK,
+                            FLINT_MIN(len, (b + 1) * RECONSTRUCT_BLOCK));
+
+        if (!success)
+        {
+            if (arg->mutex != NULL)
+            {
+                pthread_mutex_lock(arg->mutex);
+                *arg->failed = 1;
+                pthread_mutex_unlock(arg->mutex);
+            }
+            break;
+        }
+    }
+
+    return success;
+}
+
+static void *
+_fmpq_mat_reconstruct_worker(void * arg_ptr)
+{
+    _fmpq_mat_reconstruct_range((reconstruct_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+int
+fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
+                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+{
+    slong i, len, num_threads;
+    reconstruct_arg_t * args;
+    pthread_t * threads;
+    pthread_mutex_t mutex;
+    int failed = 0;
+
+    len = Xmod->r * Xmod->c;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(),
+                            (len + RECONSTRUCT_BLOCK - 1) / RECONSTRUCT_BLOCK);
+
+    if (num_threads <= 1 || len * (1 + fmpz_size(mod)) < 1024)
+    {
+        reconstruct_arg_t arg;
+
+        arg.X = X;
+        arg.Xmod = Xmod;
+        arg.mod = mod;
+        arg.start = 0;
+        arg.step = 1;
+        arg.failed = &failed;
+        arg.mutex = NULL;
+
+        return _fmpq_mat_reconstruct_range(&arg);
+    }
+
+    args = flint_malloc(sizeof(reconstruct_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    pthread_mutex_init(&mutex, NULL);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].X = X;
+        args[i].Xmod = Xmod;
+        args[i].mod = mod;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].failed = &failed;
+        args[i].mutex = &mutex;
+
+        pthread_create(&threads[i], NULL,
+                       _fmpq_mat_reconstruct_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    pthread_mutex_destroy(&mutex);
+    flint_free(args);
+    flint_free(threads);
+
+    return !failed;
+}
@@ -34,6 +34,8 @@ main(void)
         int success;
         slong n, m, bits;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         n = n_randint(state, 10);
         m = n_randint(state, 10);
         bits = 1 + n_randint(state, 100);
@@ -121,6 +123,8 @@ main(void)
         fmpz_clear(den);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
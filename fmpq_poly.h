@@ -661,6 +661,12 @@ FLINT_DLL void fmpq_poly_evaluate_mpz(mpq_t res, const fmpq_poly_t poly, const m
 
 FLINT_DLL void fmpq_poly_evaluate_mpq(mpq_t res, const fmpq_poly_t poly, const mpq_t a);
 
+FLINT_DLL void fmpq_poly_evaluate_fmpz_vec_fast_precomp(fmpq * ys,
+             const fmpq_poly_t poly, fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void fmpq_poly_evaluate_fmpz_vec_fast(fmpq * ys,
+                      const fmpq_poly_t poly, const fmpz * xs, slong n);
+
 /*  Interpolation ************************************************************/
 
 FLINT_DLL void _fmpq_poly_interpolate_fmpz_vec(fmpz * poly, fmpz_t den,
@@ -669,6 +675,12 @@ FLINT_DLL void _fmpq_poly_interpolate_fmpz_vec(fmpz * poly, fmpz_t den,
 FLINT_DLL void fmpq_poly_interpolate_fmpz_vec(fmpq_poly_t poly,
                                     const fmpz * xs, const fmpz * ys, slong n);
 
+FLINT_DLL void fmpq_poly_interpolate_fmpz_vec_fast_precomp(fmpq_poly_t poly,
+                   const fmpz * ys, fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void fmpq_poly_interpolate_fmpz_vec_fast(fmpq_poly_t poly,
+                                const fmpz * xs, const fmpz * ys, slong n);
+
 /*  Composition  *************************************************************/
 
 FLINT_DLL void _fmpq_poly_compose(fmpz * res, fmpz_t den, 
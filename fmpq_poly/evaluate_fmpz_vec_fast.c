@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+
+void
+fmpq_poly_evaluate_fmpz_vec_fast_precomp(fmpq * ys,
+                const fmpq_poly_t poly, fmpz_poly_multipoint_precomp_t T)
+{
+    slong i, len = T->len;
+    fmpz * v;
+
+    v = _fmpz_vec_init(len);
+
+    _fmpz_poly_evaluate_fmpz_vec_fast_precomp(v, poly->coeffs,
+                                              poly->length, T);
+
+    for (i = 0; i < len; i++)
+        fmpq_set_fmpz_frac(ys + i, v + i, poly->den);
+
+    _fmpz_vec_clear(v, len);
+}
+
+void
+fmpq_poly_evaluate_fmpz_vec_fast(fmpq * ys, const fmpq_poly_t poly,
+                                                const fmpz * xs, slong n)
+{
+    fmpz_poly_multipoint_precomp_t T;
+
+    fmpz_poly_multipoint_precompute(T, xs, n);
+    fmpq_poly_evaluate_fmpz_vec_fast_precomp(ys, poly, T);
+    fmpz_poly_multipoint_clear(T);
+}
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpq.h"
+#include "fmpq_poly.h"
+
+/*
+    Reconstructs the coefficients c of a polynomial with rational
+    coefficients from their images modulo M, as num / den with a common
+    denominator. As den only ever picks up factors of the true denominator,
+    this succeeds as soon as sqrt(M / 2) exceeds the true denominator and
+    the absolute values of the true numerators.
+*/
+static int
+_fmpq_poly_reconstruct(fmpz * num, fmpz_t den,
+                       const fmpz * c, slong len, const fmpz_t M)
+{
+    fmpz_t a, d;
+    slong i;
+    int ok = 1;
+
+    fmpz_init(a);
+    fmpz_init(d);
+
+    fmpz_one(den);
+
+    for (i = 0; i < len && ok; i++)
+    {
+        fmpz_mul(a, c + i, den);
+        fmpz_mod(a, a, M);
+
+        ok = _fmpq_reconstruct_fmpz(num + i, d, a, M);
+
+        if (ok && !fmpz_is_one(d))
+        {
+            _fmpz_vec_scalar_mul_fmpz(num, num, i, d);
+            fmpz_mul(den, den, d);
+        }
+    }
+
+    fmpz_clear(a);
+    fmpz_clear(d);
+
+    return ok;
+}
+
+void
+fmpq_poly_interpolate_fmpz_vec_fast_precomp(fmpq_poly_t poly,
+                        const fmpz * ys, fmpz_poly_multipoint_precomp_t T)
+{
+    slong i, len = T->len, plen, num_primes, num_primes_M;
+    mp_bitcnt_t bits;
+    fmpz * c, * num, * v;
+    fmpz_t den, M, t;
+    int ok;
+
+    if (len == 0)
+    {
+        fmpq_poly_zero(poly);
+        return;
+    }
+    else if (len == 1)
+    {
+        fmpq_poly_set_fmpz(poly, ys);
+        return;
+    }
+
+    if (!T->distinct)
+    {
+        flint_printf("Exception (fmpq_poly_interpolate_fmpz_vec_fast). "
+                     "Repeated points.\n");
+        flint_abort();
+    }
+
+    c = _fmpz_vec_init(len);
+    num = _fmpz_vec_init(len);
+    v = _fmpz_vec_init(len);
+    fmpz_init(den);
+    fmpz_init(M);
+    fmpz_init(t);
+
+    /* start with the bound for an integral interpolant and double the
+       number of primes until the reconstruction can be verified */
+    bits = FLINT_ABS(_fmpz_vec_max_bits(ys, len));
+    bits += (len - 1) * T->xbits + 2 * FLINT_BIT_COUNT(len) + 1;
+    num_primes = (bits + FLINT_BITS - 2) / (FLINT_BITS - 1);
+
+    fmpz_one(M);
+    num_primes_M = 0;
+
+    while (1)
+    {
+        _fmpz_poly_interpolate_multi_mod(c, ys, T, num_primes);
+
+        for ( ; num_primes_M < num_primes; num_primes_M++)
+            fmpz_mul_ui(M, M, T->primes[num_primes_M]);
+
+        ok = _fmpq_poly_reconstruct(num, den, c, len, M);
+
+        if (ok)
+        {
+            plen = len;
+            while (plen > 0 && fmpz_is_zero(num + plen - 1))
+                plen--;
+
+            _fmpz_poly_evaluate_fmpz_vec_fast_precomp(v, num, plen, T);
+
+            for (i = 0; i < len && ok; i++)
+            {
+                fmpz_mul(t, den, ys + i);
+                ok = fmpz_equal(t, v + i);
+            }
+
+            if (ok)
+                break;
+        }
+
+        num_primes *= 2;
+    }
+
+    fmpq_poly_fit_length(poly, plen);
+    _fmpz_vec_swap(poly->coeffs, num, plen);
+    fmpz_swap(poly->den, den);
+    _fmpq_poly_set_length(poly, plen);
+    fmpq_poly_canonicalise(poly);
+
+    _fmpz_vec_clear(c, len);
+    _fmpz_vec_clear(num, len);
+    _fmpz_vec_clear(v, len);
+    fmpz_clear(den);
+    fmpz_clear(M);
+    fmpz_clear(t);
+}
+
+void
+fmpq_poly_interpolate_fmpz_vec_fast(fmpq_poly_t poly,
+                                 const fmpz * xs, const fmpz * ys, slong n)
+{
+    fmpz_poly_multipoint_precomp_t T;
+
+    fmpz_poly_multipoint_precompute(T, xs, n);
+    fmpq_poly_interpolate_fmpz_vec_fast_precomp(poly, ys, T);
+    fmpz_poly_multipoint_clear(T);
+}
@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpq.h"
+#include "fmpq_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_fmpz_vec_fast....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpq_poly_t P;
+        fmpz *x;
+        fmpq *y;
+        fmpq_t z;
+        slong j, n, npoints;
+
+        npoints = n_randint(state, (i % 20 == 0) ? 400 : 50);
+        n = n_randint(state, (i % 20 == 0) ? 400 : 50);
+
+        x = _fmpz_vec_init(npoints);
+        y = _fmpq_vec_init(npoints);
+        fmpq_init(z);
+
+        fmpq_poly_init(P);
+        fmpq_poly_randtest(P, state, n, n_randint(state, 200) + 1);
+
+        _fmpz_vec_randtest(x, state, npoints, n_randint(state, 100));
+
+        fmpq_poly_evaluate_fmpz_vec_fast(y, P, x, npoints);
+
+        for (j = 0; j < npoints; j++)
+        {
+            fmpq_poly_evaluate_fmpz(z, P, x + j);
+
+            result = fmpq_equal(z, y + j);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                fmpq_poly_print(P), flint_printf("\n\n");
+                fmpz_print(x + j), flint_printf("\n\n");
+                fmpq_print(z), flint_printf("\n\n");
+                fmpq_print(y + j), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpq_poly_clear(P);
+        _fmpz_vec_clear(x, npoints);
+        _fmpq_vec_clear(y, npoints);
+        fmpq_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpq_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("interpolate_fmpz_vec_fast....");
+    fflush(stdout);
+
+    /* compare with the classical version */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpq_poly_t P, Q;
+        fmpz *x, *y;
+        slong j, n, bits;
+
+        n = n_randint(state, 50);
+        bits = n_randint(state, 100);
+
+        x = _fmpz_vec_init(n);
+        y = _fmpz_vec_init(n);
+
+        fmpq_poly_init(P);
+        fmpq_poly_init(Q);
+
+        for (j = 0; j < n; j++)
+            fmpz_set_si(x + j, -n/2 + j);
+
+        _fmpz_vec_randtest(y, state, n, bits);
+
+        fmpq_poly_interpolate_fmpz_vec(P, x, y, n);
+        fmpq_poly_interpolate_fmpz_vec_fast(Q, x, y, n);
+
+        result = fmpq_poly_equal(P, Q);
+        if (!result)
+        {
+            flint_printf("FAIL (P != Q):\n");
+            flint_printf("y:\n"); _fmpz_vec_print(y, n); flint_printf("\n\n");
+            fmpq_poly_print(P), flint_printf("\n\n");
+            fmpq_poly_print(Q), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpq_poly_clear(P);
+        fmpq_poly_clear(Q);
+        _fmpz_vec_clear(x, n);
+        _fmpz_vec_clear(y, n);
+    }
+
+    /* check the values, reusing the precomputation */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpq_poly_t P;
+        fmpz_poly_multipoint_precomp_t T;
+        fmpz *x, *y;
+        fmpq *v;
+        slong j, npoints;
+
+        npoints = n_randint(state, (i % 20 == 0) ? 300 : 50);
+
+        x = _fmpz_vec_init(npoints);
+        y = _fmpz_vec_init(npoints);
+        v = _fmpq_vec_init(npoints);
+
+        fmpq_poly_init(P);
+
+        for (j = 0; j < npoints; j++)
+            fmpz_set_si(x + j, 3 * j - npoints);
+
+        fmpz_poly_multipoint_precompute(T, x, npoints);
+
+        _fmpz_vec_randtest(y, state, npoints, n_randint(state, 100));
+        fmpq_poly_interpolate_fmpz_vec_fast_precomp(P, y, T);
+        fmpq_poly_evaluate_fmpz_vec_fast_precomp(v, P, T);
+
+        for (j = 0; j < npoints; j++)
+        {
+            if (!fmpz_equal(fmpq_numref(v + j), y + j)
+                || !fmpz_is_one(fmpq_denref(v + j)))
+            {
+                flint_printf("FAIL (values):\n");
+                flint_printf("y:\n"); _fmpz_vec_print(y, npoints);
+                flint_printf("\n\n");
+                flint_printf("P:\n"); fmpq_poly_print(P), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_poly_multipoint_clear(T);
+
+        fmpq_poly_clear(P);
+        _fmpz_vec_clear(x, npoints);
+        _fmpz_vec_clear(y, npoints);
+        _fmpq_vec_clear(v, npoints);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -41,6 +41,15 @@
 
 #define SIZE_RED_FAILURE_THRESH 5
 
+#define FMPZ_LLL_RECURSIVE_CUTOFF 64
+
+/*
+    Amount of work, in word sized multiply-adds, each thread must get. A
+    thread takes about 17 us to start and join and a multiply-add about
+    5 ns, so this keeps the overhead at about 5 percent.
+*/
+#define FMPZ_LLL_THREAD_CUTOFF (WORD(1) << 16)
+
 typedef enum
 {
     GRAM,
@@ -120,6 +129,12 @@ FLINT_DLL int fmpz_lll_advance_check_babai_heuristic_d(int cur_kappa, int kappa,
        d_mat_t appB, int *expo, fmpz_gram_t A,
        int a, int zeros, int kappamax, int n, const fmpz_lll_t fl);
 
+FLINT_DLL void fmpz_lll_size_reduce_row(fmpz * v, fmpz * const * rows,
+                          const slong * c, slong num, slong len, slong bits);
+
+FLINT_DLL void fmpz_lll_size_reduce_gram(fmpz_mat_t G, const fmpz * x,
+                                                    slong zeros, slong kappa);
+
 /* LLL with removals  ********************************************************/
 
 FLINT_DLL int fmpz_lll_d_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
@@ -164,6 +179,30 @@ FLINT_DLL int fmpz_lll_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_
 
 FLINT_DLL void fmpz_lll_storjohann_ulll(fmpz_mat_t FM, slong new_size, const fmpz_lll_t fl);
 
+/* BKZ  **********************************************************************/
+
+#define FMPZ_LLL_BKZ_PRUNE      1
+#define FMPZ_LLL_BKZ_AUTO_ABORT 2
+
+typedef int (*fmpz_lll_bkz_callback_t)(slong tour, slong changes,
+                                       const fmpz_mat_t B, void * arg);
+
+typedef struct
+{
+    slong block_size;
+    slong max_tours;
+    int flags;
+    fmpz_lll_bkz_callback_t callback;
+    void * callback_arg;
+} fmpz_lll_bkz_param_struct;
+
+typedef fmpz_lll_bkz_param_struct fmpz_lll_bkz_param_t[1];
+
+FLINT_DLL void fmpz_lll_bkz_param_init(fmpz_lll_bkz_param_t param, slong block_size);
+
+FLINT_DLL slong fmpz_lll_bkz(fmpz_mat_t B, fmpz_mat_t U,
+                   const fmpz_lll_bkz_param_t param, const fmpz_lll_t fl);
+
 #ifdef __cplusplus
 }
 #endif
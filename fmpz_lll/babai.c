@@ -19,17 +19,47 @@
 #endif
 #define GM ((fl->rt == Z_BASIS) ? A->exactSP : B)
 
+/*
+    Sets muk[k] to muk[k] - x 2^e muj[k] for lo <= k < hi. Away from the
+    ends of the exponent range, scaling x first gives the same result as
+    scaling each product, and keeps the loop free of calls to ldexp.
+*/
+static void
+_babai_mu_submul(double * muk, const double * muj, int lo, int hi,
+                                                           double x, int e)
+{
+    int k;
+
+    if (e > -1000 && e < 960)
+    {
+        x = ldexp(x, e);
+
+        for (k = lo; k < hi; k++)
+            muk[k] -= x * muj[k];
+    }
+    else
+    {
+        for (k = lo; k < hi; k++)
+            muk[k] -= ldexp(x * muj[k], e);
+    }
+}
+
 FUNC_HEAD
 {
     if (fl->rt == Z_BASIS && fl->gt == APPROX)
     {
         int i, j, k, test, aa, exponent, max_expo = INT_MAX;
-        slong xx;
+        slong xx, nops, * xs;
+        fmpz ** rows, ** urows;
         double tmp, rtmp, halfplus, onedothalfplus;
         ulong loops;
 
         aa = (a > zeros) ? a : zeros + 1;
 
+        xs = flint_malloc(LIMIT * sizeof(slong));
+        rows = flint_malloc(2 * LIMIT * sizeof(fmpz *));
+        urows = rows + LIMIT;
+
         halfplus = (fl->eta + 0.5) / 2;
         onedothalfplus = 1.0 + halfplus;
 
@@ -97,6 +127,8 @@ FUNC_HEAD
                 }
                 if (new_max_expo > max_expo - SIZE_RED_FAILURE_THRESH)
                 {
+                    flint_free(xs);
+                    flint_free(rows);
                     return -1;
                 }
                 max_expo = new_max_expo;
@@ -106,6 +138,13 @@ FUNC_HEAD
             /* Step3--5: compute the X_j's  */
             /* **************************** */
 
+            /*
+                The updates of the basis only depend on the X_j's, so those
+                with X_j a slong are collected and done in a single pass
+                over the rows once the loop is over.
+            */
+            nops = 0;
+
             for (j = LIMIT - 1; j > zeros; j--)
             {
                 /* test of the relaxed size-reduction condition */
@@ -120,40 +159,16 @@ FUNC_HEAD
                     /* we consider separately the cases X = +-1 */
                     if (tmp <= onedothalfplus)
                     {
-                        if (d_mat_entry(mu, kappa, j) >= 0) /* in this case, X is 1 */
-                        {
-                            for (k = zeros + 1; k < j; k++)
-                            {
-                                tmp = ldexp(d_mat_entry(mu, j, k), exponent);
-                                d_mat_entry(mu, kappa, k) =
-                                    d_mat_entry(mu, kappa, k) - tmp;
-                            }
-                            _fmpz_vec_sub(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_sub(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
-                        }
-                        else    /* otherwise X is -1 */
-                        {
-                            for (k = zeros + 1; k < j; k++)
-                            {
-                                tmp = ldexp(d_mat_entry(mu, j, k), exponent);
-                                d_mat_entry(mu, kappa, k) =
-                                    d_mat_entry(mu, kappa, k) + tmp;
-                            }
-                            _fmpz_vec_add(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_add(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
-                        }
+                        xx = (d_mat_entry(mu, kappa, j) >= 0) ? 1 : -1;
+
+                        _babai_mu_submul(mu->rows[kappa], mu->rows[j],
+                                         zeros + 1, j, (double) xx, exponent);
+
+                        xs[nops] = xx;
+                        rows[nops] = B->rows[j];
+                        if (U != NULL)
+                            urows[nops] = U->rows[j];
+                        nops++;
                     }
                     else        /* we must have |X| >= 2 */
                     {
@@ -166,23 +181,15 @@ FUNC_HEAD
                             else
                                 tmp = floor(tmp + 0.5);
 
-                            for (k = zeros + 1; k < j; k++)
-                            {
-                                rtmp = tmp * d_mat_entry(mu, j, k);
-                                rtmp = ldexp(rtmp, exponent);
-                                d_mat_entry(mu, kappa, k) =
-                                    d_mat_entry(mu, kappa, k) - rtmp;
-                            }
+                            _babai_mu_submul(mu->rows[kappa], mu->rows[j],
+                                             zeros + 1, j, tmp, exponent);
 
                             xx = (slong) tmp;
-                            _fmpz_vec_scalar_submul_si(B->rows[kappa],
-                                                       B->rows[j], n, xx);
+                            xs[nops] = xx;
+                            rows[nops] = B->rows[j];
                             if (U != NULL)
-                            {
-                                _fmpz_vec_scalar_submul_si(U->rows[kappa],
-                                                           U->rows[j],
-                                                           U->c, xx);
-                            }
+                                urows[nops] = U->rows[j];
+                            nops++;
                         }
                         else
                         {
@@ -254,6 +261,15 @@ FUNC_HEAD
                 }
             }
 
+            if (nops != 0)
+            {
+                fmpz_lll_size_reduce_row(B->rows[kappa], rows, xs,
+                                         nops, n, expo[kappa]);
+                if (U != NULL)
+                    fmpz_lll_size_reduce_row(U->rows[kappa], urows,
+                                             xs, nops, U->c, expo[kappa]);
+            }
+
             if (test)           /* Anything happened? */
             {
                 expo[kappa] =
@@ -277,6 +293,9 @@ FUNC_HEAD
             loops++;
         } while (test);
 
+        flint_free(xs);
+        flint_free(rows);
+
 #if TYPE == 1
         if (d_is_nan(d_mat_entry(A->appSP, kappa, kappa)))
         {
@@ -396,7 +415,7 @@ FUNC_HEAD
             /* Step3--5: compute the X_j's  */
             /* **************************** */
 
-            x = _fmpz_vec_init(kappa - 1 - zeros);
+            x = _fmpz_vec_init(kappa);
             for (j = kappa - 1; j > zeros; j--)
             {
                 /* test of the relaxed size-reduction condition */
@@ -597,25 +616,10 @@ FUNC_HEAD
                 fmpz_get_d_2exp(&exp, fmpz_mat_entry(GM, kappa, kappa));
                 expo[kappa] = exp;
 
-                for (i = zeros + 1; i < kappa; i++)
-                {
-                    for (j = zeros + 1; j <= i; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, kappa, i),
-                                    x + j, fmpz_mat_entry(GM, i, j));
-                    for (j = i + 1; j < kappa; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, kappa, i),
-                                    x + j, fmpz_mat_entry(GM, j, i));
-                }
-
-                for (i = kappa + 1; i < GM->r; i++)
-                {
-                    for (j = zeros + 1; j < kappa; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, i, kappa),
-                                    x + j, fmpz_mat_entry(GM, i, j));
-                }
+                fmpz_lll_size_reduce_gram(GM, x, zeros, kappa);
             }
 
-            _fmpz_vec_clear(x, kappa - 1 - zeros);
+            _fmpz_vec_clear(x, kappa);
             loops++;
         } while (test);
 
@@ -0,0 +1,641 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "fmpz_vec.h"
+#include "d_vec.h"
+#include "double_extras.h"
+#include "fmpz_lll.h"
+
+/* beyond this the exact inner products may overflow a double */
+#define BKZ_D_MAX_BITS 500
+
+/* number of bits of the Gram-Schmidt data that must be correct */
+#define BKZ_GSO_GUARD_BITS 20
+
+#define BKZ_PI 3.14159265358979323846
+
+/*
+    Gram-Schmidt data of the rows [0, valid) of the basis, kept in doubles
+    while the entries of the basis are small enough and this is accurate,
+    and in mpf otherwise. The array log_norm holds log2 |b_i|^2.
+*/
+typedef struct
+{
+    slong d;
+    slong valid;
+    int use_mpf;
+    int d_failed;
+    mp_bitcnt_t prec;
+    d_mat_t mu, r;
+    mpf_mat_t mpf_mu, mpf_r;
+    double * log_norm;
+} bkz_gso_struct;
+
+static void
+_bkz_gso_init(bkz_gso_struct * G, slong d)
+{
+    G->d = d;
+    G->valid = 0;
+    G->use_mpf = 0;
+    G->d_failed = 0;
+    G->prec = 0;
+    d_mat_init(G->mu, d, d);
+    d_mat_init(G->r, d, d);
+    G->log_norm = _d_vec_init(d);
+}
+
+static void
+_bkz_gso_clear(bkz_gso_struct * G)
+{
+    d_mat_clear(G->mu);
+    d_mat_clear(G->r);
+    _d_vec_clear(G->log_norm);
+
+    if (G->prec != 0)
+    {
+        mpf_mat_clear(G->mpf_mu);
+        mpf_mat_clear(G->mpf_r);
+    }
+}
+
+static void
+_bkz_gso_set_prec(bkz_gso_struct * G, mp_bitcnt_t prec)
+{
+    if (G->prec != 0)
+    {
+        mpf_mat_clear(G->mpf_mu);
+        mpf_mat_clear(G->mpf_r);
+    }
+
+    mpf_mat_init(G->mpf_mu, G->d, G->d, prec);
+    mpf_mat_init(G->mpf_r, G->d, G->d, prec);
+    G->prec = prec;
+    G->valid = 0;
+}
+
+/*
+    The Gram-Schmidt data is the Cholesky decomposition of the exact Gram
+    matrix, computed one row at a time: r_ij = <b_i, b_j> - sum_{l < j}
+    mu_jl r_il and mu_ij = r_ij / r_jj. With unit roundoff u, the computed
+    r_ij has an absolute error of about (i + 2) u |b_i| |b_j|, so the error
+    of mu_ij is about (i + 2) u |b_i| |b_j| / r_jj, and for j = i this is
+    also the relative error of r_ii. Returns log2 of the largest of these
+    bounds for row i divided by u, i.e. the number of bits lost, given the
+    values log_r[j] = log2 r_jj for j <= i.
+*/
+static double
+_bkz_gso_loss(const bkz_gso_struct * G, slong i, const double * log_r)
+{
+    double loss, t;
+    slong j;
+
+    loss = G->log_norm[i] - log_r[i];
+
+    for (j = 0; j < i; j++)
+    {
+        t = 0.5 * (G->log_norm[i] + G->log_norm[j]) - log_r[j];
+        loss = FLINT_MAX(loss, t);
+    }
+
+    return loss + log(i + 2.0) / log(2.0);
+}
+
+static double
+_bkz_fmpz_log2(const fmpz_t t)
+{
+    slong e;
+    double m = fmpz_get_d_2exp(&e, t);
+    return log(m) / log(2.0) + e;
+}
+
+static double
+_bkz_mpf_log2(const mpf_t t)
+{
+    signed long e;
+    double m = mpf_get_d_2exp(&e, t);
+    return log(m) / log(2.0) + e;
+}
+
+/*
+    Returns 0 if some r_ii comes out nonpositive, or if the data of some
+    row is not accurate to BKZ_GSO_GUARD_BITS bits, i.e. precision was lost.
+*/
+static int
+_bkz_gso_update_d(bkz_gso_struct * G, const fmpz_mat_t B, slong h)
+{
+    fmpz_t t;
+    double s, * log_r;
+    slong i, j, l;
+    int ok = 1;
+
+    fmpz_init(t);
+    log_r = _d_vec_init(h);
+
+    for (i = 0; i < G->valid; i++)
+        log_r[i] = log(d_mat_entry(G->r, i, i)) / log(2.0);
+
+    for (i = G->valid; i < h && ok; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            _fmpz_vec_dot(t, B->rows[i], B->rows[j], B->c);
+            s = fmpz_get_d(t);
+
+            if (j == i)
+                G->log_norm[i] = _bkz_fmpz_log2(t);
+
+            for (l = 0; l < j; l++)
+                s -= d_mat_entry(G->mu, j, l) * d_mat_entry(G->r, i, l);
+
+            d_mat_entry(G->r, i, j) = s;
+
+            if (j < i)
+                d_mat_entry(G->mu, i, j) = s / d_mat_entry(G->r, j, j);
+        }
+
+        ok = (d_mat_entry(G->r, i, i) > 0.0);
+
+        if (ok)
+        {
+            log_r[i] = log(d_mat_entry(G->r, i, i)) / log(2.0);
+            ok = (_bkz_gso_loss(G, i, log_r) <= D_BITS - BKZ_GSO_GUARD_BITS);
+        }
+    }
+
+    if (ok)
+        G->valid = h;
+
+    fmpz_clear(t);
+    _d_vec_clear(log_r);
+
+    return ok;
+}
+
+static int
+_bkz_gso_update_mpf(bkz_gso_struct * G, const fmpz_mat_t B, slong h)
+{
+    fmpz_t t;
+    mpf_t s, u;
+    double * log_r;
+    slong i, j, l;
+    int ok = 1;
+
+    fmpz_init(t);
+    mpf_init2(s, G->prec);
+    mpf_init2(u, G->prec);
+    log_r = _d_vec_init(h);
+
+    for (i = 0; i < G->valid; i++)
+        log_r[i] = _bkz_mpf_log2(mpf_mat_entry(G->mpf_r, i, i));
+
+    for (i = G->valid; i < h && ok; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            _fmpz_vec_dot(t, B->rows[i], B->rows[j], B->c);
+            fmpz_get_mpf(s, t);
+
+            if (j == i)
+                G->log_norm[i] = _bkz_fmpz_log2(t);
+
+            for (l = 0; l < j; l++)
+            {
+                mpf_mul(u, mpf_mat_entry(G->mpf_mu, j, l),
+                           mpf_mat_entry(G->mpf_r, i, l));
+                mpf_sub(s, s, u);
+            }
+
+            mpf_set(mpf_mat_entry(G->mpf_r, i, j), s);
+
+            if (j < i)
+                mpf_div(mpf_mat_entry(G->mpf_mu, i, j), s,
+                        mpf_mat_entry(G->mpf_r, j, j));
+        }
+
+        ok = (mpf_sgn(mpf_mat_entry(G->mpf_r, i, i)) > 0);
+
+        if (ok)
+        {
+            log_r[i] = _bkz_mpf_log2(mpf_mat_entry(G->mpf_r, i, i));
+            ok = (_bkz_gso_loss(G, i, log_r)
+                                <= (double) G->prec - BKZ_GSO_GUARD_BITS);
+        }
+    }
+
+    if (ok)
+        G->valid = h;
+
+    fmpz_clear(t);
+    mpf_clear(s);
+    mpf_clear(u);
+    _d_vec_clear(log_r);
+
+    return ok;
+}
+
+static void
+_bkz_gso_update(bkz_gso_struct * G, const fmpz_mat_t B, slong h)
+{
+    if (G->valid >= h)
+        return;
+
+    if (G->valid == 0)
+        G->use_mpf = G->d_failed
+                  || FLINT_ABS(fmpz_mat_max_bits(B)) > BKZ_D_MAX_BITS;
+
+    if (!G->use_mpf)
+    {
+        if (_bkz_gso_update_d(G, B, h))
+            return;
+
+        G->d_failed = 1;
+        G->use_mpf = 1;
+        G->valid = 0;
+    }
+
+    if (G->prec == 0)
+        _bkz_gso_set_prec(G, D_BITS + 2 * G->d);
+
+    while (!_bkz_gso_update_mpf(G, B, h))
+        _bkz_gso_set_prec(G, 2 * G->prec);
+}
+
+/* Gram-Schmidt data of the block [k, k + m), relative to r_kk */
+static void
+_bkz_gso_block(d_mat_t mu, double * r, const bkz_gso_struct * G,
+                                                           slong k, slong m)
+{
+    slong i, j;
+
+    if (!G->use_mpf)
+    {
+        for (i = 0; i < m; i++)
+        {
+            r[i] = d_mat_entry(G->r, k + i, k + i) / d_mat_entry(G->r, k, k);
+
+            for (j = 0; j < i; j++)
+                d_mat_entry(mu, i, j) = d_mat_entry(G->mu, k + i, k + j);
+        }
+    }
+    else
+    {
+        mpf_t t;
+
+        mpf_init2(t, G->prec);
+
+        for (i = 0; i < m; i++)
+        {
+            mpf_div(t, mpf_mat_entry(G->mpf_r, k + i, k + i),
+                       mpf_mat_entry(G->mpf_r, k, k));
+            r[i] = mpf_get_d(t);
+
+            for (j = 0; j < i; j++)
+                d_mat_entry(mu, i, j) =
+                    mpf_get_d(mpf_mat_entry(G->mpf_mu, k + i, k + j));
+        }
+
+        mpf_clear(t);
+    }
+}
+
+static double
+_bkz_gso_log_r(const bkz_gso_struct * G, slong i)
+{
+    if (!G->use_mpf)
+    {
+        return log(d_mat_entry(G->r, i, i));
+    }
+    else
+    {
+        signed long e;
+        double m = mpf_get_d_2exp(&e, mpf_mat_entry(G->mpf_r, i, i));
+        return log(m) + e * log(2.0);
+    }
+}
+
+/* slope of the least squares fit to log r_ii, which BKZ makes flatter */
+static double
+_bkz_slope(const bkz_gso_struct * G, slong d)
+{
+    double x, y, sxy = 0.0, sxx = 0.0, mean_y = 0.0;
+    double mean_x = (d - 1) / 2.0;
+    slong i;
+
+    for (i = 0; i < d; i++)
+        mean_y += _bkz_gso_log_r(G, i);
+    mean_y /= d;
+
+    for (i = 0; i < d; i++)
+    {
+        x = i - mean_x;
+        y = _bkz_gso_log_r(G, i) - mean_y;
+        sxy += x * y;
+        sxx += x * x;
+    }
+
+    return sxy / sxx;
+}
+
+/* squared length predicted by the Gaussian heuristic for the block */
+static double
+_bkz_gaussian_heuristic(const double * r, slong m)
+{
+    double s = 0.0, lg = 0.0;
+    slong i;
+
+    for (i = 0; i < m; i++)
+        s += log(r[i]);
+
+    /* log Gamma(m/2 + 1) */
+    for (i = m; i > 0; i -= 2)
+        lg += log(i / 2.0);
+    if (m & 1)
+        lg += 0.5 * log(BKZ_PI);
+
+    return exp((s + 2 * lg) / m - log(BKZ_PI));
+}
+
+/*
+    Schnorr-Euchner enumeration of the block with Gram-Schmidt data mu, r,
+    for a nonzero integer vector x whose projection has squared norm
+    sum_i r_i (x_i + sum_{j > i} mu_ji x_j)^2 less than R2. With linear
+    pruning the partial norm over the levels i, ..., m - 1 is bounded by
+    R2 (m - i) / m instead. Each solution found shrinks R2. Returns the
+    squared norm of the shortest vector found, with its coordinates in
+    sol, or R2 if there is none.
+*/
+static double
+_bkz_enum(slong * sol, const d_mat_t mu, const double * r, slong m,
+                                                        double R2, int prune)
+{
+    double * x, * c, * dx, * ddx, * l, * bound;
+    double y, li;
+    slong i, j;
+
+    x = _d_vec_init(6 * m + 1);
+    c = x + m;
+    dx = c + m;
+    ddx = dx + m;
+    bound = ddx + m;
+    l = bound + m;
+
+    for (i = 0; i < m; i++)
+    {
+        x[i] = c[i] = l[i] = 0.0;
+        dx[i] = ddx[i] = 1.0;
+        bound[i] = prune ? R2 * (m - i) / m : R2;
+    }
+    l[m] = 0.0;
+
+    i = m - 1;
+
+    while (1)
+    {
+        y = x[i] - c[i];
+        li = l[i + 1] + y * y * r[i];
+
+        if (li < bound[i])
+        {
+            if (i > 0)
+            {
+                l[i] = li;
+                i--;
+
+                y = 0.0;
+                for (j = i + 1; j < m; j++)
+                    y -= x[j] * d_mat_entry(mu, j, i);
+
+                c[i] = y;
+                x[i] = floor(y + 0.5);
+                dx[i] = ddx[i] = (c[i] >= x[i]) ? 1.0 : -1.0;
+
+                continue;
+            }
+
+            if (li > 0.0)
+            {
+                R2 = li;
+
+                for (j = 0; j < m; j++)
+                {
+                    sol[j] = (slong) x[j];
+                    bound[j] = prune ? R2 * (m - j) / m : R2;
+                }
+            }
+        }
+        else
+        {
+            i++;
+
+            if (i == m)
+                break;
+        }
+
+        /*
+            next candidate at level i, zigzagging around the center; while
+            all the higher coordinates are zero only x_i > 0 is tried, as
+            x and -x give the same vector
+        */
+        if (l[i + 1] == 0.0)
+        {
+            x[i] += 1.0;
+        }
+        else
+        {
+            x[i] += dx[i];
+            ddx[i] = -ddx[i];
+            dx[i] = ddx[i] - dx[i];
+        }
+    }
+
+    _d_vec_clear(x);
+
+    return R2;
+}
+
+/*
+    Inserts sum_j x_j b_{k + j} in front of b_k and removes the resulting
+    linear dependency with LLL on the rows [0, k + m], which moves the zero
+    vector it produces to the first row. The later rows are left alone, so
+    they need not be size reduced afterwards. Returns the number of leading
+    rows which did not change, usually k.
+*/
+static slong
+_bkz_insert(fmpz_mat_t B, fmpz_mat_t U, const slong * x, slong k, slong m,
+                                                         const fmpz_lll_t fl)
+{
+    fmpz_mat_t B2, U2;
+    slong i, valid, h = k + m;
+
+    fmpz_mat_init(B2, h + 1, B->c);
+    if (U != NULL)
+        fmpz_mat_init(U2, h + 1, U->c);
+
+    for (i = 0; i < h; i++)
+    {
+        _fmpz_vec_set(B2->rows[i + (i >= k)], B->rows[i], B->c);
+        if (U != NULL)
+            _fmpz_vec_set(U2->rows[i + (i >= k)], U->rows[i], U->c);
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        if (x[i] != 0)
+        {
+            _fmpz_vec_scalar_addmul_si(B2->rows[k], B->rows[k + i],
+                                                            B->c, x[i]);
+            if (U != NULL)
+                _fmpz_vec_scalar_addmul_si(U2->rows[k], U->rows[k + i],
+                                                            U->c, x[i]);
+        }
+    }
+
+    fmpz_lll_wrapper(B2, (U != NULL) ? U2 : NULL, fl);
+
+    for (valid = 0; valid < k && _fmpz_vec_equal(B->rows[valid],
+                                    B2->rows[valid + 1], B->c); valid++) ;
+
+    for (i = 0; i < h; i++)
+    {
+        _fmpz_vec_swap(B->rows[i], B2->rows[i + 1], B->c);
+        if (U != NULL)
+            _fmpz_vec_swap(U->rows[i], U2->rows[i + 1], U->c);
+    }
+
+    fmpz_mat_clear(B2);
+    if (U != NULL)
+        fmpz_mat_clear(U2);
+
+    return valid;
+}
+
+slong
+fmpz_lll_bkz(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_bkz_param_t param,
+                                                         const fmpz_lll_t fl)
+{
+    fmpz_mat_t Bw, Uw;
+    bkz_gso_struct G;
+    d_mat_t mu;
+    double * r;
+    double R2, slope, best_slope = 0.0;
+    slong * x;
+    slong d, z, beta, k, h, m, tour, changes, stalls, valid;
+    int prune, inserted;
+
+    if (fl->rt != Z_BASIS)
+    {
+        flint_printf("Exception (fmpz_lll_bkz). Only lattice bases are "
+                     "supported.\n");
+        flint_abort();
+    }
+
+    if (U != NULL && U->r != B->r)
+    {
+        flint_printf("Exception (fmpz_lll_bkz). Incompatible dimensions of "
+                     "capturing matrix.\n");
+        flint_abort();
+    }
+
+    fmpz_lll_wrapper(B, U, fl);
+
+    /* linear dependencies have become zero rows at the top */
+    for (z = 0; z < B->r && _fmpz_vec_is_zero(B->rows[z], B->c); z++) ;
+
+    d = B->r - z;
+    beta = FLINT_MIN(param->block_size, d);
+
+    if (beta < 2)
+        return 0;
+
+    fmpz_mat_window_init(Bw, B, z, 0, B->r, B->c);
+    if (U != NULL)
+        fmpz_mat_window_init(Uw, U, z, 0, U->r, U->c);
+
+    _bkz_gso_init(&G, d);
+    d_mat_init(mu, beta, beta);
+    r = _d_vec_init(beta);
+    x = flint_malloc(beta * sizeof(slong));
+
+    prune = param->flags & FMPZ_LLL_BKZ_PRUNE;
+    stalls = 0;
+    inserted = 0;
+
+    for (tour = 0; param->max_tours <= 0 || tour < param->max_tours; )
+    {
+        changes = 0;
+
+        for (k = 0; k < d - 1; k++)
+        {
+            h = FLINT_MIN(k + beta, d);
+            m = h - k;
+
+            _bkz_gso_update(&G, Bw, h);
+            _bkz_gso_block(mu, r, &G, k, m);
+
+            /*
+                look for a vector shorter than b*_k by the Lovasz factor; as
+                in BKZ 2.0, pruned enumeration in large blocks is also capped
+                at 1.1 times the length predicted by the Gaussian heuristic,
+                which is too unreliable in small blocks to be used there
+            */
+            R2 = fl->delta;
+            if (prune && m >= 30)
+                R2 = FLINT_MIN(R2, 1.21 * _bkz_gaussian_heuristic(r, m));
+
+            if (_bkz_enum(x, mu, r, m, R2, prune) < R2)
+            {
+                valid = _bkz_insert(Bw, (U != NULL) ? Uw : NULL, x, k, m, fl);
+                G.valid = FLINT_MIN(G.valid, valid);
+                changes++;
+                inserted = 1;
+            }
+        }
+
+        tour++;
+
+        if (param->callback != NULL &&
+            param->callback(tour, changes, B, param->callback_arg))
+            break;
+
+        if (changes == 0)
+            break;
+
+        /* stop once the profile has not got flatter for a few tours */
+        if (param->flags & FMPZ_LLL_BKZ_AUTO_ABORT)
+        {
+            _bkz_gso_update(&G, Bw, d);
+            slope = _bkz_slope(&G, d);
+
+            if (tour == 1 || slope > best_slope + 1e-4 * fabs(best_slope))
+            {
+                best_slope = slope;
+                stalls = 0;
+            }
+            else if (++stalls >= 5)
+                break;
+        }
+    }
+
+    /* the rows after each insertion were not size reduced */
+    if (inserted)
+        fmpz_lll_wrapper(Bw, (U != NULL) ? Uw : NULL, fl);
+
+    _bkz_gso_clear(&G);
+    d_mat_clear(mu);
+    _d_vec_clear(r);
+    flint_free(x);
+    fmpz_mat_window_clear(Bw);
+    if (U != NULL)
+        fmpz_mat_window_clear(Uw);
+
+    return tour;
+}
@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_lll.h"
+
+void
+fmpz_lll_bkz_param_init(fmpz_lll_bkz_param_t param, slong block_size)
+{
+    param->block_size = block_size;
+    param->max_tours = 0;
+    param->flags = (block_size >= 30) ?
+                   (FMPZ_LLL_BKZ_PRUNE | FMPZ_LLL_BKZ_AUTO_ABORT) : 0;
+    param->callback = NULL;
+    param->callback_arg = NULL;
+}
@@ -334,7 +334,7 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
             /* Step3--5: compute the X_j's  */
             /* **************************** */
 
-            x = _fmpz_vec_init(kappa - 1 - zeros);
+            x = _fmpz_vec_init(kappa);
             for (j = kappa - 1; j > zeros; j--)
             {
                 /* test of the relaxed size-reduction condition */
@@ -476,25 +476,10 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                     }
                 }
 
-                for (i = zeros + 1; i < kappa; i++)
-                {
-                    for (j = zeros + 1; j <= i; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, kappa, i),
-                                    x + j, fmpz_mat_entry(GM, i, j));
-                    for (j = i + 1; j < kappa; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, kappa, i),
-                                    x + j, fmpz_mat_entry(GM, j, i));
-                }
-
-                for (i = kappa + 1; i < GM->r; i++)
-                {
-                    for (j = zeros + 1; j < kappa; j++)
-                        fmpz_submul(fmpz_mat_entry(GM, i, kappa),
-                                    x + j, fmpz_mat_entry(GM, i, j));
-                }
+                fmpz_lll_size_reduce_gram(GM, x, zeros, kappa);
             }
 
-            _fmpz_vec_clear(x, kappa - 1 - zeros);
+            _fmpz_vec_clear(x, kappa);
             loops++;
         } while (test);
 
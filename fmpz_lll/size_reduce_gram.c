@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+
+/*
+    Updates the entries t0, ..., t1 - 1 of the list of off-diagonal
+    entries of row and column kappa, where entry t is <b_kappa, b_i>
+    with i = zeros + 1 + t, skipping i = kappa. Only the lower triangle
+    of G is stored.
+*/
+static void
+_fmpz_lll_size_reduce_gram_range(fmpz_mat_t G, const fmpz * x,
+                                 slong zeros, slong kappa, slong t0, slong t1)
+{
+    slong i, j, t;
+    fmpz * e;
+
+    for (t = t0; t < t1; t++)
+    {
+        i = zeros + 1 + t;
+
+        if (i < kappa)
+        {
+            e = fmpz_mat_entry(G, kappa, i);
+
+            for (j = zeros + 1; j <= i; j++)
+                if (!fmpz_is_zero(x + j))
+                    fmpz_submul(e, x + j, fmpz_mat_entry(G, i, j));
+            for (j = i + 1; j < kappa; j++)
+                if (!fmpz_is_zero(x + j))
+                    fmpz_submul(e, x + j, fmpz_mat_entry(G, j, i));
+        }
+        else
+        {
+            i++;
+            e = fmpz_mat_entry(G, i, kappa);
+
+            for (j = zeros + 1; j < kappa; j++)
+                if (!fmpz_is_zero(x + j))
+                    fmpz_submul(e, x + j, fmpz_mat_entry(G, i, j));
+        }
+    }
+}
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+typedef struct
+{
+    fmpz_mat_struct * G;
+    const fmpz * x;
+    slong zeros;
+    slong kappa;
+    slong t0;
+    slong t1;
+}
+size_reduce_gram_arg_t;
+
+static void *
+_fmpz_lll_size_reduce_gram_worker(void * arg_ptr)
+{
+    size_reduce_gram_arg_t arg = *((size_reduce_gram_arg_t *) arg_ptr);
+
+    _fmpz_lll_size_reduce_gram_range(arg.G, arg.x, arg.zeros, arg.kappa,
+                                     arg.t0, arg.t1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
+void
+fmpz_lll_size_reduce_gram(fmpz_mat_t G, const fmpz * x,
+                                                    slong zeros, slong kappa)
+{
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    slong i, m, bits, num_threads, work;
+    pthread_t * threads;
+    size_reduce_gram_arg_t * args;
+
+    m = G->r - zeros - 2;
+    bits = fmpz_bits(fmpz_mat_entry(G, kappa, kappa));
+    work = m * (kappa - zeros - 1) * (1 + bits / FLINT_BITS);
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), m);
+    num_threads = FLINT_MIN(num_threads, work / FMPZ_LLL_THREAD_CUTOFF);
+
+    if (num_threads <= 1)
+    {
+        _fmpz_lll_size_reduce_gram_range(G, x, zeros, kappa, 0, m);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(size_reduce_gram_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].G = G;
+        args[i].x = x;
+        args[i].zeros = zeros;
+        args[i].kappa = kappa;
+        args[i].t0 = (m * i) / num_threads;
+        args[i].t1 = (m * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL,
+                       _fmpz_lll_size_reduce_gram_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+#else
+    _fmpz_lll_size_reduce_gram_range(G, x, zeros, kappa, 0,
+                                     G->r - zeros - 2);
+#endif
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+typedef struct
+{
+    fmpz * v;
+    fmpz ** rows;
+    const slong * c;
+    slong num;
+    slong j0;
+    slong j1;
+}
+size_reduce_row_arg_t;
+
+static void *
+_fmpz_lll_size_reduce_row_worker(void * arg_ptr)
+{
+    size_reduce_row_arg_t arg = *((size_reduce_row_arg_t *) arg_ptr);
+
+    _fmpz_vec_scalar_submul_si_multi(arg.v + arg.j0, arg.rows, arg.c,
+                                     arg.num, arg.j1 - arg.j0);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
+void
+fmpz_lll_size_reduce_row(fmpz * v, fmpz * const * rows, const slong * c,
+                                          slong num, slong len, slong bits)
+{
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    slong i, k, num_threads, work;
+    pthread_t * threads;
+    size_reduce_row_arg_t * args;
+    fmpz ** shifted;
+
+    /* each thread gets a block of at least 16 columns */
+    work = num * len * (1 + FLINT_MAX(bits, 0) / FLINT_BITS);
+    num_threads = FLINT_MIN(flint_get_num_threads(), len / 16);
+    num_threads = FLINT_MIN(num_threads, work / FMPZ_LLL_THREAD_CUTOFF);
+
+    if (num_threads <= 1)
+    {
+        _fmpz_vec_scalar_submul_si_multi(v, rows, c, num, len);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(size_reduce_row_arg_t) * num_threads);
+    shifted = flint_malloc(sizeof(fmpz *) * num_threads * num);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].v = v;
+        args[i].rows = shifted + i * num;
+        args[i].c = c;
+        args[i].num = num;
+        args[i].j0 = (len * i) / num_threads;
+        args[i].j1 = (len * (i + 1)) / num_threads;
+
+        for (k = 0; k < num; k++)
+            args[i].rows[k] = rows[k] + args[i].j0;
+
+        pthread_create(&threads[i], NULL,
+                       _fmpz_lll_size_reduce_row_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(shifted);
+#else
+    _fmpz_vec_scalar_submul_si_multi(v, rows, c, num, len);
+#endif
+}
@@ -0,0 +1,418 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpq.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+static int
+stop_after_first(slong tour, slong changes, const fmpz_mat_t B, void * arg)
+{
+    (*((slong *) arg))++;
+    return 1;
+}
+
+static double
+_fmpq_get_d(const fmpq_t x)
+{
+    mpq_t t;
+    double d;
+
+    mpq_init(t);
+    fmpq_get_mpq(t, x);
+    d = mpq_get_d(t);
+    mpq_clear(t);
+
+    return d;
+}
+
+/*
+    Exact enumeration: whether some nonzero vector sum_i x_i b_i has squared
+    norm less than R, given mu and r = |b*_i|^2 for the rows of the basis,
+    the partial squared norm l of the levels above i and the coordinates
+    x_{i+1}, ..., x_{d-1}.
+*/
+static int
+has_shorter_level(slong * x, slong i, const fmpq * mu, const fmpq * r,
+                  slong d, const fmpq_t l, const fmpq_t R)
+{
+    fmpq_t c, t, u;
+    double w;
+    slong j, lo, hi;
+    int found = 0;
+
+    fmpq_init(c);
+    fmpq_init(t);
+    fmpq_init(u);
+
+    for (j = i + 1; j < d; j++)
+    {
+        fmpq_set_si(t, x[j], 1);
+        fmpq_submul(c, t, mu + j * d + i);
+    }
+
+    /* the candidates are widened by one to be safe from rounding */
+    fmpq_sub(t, R, l);
+    fmpq_div(t, t, r + i);
+    w = sqrt(_fmpq_get_d(t));
+    lo = (slong) floor(_fmpq_get_d(c) - w) - 1;
+    hi = (slong) ceil(_fmpq_get_d(c) + w) + 1;
+
+    for (x[i] = lo; x[i] <= hi && !found; x[i]++)
+    {
+        fmpq_set_si(t, x[i], 1);
+        fmpq_sub(t, t, c);
+        fmpq_mul(t, t, t);
+        fmpq_mul(t, t, r + i);
+        fmpq_add(u, l, t);
+
+        if (fmpq_cmp(u, R) >= 0)
+            continue;
+
+        if (i > 0)
+            found = has_shorter_level(x, i - 1, mu, r, d, u, R);
+        else
+            for (j = 0; j < d && !found; j++)
+                found = (x[j] != 0);
+    }
+
+    fmpq_clear(c);
+    fmpq_clear(t);
+    fmpq_clear(u);
+
+    return found;
+}
+
+static int
+has_shorter(const fmpz_mat_t B, const fmpq_t R)
+{
+    slong i, j, l, d = B->r;
+    fmpq * mu, * r;
+    fmpq_t s, t;
+    slong * x;
+    int found;
+
+    mu = _fmpq_vec_init(d * d);
+    r = _fmpq_vec_init(d);
+    x = flint_malloc(d * sizeof(slong));
+    fmpq_init(s);
+    fmpq_init(t);
+
+    /* exact Cholesky decomposition of the Gram matrix */
+    for (i = 0; i < d; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            _fmpz_vec_dot(fmpq_numref(s), B->rows[i], B->rows[j], B->c);
+            fmpz_one(fmpq_denref(s));
+
+            for (l = 0; l < j; l++)
+            {
+                fmpq_mul(t, mu + j * d + l, mu + i * d + l);
+                fmpq_submul(s, t, r + l);
+            }
+
+            if (j < i)
+                fmpq_div(mu + i * d + j, s, r + j);
+            else
+                fmpq_set(r + i, s);
+        }
+    }
+
+    fmpq_zero(s);
+    found = has_shorter_level(x, d - 1, mu, r, d, s, R);
+
+    _fmpq_vec_clear(mu, d * d);
+    _fmpq_vec_clear(r, d);
+    flint_free(x);
+    fmpq_clear(s);
+    fmpq_clear(t);
+
+    return found;
+}
+
+int
+main(void)
+{
+    int i, result;
+    fmpz_mat_t mat, mat2, lll, U;
+    fmpz_lll_t fl;
+    fmpz_lll_bkz_param_t param;
+    fmpz_t n1, n2;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("bkz....");
+    fflush(stdout);
+
+    fmpz_init(n1);
+    fmpz_init(n2);
+
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        slong r, c, tours, calls = 0;
+
+        r = n_randint(state, 30) + 1;
+        fmpz_lll_context_init_default(fl);
+        fmpz_lll_bkz_param_init(param, n_randint(state, 15) + 1);
+        param->flags = n_randint(state, 4);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                c = r + 1;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randintrel(mat, state, n_randint(state, 200) + 1);
+                break;
+            case 1:
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randajtai(mat, state, 0.5 + n_randint(state, 50) / 100.0);
+                break;
+            default:
+                r = 2 * ((r + 1) / 2);
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                fmpz_mat_randntrulike(mat, state, n_randint(state, 20) + 1,
+                                                  n_randint(state, 200) + 1);
+        }
+
+        fmpz_mat_init_set(mat2, mat);
+        fmpz_mat_init_set(lll, mat);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+
+        if (n_randint(state, 4) == 0)
+        {
+            param->callback = stop_after_first;
+            param->callback_arg = &calls;
+        }
+
+        if (n_randint(state, 2))
+        {
+            tours = fmpz_lll_bkz(mat, U, param, fl);
+            fmpz_mat_mul(mat2, U, mat2);
+            fmpz_mat_det(n1, U);
+
+            result = fmpz_mat_equal(mat, mat2) && fmpz_is_pm1(n1);
+            if (!result)
+            {
+                flint_printf("FAIL (transformation):\n");
+                fmpz_mat_print_pretty(mat);
+                fmpz_mat_print_pretty(mat2);
+                abort();
+            }
+        }
+        else
+        {
+            tours = fmpz_lll_bkz(mat, NULL, param, fl);
+        }
+
+        fmpz_lll_wrapper(lll, NULL, fl);
+        _fmpz_vec_dot(n1, mat->rows[0], mat->rows[0], c);
+        _fmpz_vec_dot(n2, lll->rows[0], lll->rows[0], c);
+
+        result = fmpz_mat_is_reduced(mat, fl->delta, fl->eta)
+              && fmpz_cmp(n1, n2) <= 0;
+        if (!result)
+        {
+            flint_printf("FAIL (not reduced):\n");
+            fmpz_mat_print_pretty(mat);
+            fmpz_mat_print_pretty(lll);
+            flint_printf("block_size = %wd, flags = %d\n",
+                         param->block_size, param->flags);
+            abort();
+        }
+
+        if (param->callback != NULL && (calls != tours || tours > 1))
+        {
+            flint_printf("FAIL (callback):\n");
+            flint_printf("tours = %wd, calls = %wd\n", tours, calls);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(lll);
+        fmpz_mat_clear(U);
+    }
+
+    /* linearly dependent rows come out as zero rows at the top */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        slong r, c;
+        fmpz_mat_t W;
+
+        r = n_randint(state, 20) + 2;
+        c = r + 1;
+
+        fmpz_lll_context_init_default(fl);
+        fmpz_lll_bkz_param_init(param, n_randint(state, 10) + 2);
+
+        fmpz_mat_init(mat, r, c);
+        fmpz_mat_init(mat2, r + 1, c);
+        fmpz_mat_randintrel(mat, state, n_randint(state, 100) + 1);
+
+        for (c = 0; c < r; c++)
+            _fmpz_vec_set(mat2->rows[c], mat->rows[c], mat->c);
+        _fmpz_vec_add(mat2->rows[r], mat->rows[0], mat->rows[r - 1], mat->c);
+
+        fmpz_lll_bkz(mat2, NULL, param, fl);
+
+        fmpz_mat_window_init(W, mat2, 1, 0, r + 1, mat->c);
+        result = _fmpz_vec_is_zero(mat2->rows[0], mat->c)
+              && fmpz_mat_rank(W) == r
+              && fmpz_mat_is_reduced(W, fl->delta, fl->eta);
+        fmpz_mat_window_clear(W);
+
+        if (!result)
+        {
+            flint_printf("FAIL (dependent rows):\n");
+            fmpz_mat_print_pretty(mat2);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+    }
+
+    /* large blocks, which use the Gaussian heuristic when pruning */
+    for (i = 0; i < 1 + flint_test_multiplier() / 5; i++)
+    {
+        slong r = 30 + n_randint(state, 6);
+
+        fmpz_lll_context_init_default(fl);
+        fmpz_lll_bkz_param_init(param, r);
+        param->flags = FMPZ_LLL_BKZ_PRUNE | n_randint(state, 4);
+
+        fmpz_mat_init(mat, r, r);
+        fmpz_mat_randajtai(mat, state, 0.5 + n_randint(state, 30) / 100.0);
+        fmpz_mat_init_set(mat2, mat);
+        fmpz_mat_init_set(lll, mat);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+
+        fmpz_lll_bkz(mat, U, param, fl);
+        fmpz_mat_mul(mat2, U, mat2);
+        fmpz_lll_wrapper(lll, NULL, fl);
+        _fmpz_vec_dot(n1, mat->rows[0], mat->rows[0], r);
+        _fmpz_vec_dot(n2, lll->rows[0], lll->rows[0], r);
+
+        result = fmpz_mat_equal(mat, mat2)
+              && fmpz_mat_is_reduced(mat, fl->delta, fl->eta)
+              && fmpz_cmp(n1, n2) <= 0;
+        if (!result)
+        {
+            flint_printf("FAIL (large blocks):\n");
+            fmpz_mat_print_pretty(mat);
+            flint_printf("block_size = %wd, flags = %d\n",
+                         param->block_size, param->flags);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(lll);
+        fmpz_mat_clear(U);
+    }
+
+    /* entries too large for doubles, so that mpf is used */
+    for (i = 0; i < 2 * flint_test_multiplier(); i++)
+    {
+        slong r = n_randint(state, 15) + 2;
+
+        fmpz_lll_context_init_default(fl);
+        fmpz_lll_bkz_param_init(param, n_randint(state, 10) + 2);
+        param->flags = n_randint(state, 4);
+
+        fmpz_mat_init(mat, r, r + 1);
+        fmpz_mat_randintrel(mat, state, n_randint(state, 100) + 1);
+        fmpz_mat_scalar_mul_2exp(mat, mat, 600 + n_randint(state, 200));
+        fmpz_mat_init_set(mat2, mat);
+        fmpz_mat_init_set(lll, mat);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+
+        fmpz_lll_bkz(mat, U, param, fl);
+        fmpz_mat_mul(mat2, U, mat2);
+        fmpz_lll_wrapper(lll, NULL, fl);
+        _fmpz_vec_dot(n1, mat->rows[0], mat->rows[0], r + 1);
+        _fmpz_vec_dot(n2, lll->rows[0], lll->rows[0], r + 1);
+
+        result = fmpz_mat_equal(mat, mat2)
+              && fmpz_mat_is_reduced(mat, fl->delta, fl->eta)
+              && fmpz_cmp(n1, n2) <= 0;
+        if (!result)
+        {
+            flint_printf("FAIL (mpf):\n");
+            fmpz_mat_print_pretty(mat);
+            flint_printf("block_size = %wd, flags = %d\n",
+                         param->block_size, param->flags);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(lll);
+        fmpz_mat_clear(U);
+    }
+
+    /*
+        with a single block, b_0 is a shortest vector up to the factor
+        delta, which is checked by exact enumeration
+    */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        slong r = n_randint(state, 10) + 2;
+        fmpq_t R;
+
+        fmpz_lll_context_init_default(fl);
+        fmpz_lll_bkz_param_init(param, r);
+        param->flags = 0;
+
+        fmpz_mat_init(mat, r, r);
+        fmpz_mat_randajtai(mat, state, 0.5 + n_randint(state, 100) / 100.0);
+
+        fmpz_lll_bkz(mat, NULL, param, fl);
+
+        fmpq_init(R);
+        _fmpz_vec_dot(fmpq_numref(R), mat->rows[0], mat->rows[0], r);
+        fmpz_mul_ui(fmpq_numref(R), fmpq_numref(R), 99);
+        fmpz_set_ui(fmpq_denref(R), 100);
+        fmpq_canonicalise(R);
+
+        if (has_shorter(mat, R))
+        {
+            flint_printf("FAIL (shortest vector):\n");
+            fmpz_mat_print_pretty(mat);
+            abort();
+        }
+
+        fmpq_clear(R);
+
+        fmpz_mat_clear(mat);
+    }
+
+    fmpz_clear(n1);
+    fmpz_clear(n2);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
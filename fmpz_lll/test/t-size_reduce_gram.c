@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("size_reduce_gram....");
+    fflush(stdout);
+
+    /* Compare with the Gram matrix of the reduced basis */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t B, G, H;
+        fmpz * x;
+        slong j, k, d, n, zeros, kappa;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        d = n_randint(state, 2) ? n_randint(state, 10) + 2
+                                : n_randint(state, 300) + 2;
+        n = n_randint(state, 20) + 1;
+        kappa = n_randint(state, d);
+        zeros = (slong) n_randint(state, kappa + 1) - 1;
+
+        fmpz_mat_init(B, d, n);
+        fmpz_mat_init(G, d, d);
+        fmpz_mat_init(H, d, d);
+        x = _fmpz_vec_init(d);
+
+        fmpz_mat_randtest(B, state, n_randint(state, 200) + 1);
+        fmpz_mat_gram(G, B);
+
+        for (j = zeros + 1; j < kappa; j++)
+        {
+            if (n_randint(state, 3))
+                fmpz_randtest(x + j, state, n_randint(state, 100) + 1);
+
+            for (k = 0; k < n; k++)
+                fmpz_submul(fmpz_mat_entry(B, kappa, k), x + j,
+                            fmpz_mat_entry(B, j, k));
+        }
+
+        fmpz_mat_gram(H, B);
+        fmpz_set(fmpz_mat_entry(G, kappa, kappa),
+                 fmpz_mat_entry(H, kappa, kappa));
+
+        fmpz_lll_size_reduce_gram(G, x, zeros, kappa);
+
+        result = 1;
+        for (j = zeros + 1; j < d; j++)
+        {
+            if (j < kappa)
+                result &= fmpz_equal(fmpz_mat_entry(G, kappa, j),
+                                     fmpz_mat_entry(H, kappa, j));
+            else
+                result &= fmpz_equal(fmpz_mat_entry(G, j, kappa),
+                                     fmpz_mat_entry(H, j, kappa));
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("d = %wd, zeros = %wd, kappa = %wd\n",
+                         d, zeros, kappa);
+            abort();
+        }
+
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(G);
+        fmpz_mat_clear(H);
+        _fmpz_vec_clear(x, d);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("size_reduce_row....");
+    fflush(stdout);
+
+    /* Compare with repeated scalar_submul_si */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz *a, *b, **v;
+        slong * x;
+        slong j, len, num;
+        mp_bitcnt_t bits;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        len = n_randint(state, 300);
+        num = n_randint(state, 100);
+        bits = n_randint(state, 2) ? FLINT_BITS - 2 : 300;
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        v = flint_malloc(num * sizeof(fmpz *));
+        x = flint_malloc(num * sizeof(slong));
+
+        _fmpz_vec_randtest(a, state, len, bits);
+        _fmpz_vec_set(b, a, len);
+
+        for (j = 0; j < num; j++)
+        {
+            v[j] = _fmpz_vec_init(len);
+            _fmpz_vec_randtest(v[j], state, len, bits);
+            x[j] = z_randtest(state);
+        }
+
+        fmpz_lll_size_reduce_row(a, v, x, num, len, bits);
+
+        for (j = 0; j < num; j++)
+            _fmpz_vec_scalar_submul_si(b, v[j], len, x[j]);
+
+        result = (_fmpz_vec_equal(a, b, len));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("num = %wd, len = %wd\n", num, len);
+            _fmpz_vec_print(a, len), flint_printf("\n\n");
+            _fmpz_vec_print(b, len), flint_printf("\n\n");
+            abort();
+        }
+
+        for (j = 0; j < num; j++)
+            _fmpz_vec_clear(v[j], len);
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        flint_free(v);
+        flint_free(x);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -401,6 +402,58 @@ main(void)
         fmpz_mat_clear(mat);
     }
 
+    /*
+        test the recursive fallback: fmpz_lll_d fails on unimodular upper
+        triangular matrices whose rows grow rapidly towards the top, and
+        with at least FMPZ_LLL_RECURSIVE_CUTOFF rows the halves are then
+        reduced first
+    */
+    for (i = 0; i < 1 + flint_test_multiplier() / 5; i++)
+    {
+        slong r, j, k;
+
+        r = FMPZ_LLL_RECURSIVE_CUTOFF + n_randint(state, 8);
+
+        fmpz_mat_init(mat, r, r);
+        fmpz_mat_init(mat2, r, r);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+        fmpz_lll_context_init_default(fl);
+
+        for (j = 0; j < r; j++)
+        {
+            fmpz_one(fmpz_mat_entry(mat, j, j));
+            for (k = j + 1; k < r; k++)
+                fmpz_randtest(fmpz_mat_entry(mat, j, k), state, 2 * (r - j));
+        }
+
+        fmpz_mat_set(mat2, mat);
+        fmpz_lll_wrapper(mat, U, fl);
+        fmpz_mat_mul(mat2, U, mat2);
+
+        result = fmpz_mat_equal(mat, mat2);
+        if (!result)
+        {
+            flint_printf("FAIL (recursive): basis matrices not equal!\n");
+            fmpz_mat_print_pretty(mat);
+            fmpz_mat_print_pretty(mat2);
+            abort();
+        }
+
+        result = fmpz_mat_is_reduced(mat, fl->delta, fl->eta);
+        if (!result)
+        {
+            flint_printf("FAIL (recursive):\n");
+            fmpz_mat_print_pretty(mat);
+            flint_printf("r = %wd, i = %wd\n", r, (slong) i);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(U);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,12 +14,70 @@
 
 #include "fmpz_lll.h"
 
+/*
+    Reduces the sublattices spanned by the first and the last half of the
+    rows of B independently, each on a copy with its own (small) capturing
+    matrix, and lifts the transformations to U with a matrix product.
+    Being half the dimension, the blocks usually need only doubles, and
+    a second attempt in doubles on the whole of B then starts from vectors
+    that are already short and nearly orthogonal within each half.
+*/
+static void
+_fmpz_lll_reduce_halves(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+{
+    fmpz_mat_t Bh, Uh, W, T;
+    slong h, r0, r1, d = B->r;
+
+    for (h = 0; h < 2; h++)
+    {
+        r0 = (h == 0) ? 0 : d / 2;
+        r1 = (h == 0) ? d / 2 : d;
+
+        fmpz_mat_window_init(W, B, r0, 0, r1, B->c);
+        fmpz_mat_init_set(Bh, W);
+        fmpz_mat_init(Uh, r1 - r0, r1 - r0);
+        fmpz_mat_one(Uh);
+
+        fmpz_lll_wrapper(Bh, Uh, fl);
+
+        fmpz_mat_set(W, Bh);
+        fmpz_mat_window_clear(W);
+
+        if (U != NULL)
+        {
+            fmpz_mat_window_init(W, U, r0, 0, r1, U->c);
+            fmpz_mat_init(T, r1 - r0, U->c);
+            fmpz_mat_mul(T, Uh, W);
+            fmpz_mat_set(W, T);
+            fmpz_mat_clear(T);
+            fmpz_mat_window_clear(W);
+        }
+
+        fmpz_mat_clear(Bh);
+        fmpz_mat_clear(Uh);
+    }
+}
+
 int
 fmpz_lll_wrapper(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
 {
-    int res = fmpz_lll_d(B, U, fl);
+    int res, reduced;
+
+    res = fmpz_lll_d(B, U, fl);
+    reduced = (res != -1) && fmpz_lll_is_reduced(B, fl, D_BITS);
+
+    /*
+        Every stage works in place, so whatever reduction a failed stage
+        managed to do is kept by the next one rather than redone.
+    */
+    if (!reduced && fl->rt == Z_BASIS && B->r >= FMPZ_LLL_RECURSIVE_CUTOFF)
+    {
+        _fmpz_lll_reduce_halves(B, U, fl);
+        res = fmpz_lll_d(B, U, fl);
+        reduced = (res != -1) && fmpz_lll_is_reduced(B, fl, D_BITS);
+    }
 
-    if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
+    if (!reduced)
     {
         if (fl->rt == Z_BASIS && fl->gt == APPROX)
         {
@@ -323,9 +323,15 @@ FLINT_DLL void fmpz_mat_det_modular(fmpz_t det, const fmpz_mat_t A, int proved);
 FLINT_DLL void fmpz_mat_det_modular_accelerated(fmpz_t det,
     const fmpz_mat_t A, int proved);
 
+FLINT_DLL void _fmpz_mat_det_modular_given_divisor(fmpz_t det,
+    const fmpz_mat_t A, const fmpz_t d, mp_bitcnt_t stable_bits);
+
 FLINT_DLL void fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
         const fmpz_t d, int proved);
 
+FLINT_DLL void fmpz_mat_det_modular_stable(fmpz_t det, const fmpz_mat_t A,
+        const fmpz_t d, slong k);
+
 FLINT_DLL void fmpz_mat_det_bound(fmpz_t bound, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A);
 
@@ -461,6 +467,8 @@ FLINT_DLL void fmpz_mat_snf_diagonal(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A,
         const fmpz_t mod);
+FLINT_DLL void fmpz_mat_snf_local(fmpz_mat_t S, const fmpz_mat_t A,
+        const fmpz_t mod);
 FLINT_DLL int fmpz_mat_is_in_snf(const fmpz_mat_t A);
 
 /* Special matrices **********************************************************/
@@ -88,6 +88,27 @@ void _fmpz_mat_charpoly_small(fmpz * rop, const fmpz_mat_t op)
     }
 }
 
+static slong
+_fmpz_mat_charpoly_image(mp_ptr c, mp_limb_t p, void * arg)
+{
+    const fmpz_mat_struct * op = (const fmpz_mat_struct *) arg;
+    nmod_mat_t mat;
+    nmod_poly_t poly;
+
+    nmod_mat_init(mat, op->r, op->r, p);
+    nmod_poly_init(poly, p);
+
+    fmpz_mat_get_nmod_mat(mat, op);
+    nmod_mat_charpoly(poly, mat);
+
+    _nmod_vec_set(c, poly->coeffs, op->r + 1);
+
+    nmod_mat_clear(mat);
+    nmod_poly_clear(poly);
+
+    return 1;
+}
+
 void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -110,9 +131,6 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong bound;
 
         slong pbits  = FLINT_BITS - 1;
-        mp_limb_t p = (UWORD(1) << pbits);
-
-        fmpz_t m;
 
         /* Determine the bound in bits */
         {
@@ -140,30 +158,10 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
             bound = ceil( (n / 2.0) * (_log2(n) + 2.0 * t + 1.6669) );
         }
 
-        fmpz_init_set_ui(m, 1);
-
-        for ( ; fmpz_bits(m) < bound; )
-        {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
-
-            p = n_nextprime(p, 0);
-
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
-
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_charpoly(poly, mat);
-
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, n + 1, poly->mod.n, poly->mod.ninv, 1);
-
-            fmpz_mul_ui(m, m, p);
-
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
-        }
-
-        fmpz_clear(m);
+        /* the charpolys modulo the different primes are computed in
+           parallel */
+        _fmpz_vec_multi_mod_CRT_threaded(rop, n + 1,
+            _fmpz_mat_charpoly_image, (void *) op, pbits, bound, 0);
     }
 }
 
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -10,13 +11,14 @@
 */
 
 #include "fmpz_mat.h"
-#include "fmpq.h"
+#include "fmpq_mat.h"
 
 void
 fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A)
 {
     fmpz_mat_t X, B;
-    fmpz_t t, u, v, mod;
+    fmpq_mat_t Xq;
+    fmpz_t mod;
     slong i, n;
     int success;
 
@@ -24,9 +26,6 @@ fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A)
 
     fmpz_mat_init(B, n, 1);
     fmpz_mat_init(X, n, 1);
-    fmpz_init(t);
-    fmpz_init(u);
-    fmpz_init(v);
     fmpz_init(mod);
 
     /* Create a "random" vector */
@@ -39,20 +38,25 @@ fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A)
 
     if (success)
     {
+        /*
+            The modulus may come from an early exit of the lifting, which
+            only guarantees that the reconstruction done by
+            fmpq_mat_set_fmpz_mat_mod_fmpz succeeds, so use exactly that.
+        */
+        fmpq_mat_init(Xq, n, 1);
+
+        if (!fmpq_mat_set_fmpz_mat_mod_fmpz(Xq, X, mod))
+        {
+            flint_printf("Exception (fmpz_mat_det_divisor): "
+                   "Rational reconstruction failed.\n");
+            flint_abort();
+        }
+
         fmpz_one(d);
         for (i = 0; i < n; i++)
-        {
-            fmpz_mul(t, d, fmpz_mat_entry(X, i, 0));
-            fmpz_fdiv_qr(u, t, t, mod);
-            if (!_fmpq_reconstruct_fmpz(u, v, t, mod))
-            {
-                flint_printf("Exception (fmpz_mat_det_divisor): "
-                       "Rational reconstruction failed.\n");
-                flint_abort();
-            }
+            fmpz_lcm(d, d, fmpq_mat_entry_den(Xq, i, 0));
 
-            fmpz_mul(d, v, d);
-        }
+        fmpq_mat_clear(Xq);
     }
     else
     {
@@ -61,8 +65,5 @@ fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A)
 
     fmpz_mat_clear(B);
     fmpz_mat_clear(X);
-    fmpz_clear(t);
-    fmpz_clear(u);
-    fmpz_clear(v);
     fmpz_clear(mod);
 }
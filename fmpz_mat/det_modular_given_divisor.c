@@ -15,28 +15,44 @@
 #define DEBUG_USE_SMALL_PRIMES 0
 
 
-static mp_limb_t
-next_good_prime(const fmpz_t d, mp_limb_t p)
+typedef struct
 {
-    mp_limb_t r = 0;
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+}
+det_given_divisor_arg_t;
 
-    while (r == 0)
-    {
-        p = n_nextprime(p, 0);
-        r = fmpz_fdiv_ui(d, p);
-    }
+static slong
+_fmpz_mat_det_divisor_image(mp_ptr x, mp_limb_t p, void * arg_ptr)
+{
+    det_given_divisor_arg_t * arg = (det_given_divisor_arg_t *) arg_ptr;
+    mp_limb_t dmod;
+    nmod_mat_t Amod;
 
-    return p;
-}
+    dmod = fmpz_fdiv_ui(arg->d, p);
+    if (dmod == 0)
+        return 0;
+
+    nmod_mat_init(Amod, arg->A->r, arg->A->c, p);
+    fmpz_mat_get_nmod_mat(Amod, arg->A);
 
+    /* Compute x = det(A) / d mod p */
+    x[0] = _nmod_mat_det(Amod);
+    x[0] = n_mulmod2_preinv(x[0], n_invmod(dmod, p),
+                            Amod->mod.n, Amod->mod.ninv);
+
+    nmod_mat_clear(Amod);
+
+    return 1;
+}
 
 void
-fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
-    const fmpz_t d, int proved)
+_fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
+    const fmpz_t d, mp_bitcnt_t stable_bits)
 {
-    fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
+    fmpz_t bound, x;
+    det_given_divisor_arg_t arg;
+    mp_bitcnt_t pbits;
     slong n = A->r;
 
     if (n == 0)
@@ -52,62 +68,38 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     }
 
     fmpz_init(bound);
-    fmpz_init(prod);
-    fmpz_init(stable_prod);
     fmpz_init(x);
-    fmpz_init(xnew);
 
     /* Bound x = det(A) / d */
     fmpz_mat_det_bound(bound, A);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
-    fmpz_zero(x);
-    fmpz_one(prod);
-
 #if DEBUG_USE_SMALL_PRIMES
-    p = UWORD(1);
+    pbits = 0;
 #else
-    p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+    pbits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
 #endif
 
-    /* Compute x = det(A) / d */
-    while (fmpz_cmp(prod, bound) <= 0)
-    {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
-
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
-
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
-
-        if (fmpz_equal(xnew, x))
-        {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
-            if (!proved && fmpz_bits(stable_prod) > 100)
-                break;
-        }
-        else
-        {
-            fmpz_set_ui(stable_prod, p);
-        }
-
-        fmpz_mul_ui(prod, prod, p);
-        fmpz_set(x, xnew);
-    }
+    /* Compute x = det(A) / d, the primes being shared between the threads;
+       if stable_bits is nonzero we stop once x has been stable for that
+       many bits */
+    arg.A = A;
+    arg.d = d;
+
+    _fmpz_vec_multi_mod_CRT_threaded(x, 1, _fmpz_mat_det_divisor_image, &arg,
+                                     pbits, fmpz_bits(bound), stable_bits);
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
     fmpz_clear(bound);
-    fmpz_clear(prod);
-    fmpz_clear(stable_prod);
     fmpz_clear(x);
-    fmpz_clear(xnew);
+}
+
+void
+fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
+    const fmpz_t d, int proved)
+{
+    _fmpz_mat_det_modular_given_divisor(det, A, d, proved ? 0 : 100);
 }
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+
+void
+fmpz_mat_det_modular_stable(fmpz_t det, const fmpz_mat_t A,
+                                                const fmpz_t d, slong k)
+{
+    /* the primes have NMOD_MAT_OPTIMAL_MODULUS_BITS + 1 bits, and the
+       one that last changed the value is counted as well */
+    _fmpz_mat_det_modular_given_divisor(det, A, d,
+        (k <= 0) ? 0 : k * (NMOD_MAT_OPTIMAL_MODULUS_BITS + 1));
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,42 +10,127 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
+/* lower triangle of rows start, start + step, ... of B = A A^T */
+static void
+_fmpz_mat_gram_rows(fmpz_mat_t B, const fmpz_mat_t A, slong start, slong step)
+{
+    slong i, j;
+
+    for (i = start; i < A->r; i += step)
+        for (j = 0; j <= i; j++)
+            _fmpz_vec_dot(fmpz_mat_entry(B, i, j), A->rows[i], A->rows[j],
+                                                                      A->c);
+}
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+typedef struct
+{
+    fmpz_mat_struct * B;
+    const fmpz_mat_struct * A;
+    slong start;
+    slong step;
+}
+gram_arg_t;
+
+static void *
+_fmpz_mat_gram_worker(void * arg_ptr)
+{
+    gram_arg_t arg = *((gram_arg_t *) arg_ptr);
+
+    _fmpz_mat_gram_rows(arg.B, arg.A, arg.start, arg.step);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
 void fmpz_mat_gram(fmpz_mat_t B, const fmpz_mat_t A)
 {
-	slong i, j, k;
-	
-	if(B->r != A->r || B->c != A->r) {
-		flint_printf("Exception (fmpz_mat_gram). Incompatible dimensions.\n");
-		flint_abort();
-	}
-	
-	if(B == A) {
-		fmpz_mat_t t;
-		fmpz_mat_init(t, B->r, B->c);
-		fmpz_mat_gram(t, A);
-		fmpz_mat_swap(B, t);
-		fmpz_mat_clear(t);
-		return;
-	}
-	
-	if(A->c == 0) {
-		fmpz_mat_zero(B);
-		return;
-	}
-	
-	for(i = 0; i < B->r; i++) {
-		for(j = 0; j < B->c; j++) {
-			fmpz_mul(fmpz_mat_entry(B, i, j),
-					 fmpz_mat_entry(A, i, 0),
-					 fmpz_mat_entry(A, j, 0));
-					 
-			for (k = 1; k < A->c; k++) {
-                fmpz_addmul(fmpz_mat_entry(B, i, j),
-                            fmpz_mat_entry(A, i, k),
-                            fmpz_mat_entry(A, j, k));
-            }
-		}
-	}
+    slong i, j, r, num_threads;
+
+    if (B->r != A->r || B->c != A->r)
+    {
+        flint_printf("Exception (fmpz_mat_gram). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (B == A)
+    {
+        fmpz_mat_t t;
+        fmpz_mat_init(t, B->r, B->c);
+        fmpz_mat_gram(t, A);
+        fmpz_mat_swap(B, t);
+        fmpz_mat_clear(t);
+        return;
+    }
+
+    if (A->c == 0)
+    {
+        fmpz_mat_zero(B);
+        return;
+    }
+
+    r = A->r;
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    /*
+        Row i needs i + 1 dot products, so rows are dealt out cyclically
+        to balance the work between the threads. Each thread gets at least
+        2^16 word sized multiply-adds, so that starting it takes about 5
+        percent of the time.
+    */
+    {
+        slong bits = FLINT_ABS(fmpz_mat_max_bits(A));
+
+        num_threads = FLINT_MIN(flint_get_num_threads(), r);
+        num_threads = FLINT_MIN(num_threads, ((r * (r + 1) / 2) * A->c
+                                  * (1 + bits / FLINT_BITS)) >> 16);
+    }
+#else
+    num_threads = 1;
+#endif
+
+    if (num_threads <= 1)
+    {
+        _fmpz_mat_gram_rows(B, A, 0, 1);
+    }
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    else
+    {
+        pthread_t * threads;
+        gram_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(gram_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].B = B;
+            args[i].A = A;
+            args[i].start = i;
+            args[i].step = num_threads;
+
+            pthread_create(&threads[i], NULL,
+                           _fmpz_mat_gram_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+#endif
+
+    for (i = 0; i < r; i++)
+        for (j = 0; j < i; j++)
+            fmpz_set(fmpz_mat_entry(B, j, i), fmpz_mat_entry(B, i, j));
 }
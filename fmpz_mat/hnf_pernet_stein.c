@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014, 2015 Alex J. Best
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpz_mat.h"
 #include "fmpq_mat.h"
 #include "perm.h"
@@ -148,12 +150,96 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpz_mat_clear(Bu);
 }
 
+typedef struct
+{
+    fmpz_mat_struct * H;
+    slong i;
+    slong piv;
+    slong i0;
+    slong i1;
+}
+reduce_arg_t;
+
+/* reduces the entries of rows i0, ..., i1 - 1 in column piv modulo H[i, piv] */
+static void
+_reduce_rows_range(fmpz_mat_t H, slong i, slong piv, slong i0, slong i1)
+{
+    slong i2, j2;
+    fmpz_t q;
+
+    fmpz_init(q);
+
+    for (i2 = i0; i2 < i1; i2++)
+    {
+        fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, piv), fmpz_mat_entry(H, i, piv));
+        if (fmpz_is_zero(q))
+            continue;
+        for (j2 = piv; j2 < H->c; j2++)
+            fmpz_submul(fmpz_mat_entry(H, i2, j2), q, fmpz_mat_entry(H, i, j2));
+    }
+
+    fmpz_clear(q);
+}
+
+static void *
+_reduce_rows_worker(void * arg_ptr)
+{
+    reduce_arg_t arg = *((reduce_arg_t *) arg_ptr);
+
+    _reduce_rows_range(arg.H, arg.i, arg.piv, arg.i0, arg.i1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Reduces the entries above the pivot H[i, piv]. The rows above are
+    independent of each other, so they are shared between the threads.
+*/
+static void
+reduce_above_pivot(fmpz_mat_t H, slong i, slong piv)
+{
+    slong k, bits, num_threads;
+    pthread_t * threads;
+    reduce_arg_t * args;
+
+    bits = FLINT_ABS(_fmpz_vec_max_bits(H->rows[i] + piv, H->c - piv));
+    num_threads = FLINT_MIN(flint_get_num_threads(), i);
+
+    if (num_threads <= 1 || i * (H->c - piv) * (1 + bits / FLINT_BITS)
+                                                            < WORD(1) << 16)
+    {
+        _reduce_rows_range(H, i, piv, 0, i);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(reduce_arg_t) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        args[k].H = H;
+        args[k].i = i;
+        args[k].piv = piv;
+        args[k].i0 = (i * k) / num_threads;
+        args[k].i1 = (i * (k + 1)) / num_threads;
+
+        pthread_create(&threads[k], NULL, _reduce_rows_worker, &args[k]);
+    }
+
+    for (k = 0; k < num_threads; k++)
+        pthread_join(threads[k], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 /* takes input matrix H with rows 0 to start_row - 1 in HNF to a HNF matrix */
 static void
 add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
 {
-    slong i, i2, j, j2, new_row, row;
-    fmpz_t b, d, u, v, r1d, r2d, q;
+    slong i, j, j2, new_row, row;
+    fmpz_t b, d, u, v, r1d, r2d;
 
     fmpz_init(b);
     fmpz_init(d);
@@ -161,7 +247,6 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_init(v);
     fmpz_init(r1d);
     fmpz_init(r2d);
-    fmpz_init(q);
 
     for (row = start_row; row < H->r; row++)
     {
@@ -230,21 +315,9 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
 
         /* reduce above pivot entries */
         for (i = 0; i < num_pivots; i++)
-        {
-            for (i2 = 0; i2 < i; i2++)
-            {
-                fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, pivots[i]),
-                        fmpz_mat_entry(H, i, pivots[i]));
-                for (j2 = pivots[i]; j2 < H->c; j2++)
-                {
-                    fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
-                            fmpz_mat_entry(H, i, j2));
-                }
-            }
-        }
+            reduce_above_pivot(H, i, pivots[i]);
     }
 
-    fmpz_clear(q);
     fmpz_clear(r2d);
     fmpz_clear(r1d);
     fmpz_clear(v);
@@ -253,18 +326,72 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_clear(b);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    const fmpz * u1;
+    const fmpz * u2;
+}
+double_det_arg_t;
+
+/*
+    Sets x[0] and x[1] to the determinants of the matrices with rows B, c
+    and B, d modulo p, divided by u1 and u2 respectively.
+*/
+static slong
+double_det_image(mp_ptr x, mp_limb_t p, void * arg_ptr)
+{
+    double_det_arg_t * arg = (double_det_arg_t *) arg_ptr;
+    slong i, j, n = arg->B->c;
+    mp_limb_t u1mod, u2mod;
+    nmod_mat_t Bmod;
+
+    u1mod = fmpz_fdiv_ui(arg->u1, p);
+    u2mod = fmpz_fdiv_ui(arg->u2, p);
+    if (u1mod == 0 || u2mod == 0)
+        return 0;
+
+    nmod_mat_init(Bmod, n, n, p);
+
+    for (i = 0; i < n - 1; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(Bmod, i, j) =
+                fmpz_fdiv_ui(fmpz_mat_entry(arg->B, i, j), p);
+    for (j = 0; j < n; j++)
+        nmod_mat_entry(Bmod, n - 1, j) =
+            fmpz_fdiv_ui(fmpz_mat_entry(arg->c, 0, j), p);
+    x[0] = _nmod_mat_det(Bmod);
+
+    for (i = 0; i < n - 1; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(Bmod, i, j) =
+                fmpz_fdiv_ui(fmpz_mat_entry(arg->B, i, j), p);
+    for (j = 0; j < n; j++)
+        nmod_mat_entry(Bmod, n - 1, j) =
+            fmpz_fdiv_ui(fmpz_mat_entry(arg->d, 0, j), p);
+    x[1] = _nmod_mat_det(Bmod);
+
+    x[0] = n_mulmod2_preinv(x[0], n_invmod(u1mod, p), p, Bmod->mod.ninv);
+    x[1] = n_mulmod2_preinv(x[1], n_invmod(u2mod, p), p, Bmod->mod.ninv);
+
+    nmod_mat_clear(Bmod);
+
+    return 1;
+}
+
 static void
 double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         const fmpz_mat_t d)
 {
     slong i, j, n;
-    slong *P;
-    mp_limb_t p, u1mod, u2mod, v1mod, v2mod;
-    fmpz_t bound, prod, s1, s2, t, u1, u2, v1, v2;
+    fmpz_t bound, s1, s2, t, u1, u2;
+    fmpz * v;
     fmpz_mat_t dt, Bt;
     fmpq_t tmpq;
     fmpq_mat_t x;
-    nmod_mat_t Btmod;
+    double_det_arg_t arg;
 
     n = B->c;
 
@@ -286,14 +413,12 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
     if (!fmpq_is_zero(fmpq_mat_entry(x, n - 1, 0)))
     {
         fmpz_init(bound);
-        fmpz_init(prod);
         fmpz_init(t);
         fmpz_init(s1);
         fmpz_init(s2);
         fmpz_init(u1);
         fmpz_init(u2);
-        fmpz_init(v1);
-        fmpz_init(v2);
+        v = _fmpz_vec_init(2);
 
         /* compute lcm of denominators of vectors x and y */
         fmpq_init(tmpq);
@@ -347,74 +472,27 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
             fmpz_set(bound, s2);
         fmpz_mul_ui(bound, bound, UWORD(2));
 
-        fmpz_one(prod);
-        P = _perm_init(n);
-        nmod_mat_init(Btmod, n, n, 2);
-        p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
-        /* compute determinants divided by u1 and u2 */
-        while (fmpz_cmp(prod, bound) <= 0)
-        {
-            p = n_nextprime(p, 0);
-            u1mod = fmpz_fdiv_ui(u1, p);
-            u2mod = fmpz_fdiv_ui(u2, p);
-            if (!(u1mod || u2mod))
-                continue;
-            _nmod_mat_set_mod(Btmod, p);
-            for (i = 0; i < n; i++)
-            {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
-            }
-            nmod_mat_lu(P, Btmod, 0);
-            v1mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v1mod = nmod_neg(v1mod, Btmod->mod);
+        /* compute determinants divided by u1 and u2, the primes being
+           shared between the threads */
+        arg.B = B;
+        arg.c = c;
+        arg.d = d;
+        arg.u1 = u1;
+        arg.u2 = u2;
 
-            for (i = 0; i < n; i++)
-            {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
-            }
-            nmod_mat_lu(P, Btmod, 0);
-            v2mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v2mod = nmod_neg(v2mod, Btmod->mod);
-
-            v1mod = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
-                    Btmod->mod.ninv);
-            v2mod = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
-                    Btmod->mod.ninv);
-            fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
-            fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
-            fmpz_mul_ui(prod, prod, p);
-        }
+        _fmpz_vec_multi_mod_CRT_threaded(v, 2, double_det_image, &arg,
+                NMOD_MAT_OPTIMAL_MODULUS_BITS, fmpz_bits(bound), 0);
 
-        fmpz_mul(d1, u1, v1);
-        fmpz_mul(d2, u2, v2);
+        fmpz_mul(d1, u1, v + 0);
+        fmpz_mul(d2, u2, v + 1);
 
         fmpz_clear(bound);
-        fmpz_clear(prod);
         fmpz_clear(s1);
         fmpz_clear(s2);
         fmpz_clear(u1);
         fmpz_clear(u2);
-        fmpz_clear(v1);
-        fmpz_clear(v2);
         fmpz_clear(t);
-        _perm_clear(P);
-        nmod_mat_clear(Btmod);
+        _fmpz_vec_clear(v, 2);
     }
     else                        /* can't use the clever method above so naively compute both dets */
     {
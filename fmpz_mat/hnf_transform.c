@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 Alex J. Best
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -10,6 +11,92 @@
 */
 
 #include "fmpz_mat.h"
+#include "fmpq_mat.h"
+
+/*
+    If A has full row rank the transformation is unique: with P the pivot
+    columns of H, the square submatrix A_P is nonsingular and U A_P = H_P,
+    so U can be recovered from H by a single rational solve. Returns 0
+    without touching H and U if A is found to be rank deficient.
+*/
+static int
+_fmpz_mat_hnf_transform_full_rank(fmpz_mat_t H, fmpz_mat_t U,
+                                                        const fmpz_mat_t A)
+{
+    slong i, j, m, n, r, * pivots, * P;
+    fmpz_mat_t H2, AT, HT;
+    fmpq_mat_t X;
+    nmod_mat_t Amod;
+    int success;
+
+    m = fmpz_mat_nrows(A);
+    n = fmpz_mat_ncols(A);
+
+    if (m == 0 || m > n)
+        return 0;
+
+    /* cheap rank check modulo a prime, the rank can only drop mod p */
+    pivots = flint_malloc(sizeof(slong) * n);
+    P = flint_malloc(sizeof(slong) * m);
+    nmod_mat_init(Amod, m, n,
+                  n_nextprime(UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS, 0));
+    fmpz_mat_get_nmod_mat(Amod, A);
+    for (i = 0; i < m; i++)
+        P[i] = i;
+    r = _nmod_mat_rref(Amod, pivots, P);
+    nmod_mat_clear(Amod);
+    flint_free(P);
+
+    if (r < m)
+    {
+        flint_free(pivots);
+        return 0;
+    }
+
+    fmpz_mat_init(H2, m, n);
+    fmpz_mat_hnf(H2, A);
+
+    for (i = j = 0; i < m; i++, j++)
+    {
+        for ( ; fmpz_is_zero(fmpz_mat_entry(H2, i, j)); j++) ;
+        pivots[i] = j;
+    }
+
+    /* solve A_P^T U^T = H_P^T */
+    fmpz_mat_init(AT, m, m);
+    fmpz_mat_init(HT, m, m);
+    fmpq_mat_init(X, m, m);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            fmpz_set(fmpz_mat_entry(AT, j, i),
+                     fmpz_mat_entry(A, i, pivots[j]));
+            fmpz_set(fmpz_mat_entry(HT, j, i),
+                     fmpz_mat_entry(H2, i, pivots[j]));
+        }
+    }
+
+    success = fmpq_mat_solve_fmpz_mat(X, AT, HT);
+
+    if (success)
+    {
+        for (i = 0; i < m; i++)
+            for (j = 0; j < m; j++)
+                fmpz_set(fmpz_mat_entry(U, i, j), fmpq_mat_entry_num(X, j, i));
+
+        fmpz_mat_set(H, H2);
+    }
+
+    fmpz_mat_clear(H2);
+    fmpz_mat_clear(AT);
+    fmpz_mat_clear(HT);
+    fmpq_mat_clear(X);
+    flint_free(pivots);
+
+    return success;
+}
 
 void
 fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
@@ -17,6 +104,9 @@ fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
     slong i, j, m, n;
     fmpz_mat_t A2, H2;
 
+    if (_fmpz_mat_hnf_transform_full_rank(H, U, A))
+        return;
+
     m = fmpz_mat_nrows(A);
     n = fmpz_mat_ncols(A);
 
@@ -10,7 +10,9 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
 void _fmpz_mat_resize_van_hoeij(fmpz_mat_t M, slong r, slong c)
@@ -72,12 +74,51 @@ void _fmpz_mat_resize_van_hoeij(fmpz_mat_t M, slong r, slong c)
    M->c = c;
 }
 
+/* rows j0, ..., j1 - 1 of y = (U x / 2^U_exp) smod P_trunc */
+static void
+_fmpz_mat_next_col_rows(fmpz_mat_t y, const fmpz_mat_t U, const fmpz_mat_t x,
+                 slong U_exp, const fmpz_t P_trunc, slong j0, slong j1)
+{
+   slong j;
+
+   for (j = j0; j < j1; j++)
+   {
+      _fmpz_vec_dot(y->rows[j], U->rows[j], x->entries, x->r);
+      fmpz_tdiv_q_2exp(y->rows[j], y->rows[j], U_exp);
+      _fmpz_vec_scalar_smod_fmpz(y->rows[j], y->rows[j], 1, P_trunc);
+   }
+}
+
+typedef struct
+{
+   fmpz_mat_struct * y;
+   const fmpz_mat_struct * U;
+   const fmpz_mat_struct * x;
+   slong U_exp;
+   const fmpz * P_trunc;
+   slong j0;
+   slong j1;
+}
+next_col_arg_t;
+
+void *
+_fmpz_mat_next_col_van_hoeij_worker(void * arg_ptr)
+{
+   next_col_arg_t arg = *((next_col_arg_t *) arg_ptr);
+
+   _fmpz_mat_next_col_rows(arg.y, arg.U, arg.x, arg.U_exp, arg.P_trunc,
+                           arg.j0, arg.j1);
+
+   flint_cleanup();
+   return NULL;
+}
+
 int fmpz_mat_next_col_van_hoeij(fmpz_mat_t M, fmpz_t P,
                                         fmpz_mat_t col, slong exp, slong U_exp)
 {
    slong j, k, r = col->r;
    slong bit_r = FLINT_MAX(r, 20);
-   slong s = M->r;
+   slong s = M->r, num_threads;
    fmpz_mat_t U, x, y;
    fmpz_t P_trunc;
 
@@ -107,12 +148,45 @@ int fmpz_mat_next_col_van_hoeij(fmpz_mat_t M, fmpz_t P,
       fmpz_mul_2exp(P_trunc, P, -k);
    }
 
-   /* multiply column by U */
-   fmpz_mat_mul(y, U, x);
+   num_threads = FLINT_MIN(flint_get_num_threads(), s);
+
+   if (num_threads <= 1 || r < 64)
+   {
+      /* multiply column by U */
+      fmpz_mat_mul(y, U, x);
+
+      /* everything in U was already scaled by U_exp, so divide out scaling */
+      fmpz_mat_scalar_tdiv_q_2exp(y, y, U_exp); 
+      fmpz_mat_scalar_smod(y, y, P_trunc);
+   } else
+   {
+      /* the rows of U x are independent dot products */
+      pthread_t * threads;
+      next_col_arg_t * args;
+
+      threads = flint_malloc(sizeof(pthread_t) * num_threads);
+      args = flint_malloc(sizeof(next_col_arg_t) * num_threads);
+
+      for (j = 0; j < num_threads; j++)
+      {
+         args[j].y = y;
+         args[j].U = U;
+         args[j].x = x;
+         args[j].U_exp = U_exp;
+         args[j].P_trunc = P_trunc;
+         args[j].j0 = (s * j) / num_threads;
+         args[j].j1 = (s * (j + 1)) / num_threads;
+
+         pthread_create(&threads[j], NULL,
+                        _fmpz_mat_next_col_van_hoeij_worker, &args[j]);
+      }
+
+      for (j = 0; j < num_threads; j++)
+         pthread_join(threads[j], NULL);
 
-   /* everything in U was already scaled by U_exp, so divide out scaling */
-   fmpz_mat_scalar_tdiv_q_2exp(y, y, U_exp); 
-   fmpz_mat_scalar_smod(y, y, P_trunc);
+      flint_free(threads);
+      flint_free(args);
+   }
 
    /* resize M */
    _fmpz_mat_resize_van_hoeij(M, s + 1, M->c + 1);
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpz_mat.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    slong dim;
+    int algorithm;
+    slong bits;
+} mat_snf_t;
+
+void sample(void * arg, ulong count)
+{
+    mat_snf_t * params = (mat_snf_t *) arg;
+    slong dim = params->dim;
+    slong bits = params->bits;
+    int algorithm = params->algorithm;
+    ulong i;
+    fmpz_mat_t A, S;
+    fmpz_t d;
+    FLINT_TEST_INIT(state);
+
+    fmpz_mat_init(A, dim, dim);
+    fmpz_mat_init(S, dim, dim);
+    fmpz_init(d);
+
+    /* random nonsingular matrix with a smooth determinant */
+    fmpz_mat_randrank(A, state, dim, bits);
+    fmpz_mat_randops(A, state, 2 * dim * dim);
+    fmpz_mat_det(d, A);
+    fmpz_abs(d, d);
+
+    prof_start();
+
+    if (algorithm == 0)
+        for (i = 0; i < count; i++)
+            fmpz_mat_snf_kannan_bachem(S, A);
+    else if (algorithm == 1)
+        for (i = 0; i < count; i++)
+            fmpz_mat_snf_iliopoulos(S, A, d);
+    else if (algorithm == 2)
+        for (i = 0; i < count; i++)
+            fmpz_mat_snf_local(S, A, d);
+
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(S);
+    fmpz_clear(d);
+
+    FLINT_TEST_CLEANUP(state);
+}
+
+int main(void)
+{
+    double min_kb, min_iliopoulos, min_local, max;
+    mat_snf_t params;
+    slong dim, bits;
+
+    for (bits = 2; bits <= 64; bits *= 2)
+    {
+        params.bits = bits;
+        flint_printf("fmpz_mat_snf (bits = %wd):\n", params.bits);
+
+        for (dim = 2; dim <= 200; dim = (slong) ((double) dim * 1.2) + 1)
+        {
+            params.dim = dim;
+
+            /* Kannan-Bachem blows up quickly */
+            min_kb = 0.0;
+            if (dim <= 16)
+            {
+                params.algorithm = 0;
+                prof_repeat(&min_kb, &max, sample, &params);
+            }
+
+            params.algorithm = 1;
+            prof_repeat(&min_iliopoulos, &max, sample, &params);
+
+            params.algorithm = 2;
+            prof_repeat(&min_local, &max, sample, &params);
+
+            flint_printf("dim = %wd kannan-bachem/iliopoulos/local "
+                         "%.2f %.2f %.2f (us)\n",
+                         dim, min_kb, min_iliopoulos, min_local);
+        }
+    }
+
+    return 0;
+}
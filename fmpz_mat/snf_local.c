@@ -0,0 +1,212 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+#include "fmpz_factor.h"
+
+/* number of primes used for splitting off the small factors of mod */
+#define SNF_LOCAL_TRIAL_PRIMES 1000
+
+/* returns the p-adic valuation of 0 <= a < p^e, or max if it is larger */
+static ulong
+_valuation(mp_limb_t a, mp_limb_t p, ulong e, ulong max)
+{
+    ulong v = 0;
+
+    if (a == 0)
+        return FLINT_MIN(e, max);
+
+    while (v < max && a % p == 0)
+    {
+        a /= p;
+        v++;
+    }
+
+    return v;
+}
+
+/*
+    Sets v[0], ..., v[n - 1] to the exponents of p in the invariant factors
+    of the n x n matrix A over Z/p^eZ, where p^e is the modulus of A. The
+    ring is local, so if the pivot is chosen with minimal valuation among
+    the remaining entries it divides everything in its row and column, and
+    clearing the column by row operations is enough: the column operations
+    would only zero out the rest of the pivot row. The pivots then have
+    nondecreasing valuations. The matrix A is destroyed.
+*/
+static void
+_nmod_mat_snf_prime_power(ulong * v, nmod_mat_t A, mp_limb_t p, ulong e)
+{
+    slong i, j, k, pi, pj, n = A->r;
+    ulong best, w;
+    mp_limb_t pv, u, f;
+
+    for (k = 0; k < n; k++)
+    {
+        /* find an entry of minimal valuation */
+        best = e;
+        pi = pj = k;
+
+        for (i = k; i < n && best != 0; i++)
+        {
+            for (j = k; j < n && best != 0; j++)
+            {
+                w = _valuation(nmod_mat_entry(A, i, j), p, e, best);
+
+                if (w < best)
+                {
+                    best = w;
+                    pi = i;
+                    pj = j;
+                }
+            }
+        }
+
+        /* the rest of the matrix is zero */
+        if (best == e)
+        {
+            for ( ; k < n; k++)
+                v[k] = e;
+            return;
+        }
+
+        v[k] = best;
+
+        if (pi != k)
+            nmod_mat_swap_rows(A, NULL, k, pi);
+
+        if (pj != k)
+        {
+            for (i = k; i < n; i++)
+            {
+                f = nmod_mat_entry(A, i, k);
+                nmod_mat_entry(A, i, k) = nmod_mat_entry(A, i, pj);
+                nmod_mat_entry(A, i, pj) = f;
+            }
+        }
+
+        /* the pivot is p^best times a unit u */
+        pv = n_pow(p, best);
+        u = n_invmod(nmod_mat_entry(A, k, k) / pv, A->mod.n);
+
+        for (i = k + 1; i < n; i++)
+        {
+            if (nmod_mat_entry(A, i, k) == 0)
+                continue;
+
+            f = n_mulmod2_preinv(nmod_mat_entry(A, i, k) / pv, u,
+                                 A->mod.n, A->mod.ninv);
+
+            _nmod_vec_scalar_addmul_nmod(A->rows[i] + k + 1, A->rows[k] + k + 1,
+                                         n - k - 1, nmod_neg(f, A->mod), A->mod);
+            nmod_mat_entry(A, i, k) = 0;
+        }
+    }
+}
+
+/* multiplies the diagonal of S by the local invariant factors at p^e */
+static void
+_fmpz_mat_snf_local_mul(fmpz_mat_t S, const fmpz_mat_t A, mp_limb_t p,
+                                                                    ulong e)
+{
+    slong i, n = A->r;
+    ulong * v;
+    nmod_mat_t Amod;
+
+    v = flint_malloc(sizeof(ulong) * n);
+    nmod_mat_init(Amod, n, n, n_pow(p, e));
+    fmpz_mat_get_nmod_mat(Amod, A);
+
+    _nmod_mat_snf_prime_power(v, Amod, p, e);
+
+    for (i = 0; i < n; i++)
+        if (v[i] != 0)
+            fmpz_mul_ui(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i),
+                        n_pow(p, v[i]));
+
+    nmod_mat_clear(Amod);
+    flint_free(v);
+}
+
+void
+fmpz_mat_snf_local(fmpz_mat_t S, const fmpz_mat_t A, const fmpz_t mod)
+{
+    slong i, n = A->r;
+    fmpz_factor_t fac;
+    fmpz_mat_t T;
+    fmpz_t c, q;
+    n_factor_t nfac;
+
+    fmpz_mat_init(T, n, n);
+    fmpz_factor_init(fac);
+    fmpz_init(c);
+    fmpz_init(q);
+
+    for (i = 0; i < n; i++)
+        fmpz_one(fmpz_mat_entry(T, i, i));
+
+    /* split off the prime power factors found by trial division, the
+       rest c of mod is handled by the cofactor code below */
+    fmpz_abs(c, mod);
+    fmpz_factor_trial_range(fac, c, 0, SNF_LOCAL_TRIAL_PRIMES);
+
+    for (i = 0; i < fac->num; i++)
+    {
+        fmpz_pow_ui(q, fac->p + i, fac->exp[i]);
+        fmpz_divexact(c, c, q);
+    }
+
+    /* the remaining cofactor is word sized, so can be factored completely */
+    if (!fmpz_is_one(c) && fmpz_abs_fits_ui(c))
+    {
+        n_factor_init(&nfac);
+        n_factor(&nfac, fmpz_get_ui(c), 0);
+
+        for (i = 0; i < nfac.num; i++)
+            _fmpz_factor_append_ui(fac, nfac.p[i], nfac.exp[i]);
+
+        fmpz_one(c);
+    }
+
+    for (i = 0; i < fac->num; i++)
+    {
+        fmpz_pow_ui(q, fac->p + i, fac->exp[i]);
+
+        if (fmpz_abs_fits_ui(q))
+            _fmpz_mat_snf_local_mul(T, A, fmpz_get_ui(fac->p + i),
+                                    fac->exp[i]);
+        else
+            fmpz_mul(c, c, q);
+    }
+
+    /* everything that does not fit in a word is done by Iliopoulos, which
+       gives the parts of the invariant factors dividing c */
+    if (!fmpz_is_one(c))
+    {
+        fmpz_mat_t U;
+
+        fmpz_mat_init(U, n, n);
+        fmpz_mat_snf_iliopoulos(U, A, c);
+
+        for (i = 0; i < n; i++)
+            fmpz_mul(fmpz_mat_entry(T, i, i), fmpz_mat_entry(T, i, i),
+                     fmpz_mat_entry(U, i, i));
+
+        fmpz_mat_clear(U);
+    }
+
+    fmpz_mat_swap(S, T);
+
+    fmpz_mat_clear(T);
+    fmpz_factor_clear(fac);
+    fmpz_clear(c);
+    fmpz_clear(q);
+}
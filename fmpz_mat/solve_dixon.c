@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,7 +10,9 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpz_mat.h"
+#include "fmpq_mat.h"
 
 static mp_limb_t
 find_good_prime_and_invert(nmod_mat_t Ainv,
@@ -87,6 +90,257 @@ mp_limb_t * get_crt_primes(slong * num_primes, const fmpz_mat_t A, mp_limb_t p)
 }
 
 
+/*
+    The products of a lifting step are done by several threads. A product
+    C = A B is split into blocks of rows, so that a single product (as in
+    the computation of y) also keeps every thread busy.
+*/
+typedef struct
+{
+    nmod_mat_struct * C;
+    nmod_mat_struct * A;
+    const nmod_mat_struct * B;
+    slong num;
+    slong start;
+    slong step;
+}
+dixon_mul_arg_t;
+
+static void *
+_fmpz_mat_solve_dixon_mul_worker(void * arg_ptr)
+{
+    dixon_mul_arg_t arg = *((dixon_mul_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.start; i < arg.num; i += arg.step)
+        nmod_mat_mul(arg.C + i, arg.A + i, arg.B + i);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* C[k] = A[k] B[k] for 0 <= k < num */
+static void
+_fmpz_mat_solve_dixon_mul(nmod_mat_struct * C, const nmod_mat_struct * A,
+                                      const nmod_mat_struct * B, slong num)
+{
+    slong i, k, n, blocks, tasks, num_threads;
+    nmod_mat_struct * Cw, * Aw, * Bw;
+    dixon_mul_arg_t * args;
+    pthread_t * threads;
+
+    n = A->r;
+    num_threads = flint_get_num_threads();
+
+    if (num_threads <= 1 || n * A->c * B->c < WORD(1) << 16)
+    {
+        for (k = 0; k < num; k++)
+            nmod_mat_mul(C + k, A + k, B + k);
+        return;
+    }
+
+    blocks = FLINT_MIN((num_threads + num - 1) / num, n);
+    tasks = num * blocks;
+    num_threads = FLINT_MIN(num_threads, tasks);
+
+    Cw = flint_malloc(sizeof(nmod_mat_struct) * 3 * tasks);
+    Aw = Cw + tasks;
+    Bw = Aw + tasks;
+    args = flint_malloc(sizeof(dixon_mul_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (k = 0; k < num; k++)
+    {
+        for (i = 0; i < blocks; i++)
+        {
+            slong r0 = (n * i) / blocks, r1 = (n * (i + 1)) / blocks;
+
+            nmod_mat_window_init(Cw + k * blocks + i, C + k, r0, 0, r1, C->c);
+            nmod_mat_window_init(Aw + k * blocks + i, A + k, r0, 0, r1, A->c);
+            Bw[k * blocks + i] = B[k];
+        }
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].C = Cw;
+        args[i].A = Aw;
+        args[i].B = Bw;
+        args[i].num = tasks;
+        args[i].start = i;
+        args[i].step = num_threads;
+
+        pthread_create(&threads[i], NULL,
+                       _fmpz_mat_solve_dixon_mul_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    for (k = 0; k < tasks; k++)
+    {
+        nmod_mat_window_clear(Cw + k);
+        nmod_mat_window_clear(Aw + k);
+    }
+
+    flint_free(Cw);
+    flint_free(args);
+    flint_free(threads);
+}
+
+typedef struct
+{
+    fmpz_mat_struct * Ay;
+    const nmod_mat_struct * Ay_mod;
+    const fmpz_comb_struct * comb;
+    slong r0;
+    slong r1;
+}
+dixon_crt_arg_t;
+
+/* rows r0, ..., r1 - 1 of Ay from their images modulo the primes of comb */
+static void
+_fmpz_mat_solve_dixon_crt_rows(fmpz_mat_t Ay, const nmod_mat_struct * Ay_mod,
+                               const fmpz_comb_t comb, slong r0, slong r1)
+{
+    fmpz_comb_temp_t comb_temp;
+    mp_ptr residues;
+    slong i, j, k, num_primes = comb->num_primes;
+
+    fmpz_comb_temp_init(comb_temp, comb);
+    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+
+    for (i = r0; i < r1; i++)
+    {
+        for (j = 0; j < Ay->c; j++)
+        {
+            for (k = 0; k < num_primes; k++)
+                residues[k] = nmod_mat_entry(Ay_mod + k, i, j);
+
+            fmpz_multi_CRT_ui(fmpz_mat_entry(Ay, i, j), residues,
+                                                    comb, comb_temp, 1);
+        }
+    }
+
+    flint_free(residues);
+    fmpz_comb_temp_clear(comb_temp);
+}
+
+static void *
+_fmpz_mat_solve_dixon_crt_worker(void * arg_ptr)
+{
+    dixon_crt_arg_t arg = *((dixon_crt_arg_t *) arg_ptr);
+
+    _fmpz_mat_solve_dixon_crt_rows(arg.Ay, arg.Ay_mod, arg.comb,
+                                   arg.r0, arg.r1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_fmpz_mat_solve_dixon_crt(fmpz_mat_t Ay, const nmod_mat_struct * Ay_mod,
+                                                      const fmpz_comb_t comb)
+{
+    slong i, n, num_threads;
+    dixon_crt_arg_t * args;
+    pthread_t * threads;
+
+    n = Ay->r;
+    num_threads = FLINT_MIN(flint_get_num_threads(), n);
+
+    if (num_threads <= 1 || n * Ay->c * comb->num_primes < 1024)
+    {
+        _fmpz_mat_solve_dixon_crt_rows(Ay, Ay_mod, comb, 0, n);
+        return;
+    }
+
+    args = flint_malloc(sizeof(dixon_crt_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].Ay = Ay;
+        args[i].Ay_mod = Ay_mod;
+        args[i].comb = comb;
+        args[i].r0 = (n * i) / num_threads;
+        args[i].r1 = (n * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL,
+                       _fmpz_mat_solve_dixon_crt_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+}
+
+/*
+    Tries to recover the solution from x = A^{-1} B mod M. On success the
+    reconstructed solution has been checked against A X = B, and written
+    as num / den over the common denominator it satisfies
+    2 max |num| den < M, so that M and x can be returned.
+*/
+static int
+_fmpz_mat_solve_dixon_check(const fmpz_mat_t A, const fmpz_mat_t B,
+                                        const fmpz_mat_t x, const fmpz_t M)
+{
+    fmpq_mat_t Xq;
+    fmpz_mat_t num, AX, dB;
+    fmpz_t den, t;
+    slong i, j;
+    int success;
+
+    fmpq_mat_init(Xq, x->r, x->c);
+
+    success = fmpq_mat_set_fmpz_mat_mod_fmpz(Xq, x, M);
+
+    if (success)
+    {
+        fmpz_init(den);
+        fmpz_init(t);
+        fmpz_mat_init(num, x->r, x->c);
+        fmpz_mat_init(AX, B->r, B->c);
+        fmpz_mat_init(dB, B->r, B->c);
+
+        fmpq_mat_get_fmpz_mat_matwise(num, den, Xq);
+        fmpz_mat_mul(AX, A, num);
+        fmpz_mat_scalar_mul_fmpz(dB, B, den);
+        success = fmpz_mat_equal(AX, dB);
+
+        /*
+            Now num / den is the solution, and 2 |p| q < M for each entry
+            p / q if 2 max |num| den < M. This depends on the solution and M
+            only, not on how the reconstruction was done.
+        */
+        if (success)
+        {
+            fmpz_zero(t);
+
+            for (i = 0; i < x->r; i++)
+                for (j = 0; j < x->c; j++)
+                    if (fmpz_cmpabs(t, fmpz_mat_entry(num, i, j)) < 0)
+                        fmpz_abs(t, fmpz_mat_entry(num, i, j));
+
+            fmpz_mul(t, t, den);
+            fmpz_mul_2exp(t, t, 1);
+            success = (fmpz_cmp(t, M) < 0);
+        }
+
+        fmpz_clear(den);
+        fmpz_clear(t);
+        fmpz_mat_clear(num);
+        fmpz_mat_clear(AX);
+        fmpz_mat_clear(dB);
+    }
+
+    fmpq_mat_clear(Xq);
+
+    return success;
+}
+
 static void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B,
@@ -95,18 +349,17 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 {
     fmpz_t bound, ppow;
     fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
     mp_limb_t * crt_primes;
-    nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, n, cols, num_primes;
+    nmod_mat_struct * A_mod, * Ay_mod, * y_mods;
+    nmod_mat_t d_mod, y_mod;
+    fmpz_comb_t comb;
+    slong i, n, cols, num_primes, iter, next_check;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
     fmpz_mat_init(y, n, cols);
@@ -125,24 +378,46 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
     crt_primes = get_crt_primes(&num_primes, A, p);
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * num_primes);
+    fmpz_comb_init(comb, crt_primes, num_primes);
+
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * 3 * num_primes);
+    Ay_mod = A_mod + num_primes;
+    y_mods = Ay_mod + num_primes;
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_init(A_mod[i], n, n, crt_primes[i]);
-        fmpz_mat_get_nmod_mat(A_mod[i], A);
+        nmod_mat_init(A_mod + i, n, n, crt_primes[i]);
+        fmpz_mat_get_nmod_mat(A_mod + i, A);
+        nmod_mat_init(Ay_mod + i, n, cols, crt_primes[i]);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
     nmod_mat_init(d_mod, n, cols, p);
     nmod_mat_init(y_mod, n, cols, p);
 
+    /* y mod p is also its own image modulo each of the larger primes */
+    for (i = 0; i < num_primes; i++)
+    {
+        y_mods[i] = *y_mod;
+        _nmod_mat_set_mod(y_mods + i, crt_primes[i]);
+    }
+
     fmpz_one(ppow);
 
+    /*
+        The bound is often far from sharp, so from time to time we try to
+        reconstruct the solution and stop as soon as it can be verified.
+        The attempts are made after 1, 2, 4, ... steps, only while at most
+        half of the bound has been reached, and only if reconstructing an
+        entry costs less than a lifting step. Thus they cost little when
+        the bound is sharp, as it is for random dense matrices.
+    */
+    iter = 0;
+    next_check = 1;
+
     while (fmpz_cmp(ppow, bound) <= 0)
     {
         /* y = A^(-1) * d  (mod p) */
         fmpz_mat_get_nmod_mat(d_mod, d);
-        nmod_mat_mul(y_mod, Ainv, d_mod);
+        _fmpz_mat_solve_dixon_mul(y_mod, Ainv, d_mod, 1);
 
         /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
         fmpz_mat_scalar_addmul_nmod_mat_fmpz(x, y_mod, ppow);
@@ -152,30 +427,32 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         if (fmpz_cmp(ppow, bound) > 0)
             break;
 
+        iter++;
+        if (iter == next_check)
+        {
+            slong size = fmpz_size(ppow);
+
+            if (2 * fmpz_bits(ppow) <= fmpz_bits(bound)
+                && size * size <= n * n * cols
+                && _fmpz_mat_solve_dixon_check(A, B, x, ppow))
+                break;
+
+            next_check = 2 * iter;
+        }
+
         /* d = (d - Ay) / p */
 #if USE_SLOW_MULTIPLICATION
         fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
         fmpz_mat_mul(Ay, A, y);
 #else
-        for (i = 0; i < num_primes; i++)
-        {
-            _nmod_mat_set_mod(y_mod, crt_primes[i]);
-            _nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
-        }
+        _fmpz_mat_solve_dixon_mul(Ay_mod, A_mod, y_mods, num_primes);
+
+        if (num_primes == 1)
+            fmpz_mat_set_nmod_mat(Ay, Ay_mod);
+        else
+            _fmpz_mat_solve_dixon_crt(Ay, Ay_mod, comb);
 #endif
 
-        _nmod_mat_set_mod(y_mod, p);
         fmpz_mat_sub(d, d, Ay);
         fmpz_mat_scalar_divexact_ui(d, d, p);
     }
@@ -185,17 +462,19 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     nmod_mat_clear(y_mod);
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
     for (i = 0; i < num_primes; i++)
-        nmod_mat_clear(A_mod[i]);
+    {
+        nmod_mat_clear(A_mod + i);
+        nmod_mat_clear(Ay_mod + i);
+    }
 
     flint_free(A_mod);
+    fmpz_comb_clear(comb);
     flint_free(crt_primes);
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(x);
     fmpz_mat_clear(y);
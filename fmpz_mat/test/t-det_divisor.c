@@ -85,6 +85,51 @@ main(void)
         fmpz_clear(r);
     }
 
+    /* Diagonal matrices of primes, with and without threads. The early
+       termination of Dixon lifting must leave enough precision for the
+       denominator of the whole solution vector. */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t A;
+        fmpz_t det, d;
+        mp_limb_t p;
+        slong j, m;
+
+        flint_set_num_threads(1 + n_randint(state, 8));
+
+        m = 64 + n_randint(state, 100);
+        p = n_nextprime(2000 + n_randint(state, 1000), 0);
+
+        fmpz_init(det);
+        fmpz_init(d);
+        fmpz_mat_init(A, m, m);
+
+        fmpz_one(det);
+        for (j = 0; j < m; j++)
+        {
+            fmpz_set_ui(fmpz_mat_entry(A, j, j), p);
+            fmpz_mul_ui(det, det, p);
+            p = n_nextprime(p, 0);
+        }
+
+        fmpz_mat_det_divisor(d, A);
+
+        if (!fmpz_equal(det, d))
+        {
+            flint_printf("FAIL (diagonal):\n");
+            flint_printf("m = %wd\n", m);
+            flint_printf("det: ");  fmpz_print(det);    flint_printf("\n");
+            flint_printf("d: "); fmpz_print(d); flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_clear(det);
+        fmpz_clear(d);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    fmpz_mat_t A;
+    slong i, m, k;
+    fmpz_t det1, det2, d;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("det_modular_stable....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        m = n_randint(state, 10);
+        k = n_randint(state, 4);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        fmpz_mat_init(A, m, m);
+
+        fmpz_init(det1);
+        fmpz_init(det2);
+        fmpz_init(d);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 200));
+
+        if (n_randint(state, 2))
+            fmpz_mat_det_divisor(d, A);
+        else
+            fmpz_one(d);
+
+        fmpz_mat_det_bareiss(det1, A);
+        fmpz_mat_det_modular_stable(det2, A, d, k);
+
+        if (!fmpz_equal(det1, det2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("different determinants!\n");
+            fmpz_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("k = %wd\n", k);
+            flint_printf("det1: "), fmpz_print(det1), flint_printf("\n");
+            flint_printf("det2: "), fmpz_print(det2), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(det1);
+        fmpz_clear(det2);
+        fmpz_clear(d);
+        fmpz_mat_clear(A);
+    }
+
+    /* large matrices with small determinants */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        m = 20 + n_randint(state, 40);
+        k = 1 + n_randint(state, 3);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        fmpz_mat_init(A, m, m);
+
+        fmpz_init(det1);
+        fmpz_init(det2);
+        fmpz_init(d);
+
+        fmpz_randtest_not_zero(det1, state, 1 + n_randint(state, 100));
+        fmpz_mat_randdet(A, state, det1);
+        fmpz_mat_randops(A, state, n_randint(state, 2 * m * m + 1));
+        fmpz_one(d);
+
+        fmpz_mat_det_modular_stable(det2, A, d, k);
+
+        if (!fmpz_equal(det1, det2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("different determinants (small)!\n");
+            flint_printf("k = %wd\n", k);
+            flint_printf("det1: "), fmpz_print(det1), flint_printf("\n");
+            flint_printf("det2: "), fmpz_print(det2), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(det1);
+        fmpz_clear(det2);
+        fmpz_clear(d);
+        fmpz_mat_clear(A);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
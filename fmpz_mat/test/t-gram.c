@@ -29,6 +29,8 @@ int main(void)
         m = n_randint(state, 50);
         n = n_randint(state, 50);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_mat_init(A, m, n);
         fmpz_mat_init(B, n, m);
         fmpz_mat_init(C, m, m);
@@ -52,6 +54,8 @@ int main(void)
         fmpz_mat_clear(D);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");    
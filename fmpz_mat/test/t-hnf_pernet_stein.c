@@ -32,6 +32,8 @@ main(void)
         slong m, n, r, b, d;
         int equal;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         n = 1 + n_randint(state, 10);
         m = 1 + n_randint(state, 10);
         r = n_randint(state, FLINT_MIN(m, n) + 1);
@@ -154,6 +156,8 @@ main(void)
         fmpz_mat_clear(A);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -32,6 +32,8 @@ main(void)
         slong m, n, b, d, r;
         int equal;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         m = n_randint(state, 10);
         n = n_randint(state, 10);
         r = n_randint(state, FLINT_MIN(m, n) + 1);
@@ -109,6 +111,8 @@ main(void)
         fmpz_mat_clear(A);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("snf_local....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 10000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, S2;
+        fmpz_t mod, t;
+        slong m, n, b, d;
+        int equal;
+
+        m = n_randint(state, 10);
+        if (n_randint(state, 50) == 0)
+            m += n_randint(state, 30);
+        n = m;
+
+        fmpz_init(mod);
+        fmpz_init(t);
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(S, m, n);
+        fmpz_mat_init(S2, m, n);
+
+        /* sparse */
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*m*n + 1);
+        fmpz_mat_randrank(A, state, m, b);
+
+        /* dense */
+        if (n_randint(state, 2))
+            fmpz_mat_randops(A, state, d);
+
+        fmpz_mat_det(mod, A);
+        fmpz_abs(mod, mod);
+
+        /* any multiple of the determinant will do */
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                fmpz_mul_ui(mod, mod, n_randtest_not_zero(state));
+                break;
+            case 1:
+                fmpz_randprime(t, state, 2 + n_randint(state, 100), 0);
+                fmpz_pow_ui(t, t, 1 + n_randint(state, 3));
+                fmpz_mul(mod, mod, t);
+                break;
+            default:
+                break;
+        }
+
+        fmpz_mat_snf_local(S, A, mod);
+
+        if (!fmpz_mat_is_in_snf(S))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("matrix not in snf!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            abort();
+        }
+
+        /* Kannan-Bachem is very slow for the larger matrices */
+        if (m < 10)
+            fmpz_mat_snf_kannan_bachem(S2, A);
+        else
+            fmpz_mat_snf_iliopoulos(S2, A, mod);
+        equal = fmpz_mat_equal(S, S2);
+
+        if (!equal)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("snfs found by different methods should be the same!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            fmpz_print(mod); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_snf_local(S2, S, mod);
+        equal = fmpz_mat_equal(S, S2);
+
+        if (!equal)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("snf of a matrix in snf should be the same!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(S2);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(A);
+        fmpz_clear(mod);
+        fmpz_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
 
     This file is part of FLINT.
 
@@ -16,13 +17,15 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_mat.h"
+#include "fmpq_mat.h"
 #include "ulong_extras.h"
 
 int
 main(void)
 {
     fmpz_mat_t A, X, B, AX, AXm, Bm;
-    fmpz_t mod;
+    fmpq_mat_t Xq;
+    fmpz_t mod, den;
     slong i, m, n, r;
     int success;
 
@@ -33,8 +36,18 @@ main(void)
 
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
-        m = n_randint(state, 20);
-        n = n_randint(state, 20);
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 100);
+            n = n_randint(state, 30);
+        }
+        else
+        {
+            m = n_randint(state, 20);
+            n = n_randint(state, 20);
+        }
 
         fmpz_mat_init(A, m, m);
         fmpz_mat_init(B, m, n);
@@ -72,6 +85,33 @@ main(void)
             abort();
         }
 
+        /*
+            the solution can be recovered by rational reconstruction,
+            whatever the number of threads used
+        */
+        fmpq_mat_init(Xq, m, n);
+        fmpz_init(den);
+
+        flint_set_num_threads(1 + n_randint(state, 8));
+
+        success = fmpq_mat_set_fmpz_mat_mod_fmpz(Xq, X, mod);
+        fmpq_mat_get_fmpz_mat_matwise(AXm, den, Xq);
+        fmpz_mat_mul(AX, A, AXm);
+        fmpz_mat_scalar_mul_fmpz(Bm, B, den);
+
+        if (!success || !fmpz_mat_equal(AX, Bm))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("reconstruction failed\n");
+            flint_printf("A:\n"),      fmpz_mat_print_pretty(A),  flint_printf("\n");
+            flint_printf("B:\n"),      fmpz_mat_print_pretty(B),  flint_printf("\n");
+            flint_printf("mod = "),    fmpz_print(mod),           flint_printf("\n");
+            abort();
+        }
+
+        fmpq_mat_clear(Xq);
+        fmpz_clear(den);
+
         fmpz_mat_clear(A);
         fmpz_mat_clear(B);
         fmpz_mat_clear(Bm);
@@ -113,6 +153,8 @@ main(void)
         fmpz_clear(mod);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
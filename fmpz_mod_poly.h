@@ -40,6 +40,8 @@
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
 
+#define FMPZ_MOD_POLY_TREE_THREADED_CUTOFF 512 /* Subproduct trees: serial -> threaded */
+
 /*  Type definitions *********************************************************/
 
 typedef struct
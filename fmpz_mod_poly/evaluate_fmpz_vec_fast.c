@@ -10,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -17,100 +18,203 @@
 #include "fmpz_vec.h"
 #include "fmpz_mod_poly.h"
 
+/*
+    If poly is not NULL, reduces (poly, plen) modulo the blocks b0, ..., b1 - 1
+    of level i, writing to u. Otherwise, reduces the pairs of blocks
+    b0, ..., b1 - 1 of level i + 1 in t modulo their children.
+*/
+static void
+_fmpz_mod_poly_evaluate_level(fmpz * u, const fmpz * t, const fmpz * poly,
+        slong plen, fmpz_poly_struct * const * tree, slong len, slong i,
+        slong b0, slong b1, const fmpz_t mod)
+{
+    slong pow, left;
+    fmpz_t inv;
+    const fmpz * pb;
+    fmpz * pc;
+    fmpz_poly_struct * pa;
+
+    fmpz_init(inv);
+
+    pow = WORD(1) << i;
+
+    if (poly != NULL)
+    {
+        for (pa = tree[i] + b0; b0 < b1; b0++, pa++)
+        {
+            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
+            _fmpz_mod_poly_rem(u + b0 * pow, poly, plen, pa->coeffs, pa->length, inv, mod);
+        }
+
+        fmpz_clear(inv);
+        return;
+    }
+
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + 2 * b0;
+    pb = t + b0 * 2 * pow;
+    pc = u + b0 * 2 * pow;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
+        _fmpz_mod_poly_rem(pc, pb, 2 * pow, pa->coeffs, pa->length, inv, mod);
+
+        pa++;
+        fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
+        _fmpz_mod_poly_rem(pc + pow, pb, 2 * pow, pa->coeffs, pa->length, inv, mod);
+
+        pa++;
+        pb += 2 * pow;
+        pc += 2 * pow;
+        left -= 2 * pow;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
+            _fmpz_mod_poly_rem(pc, pb, left, pa->coeffs, pa->length, inv, mod);
+
+            pa ++;
+            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
+            _fmpz_mod_poly_rem(pc + pow, pb, left, pa->coeffs, pa->length, inv, mod);
+        }
+        else if (left > 0)
+           _fmpz_vec_set(pc, pb, left);
+    }
+
+    fmpz_clear(inv);
+}
+
+typedef struct
+{
+    fmpz * u;
+    const fmpz * t;
+    const fmpz * poly;
+    slong plen;
+    fmpz_poly_struct * const * tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    const fmpz * mod;
+}
+evaluate_level_arg_t;
+
+void *
+_fmpz_mod_poly_evaluate_level_worker(void * arg_ptr)
+{
+    evaluate_level_arg_t arg = *((evaluate_level_arg_t *) arg_ptr);
+
+    _fmpz_mod_poly_evaluate_level(arg.u, arg.t, arg.poly, arg.plen, arg.tree,
+                                  arg.len, arg.i, arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_fmpz_mod_poly_evaluate_level_threaded(fmpz * u, const fmpz * t,
+        const fmpz * poly, slong plen, fmpz_poly_struct * const * tree,
+        slong len, slong i, const fmpz_t mod)
+{
+    slong blocks, j, num_threads;
+    pthread_t * threads;
+    evaluate_level_arg_t * args;
+
+    /* the blocks of level i, or the pairs of blocks of level i + 1 */
+    blocks = (poly != NULL) ? ((len - 1) >> i) + 1 : ((len - 1) >> (i + 1)) + 1;
+
+    num_threads = (len < FMPZ_MOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, blocks);
+
+    if (num_threads <= 1)
+    {
+        _fmpz_mod_poly_evaluate_level(u, t, poly, plen, tree, len, i,
+                                                           0, blocks, mod);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(evaluate_level_arg_t) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        args[j].u = u;
+        args[j].t = t;
+        args[j].poly = poly;
+        args[j].plen = plen;
+        args[j].tree = tree;
+        args[j].len = len;
+        args[j].i = i;
+        args[j].b0 = (blocks * j) / num_threads;
+        args[j].b1 = (blocks * (j + 1)) / num_threads;
+        args[j].mod = mod;
+
+        pthread_create(&threads[j], NULL,
+                       _fmpz_mod_poly_evaluate_level_worker, &args[j]);
+    }
+
+    for (j = 0; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _fmpz_mod_poly_evaluate_fmpz_vec_fast_precomp(fmpz * vs, const fmpz * poly,
     slong plen, fmpz_poly_struct * const * tree, slong len, const fmpz_t mod)
 {
-    slong height, i, j, pow, left;
+    slong height, i;
     slong tree_height;
-    fmpz_t temp, inv;
-    fmpz * t, * u, * pb, * pc, * swap;
-    fmpz_poly_struct * pa;
-
-    fmpz_init(temp);
-    fmpz_init(inv);
+    fmpz_t temp;
+    fmpz * t, * u, * swap;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
     {
         if (len == 1)
         {
+            fmpz_init(temp);
             fmpz_negmod(temp, tree[0]->coeffs, mod);
             _fmpz_mod_poly_evaluate_fmpz(vs, poly, plen, temp, mod);
+            fmpz_clear(temp);
         } else if (len != 0 && plen == 0)
             _fmpz_vec_zero(vs, len);
         else if (len != 0 && plen == 1)
             for (i = 0; i < len; i++)
                 fmpz_set(vs + i, poly);
         
-        fmpz_clear(temp);
         return;
     }
 
     t = _fmpz_vec_init(2*len);
     u = _fmpz_vec_init(2*len);
 
-    left = len;
-
     /* Initial reduction. We allow the polynomial to be larger
        or smaller than the number of points. */
     height = FLINT_BIT_COUNT(plen - 1) - 1;
     tree_height = FLINT_CLOG2(len);
     while (height >= tree_height)
         height--;
-    pow = WORD(1) << height;
 
-    for (i = j = 0; i < len; i += pow, j++)
-    {
-        pa = tree[height] + j;
-        fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
-        _fmpz_mod_poly_rem(t + i, poly, plen, pa->coeffs, pa->length, inv, mod);
-    }
+    _fmpz_mod_poly_evaluate_level_threaded(t, NULL, poly, plen,
+                                           tree, len, height, mod);
 
     for (i = height - 1; i >= 0; i--)
     {
-        pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
-
-        left = len;
-        while (left >= 2 * pow)
-        {
-            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
-            _fmpz_mod_poly_rem(pc, pb, 2 * pow, pa->coeffs, pa->length, inv, mod);
-            
-            pa++;
-            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
-            _fmpz_mod_poly_rem(pc + pow, pb, 2 * pow, pa->coeffs, pa->length, inv, mod);
-            
-            pa++;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
-        
-        if (left > pow)
-        {
-            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
-            _fmpz_mod_poly_rem(pc, pb, left, pa->coeffs, pa->length, inv, mod);
-            
-            pa ++;
-            fmpz_invmod(inv, pa->coeffs + pa->length - 1, mod);
-            _fmpz_mod_poly_rem(pc + pow, pb, left, pa->coeffs, pa->length, inv, mod);
-        }
-        else if (left > 0)
-           _fmpz_vec_set(pc, pb, left);
+        _fmpz_mod_poly_evaluate_level_threaded(u, t, NULL, 0,
+                                               tree, len, i, mod);
 
         swap = t;
         t = u;
         u = swap;
     }
 
-    fmpz_clear(temp);
-    fmpz_clear(inv);
-
     _fmpz_vec_set(vs, t, len);
 
     _fmpz_vec_clear(t, 2*len);
@@ -10,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -55,11 +56,70 @@ void _fmpz_mod_poly_tree_free(fmpz_poly_struct ** tree, slong len)
     }
 }
 
+/* computes tree[i + 1] from tree[i] for the pairs of blocks b0, ..., b1 - 1 */
+static void
+_fmpz_mod_poly_tree_build_level(fmpz_poly_struct ** tree, slong len, slong i,
+                                 slong b0, slong b1, const fmpz_t mod)
+{
+    slong pow, left;
+    fmpz_poly_struct * pa, * pb;
+
+    pow = WORD(1) << i;
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + 2 * b0;
+    pb = tree[i + 1] + b0;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        fmpz_poly_fit_length(pb, pa->length + (pa + 1)->length - 1);
+        _fmpz_mod_poly_mul(pb->coeffs, pa->coeffs, pa->length, (pa + 1)->coeffs, (pa + 1)->length, mod);
+        _fmpz_poly_set_length(pb, pa->length + (pa + 1)->length - 1);
+        left -= 2 * pow;
+        pa += 2;
+        pb += 1;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            fmpz_poly_fit_length(pb, pa->length + (pa + 1)->length - 1);
+            _fmpz_mod_poly_mul(pb->coeffs, pa->coeffs, pa->length, (pa + 1)->coeffs, (pa + 1)->length, mod);
+            _fmpz_poly_set_length(pb, pa->length + (pa + 1)->length - 1);
+        } else if (left > 0)
+            fmpz_poly_set(pb, pa);
+    }
+}
+
+typedef struct
+{
+    fmpz_poly_struct ** tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    const fmpz * mod;
+}
+tree_build_arg_t;
+
+void *
+_fmpz_mod_poly_tree_build_worker(void * arg_ptr)
+{
+    tree_build_arg_t arg = *((tree_build_arg_t *) arg_ptr);
+
+    _fmpz_mod_poly_tree_build_level(arg.tree, arg.len, arg.i,
+                                    arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _fmpz_mod_poly_tree_build(fmpz_poly_struct ** tree, const fmpz * roots, slong len, const fmpz_t mod)
 {
-    slong height, pow, left, i;
-    fmpz_poly_struct * pa, * pb;
+    slong height, pairs, i, j, num_threads;
+    pthread_t * threads;
+    tree_build_arg_t * args;
 
     if (len == 0)
         return;
@@ -73,29 +133,43 @@ _fmpz_mod_poly_tree_build(fmpz_poly_struct ** tree, const fmpz * roots, slong le
         fmpz_negmod((tree[0] + i)->coeffs, roots + i, mod);
     }
 
+    num_threads = (len < FMPZ_MOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(tree_build_arg_t) * num_threads);
+
+    /* the products at each level are independent, so the pairs of blocks
+       are split between the threads */
     for (i = 0; i < height - 1; i++)
     {
-        left = len;
-        pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        slong nt;
+
+        pairs = ((len - 1) >> (i + 1)) + 1;
+        nt = FLINT_MIN(num_threads, pairs);
 
-        while (left >= 2 * pow)
+        if (nt <= 1)
         {
-            fmpz_poly_fit_length(pb, pa->length + (pa + 1)->length - 1);
-            _fmpz_mod_poly_mul(pb->coeffs, pa->coeffs, pa->length, (pa + 1)->coeffs, (pa + 1)->length, mod);
-            _fmpz_poly_set_length(pb, pa->length + (pa + 1)->length - 1);
-            left -= 2 * pow;
-            pa += 2;
-            pb += 1;
+            _fmpz_mod_poly_tree_build_level(tree, len, i, 0, pairs, mod);
+            continue;
         }
 
-        if (left > pow)
+        for (j = 0; j < nt; j++)
         {
-            fmpz_poly_fit_length(pb, pa->length + (pa + 1)->length - 1);
-            _fmpz_mod_poly_mul(pb->coeffs, pa->coeffs, pa->length, (pa + 1)->coeffs, (pa + 1)->length, mod);
-            _fmpz_poly_set_length(pb, pa->length + (pa + 1)->length - 1);
-        } else if (left > 0)
-            fmpz_poly_set(pb, pa);
+            args[j].tree = tree;
+            args[j].len = len;
+            args[j].i = i;
+            args[j].b0 = (pairs * j) / nt;
+            args[j].b1 = (pairs * (j + 1)) / nt;
+            args[j].mod = mod;
+
+            pthread_create(&threads[j], NULL,
+                           _fmpz_mod_poly_tree_build_worker, &args[j]);
+        }
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
     }
+
+    flint_free(threads);
+    flint_free(args);
 }
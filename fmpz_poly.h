@@ -40,6 +40,7 @@
 #endif
 
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
+#define FMPZ_POLY_REM_PREINV_CUTOFF 128
 
 /*  Type definitions *********************************************************/
 
@@ -60,6 +61,30 @@ typedef struct
 
 typedef fmpz_poly_powers_precomp_struct fmpz_poly_powers_precomp_t[1];
 
+typedef struct
+{
+   fmpz_poly_struct poly;
+   fmpz_poly_struct inv;
+} fmpz_poly_mod_ctx_struct;
+
+typedef fmpz_poly_mod_ctx_struct fmpz_poly_mod_ctx_t[1];
+
+typedef struct
+{
+   fmpz * xs;
+   slong len;
+   mp_bitcnt_t xbits;
+   int distinct;
+   mp_ptr primes;
+   slong num_primes;
+   slong alloc;
+   mp_ptr ** trees;
+   mp_ptr * rinv;
+   mp_ptr * weights;
+} fmpz_poly_multipoint_precomp_struct;
+
+typedef fmpz_poly_multipoint_precomp_struct fmpz_poly_multipoint_precomp_t[1];
+
 typedef struct {
     fmpz c;
     fmpz_poly_struct *p;
@@ -467,6 +492,31 @@ FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong le
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void _fmpz_poly_mulmid_SS(fmpz * output, const fmpz * input1,
+                       slong len1, const fmpz * input2, slong len2);
+
+FLINT_DLL void fmpz_poly_mulmid_SS(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
+FLINT_DLL void _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec,
+                       slong len, mp_srcptr primes, slong num_primes, int crt);
+
+typedef slong (* fmpz_multi_mod_image_func_t)(mp_ptr, mp_limb_t, void *);
+
+FLINT_DLL void _fmpz_vec_multi_mod_images_threaded(mp_ptr * images,
+                  slong * status, mp_srcptr primes, slong num_primes,
+                  fmpz_multi_mod_image_func_t image, void * arg);
+
+FLINT_DLL int _fmpz_vec_multi_mod_CRT_threaded(fmpz * res, slong len,
+                  fmpz_multi_mod_image_func_t image, void * arg,
+                  mp_bitcnt_t pbits, mp_bitcnt_t bound, mp_bitcnt_t stable_bits);
+
+FLINT_DLL void _fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1,
+                              slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
@@ -482,6 +532,12 @@ FLINT_DLL void fmpz_poly_mullow(fmpz_poly_t res,
 FLINT_DLL void fmpz_poly_mulhigh_n(fmpz_poly_t res, 
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void _fmpz_poly_mulmid(fmpz * res, const fmpz * poly1,
+                              slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mulmid(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
 /* Squaring ******************************************************************/
 
 FLINT_DLL void _fmpz_poly_sqr_KS(fmpz * rop, const fmpz * op, slong len);
@@ -500,6 +556,10 @@ FLINT_DLL void _fmpz_poly_sqr(fmpz * rop, const fmpz * op, slong len);
 
 FLINT_DLL void fmpz_poly_sqr(fmpz_poly_t rop, const fmpz_poly_t op);
 
+FLINT_DLL void _fmpz_poly_sqr_SS(fmpz * output, const fmpz * input, slong len);
+
+FLINT_DLL void fmpz_poly_sqr_SS(fmpz_poly_t res, const fmpz_poly_t poly);
+
 FLINT_DLL void _fmpz_poly_sqrlow_KS(fmpz * res, const fmpz * poly, slong len, slong n);
 
 FLINT_DLL void fmpz_poly_sqrlow_KS(fmpz_poly_t res, const fmpz_poly_t poly, slong n);
@@ -512,6 +572,11 @@ FLINT_DLL void _fmpz_poly_sqrlow_classical(fmpz * res, const fmpz * poly, slong
 
 FLINT_DLL void fmpz_poly_sqrlow_classical(fmpz_poly_t res, const fmpz_poly_t poly, slong n);
 
+FLINT_DLL void _fmpz_poly_sqrlow_SS(fmpz * output, const fmpz * input,
+                                                        slong len, slong n);
+
+FLINT_DLL void fmpz_poly_sqrlow_SS(fmpz_poly_t res, const fmpz_poly_t poly, slong n);
+
 FLINT_DLL void _fmpz_poly_sqrlow(fmpz * res, const fmpz * poly, slong len, slong n);
 
 FLINT_DLL void fmpz_poly_sqrlow(fmpz_poly_t res, const fmpz_poly_t poly, slong n);
@@ -774,6 +839,38 @@ FLINT_DLL void fmpz_poly_div_root(fmpz_poly_t Q, const fmpz_poly_t A, const fmpz
 
 FLINT_DLL void _fmpz_poly_div_root(fmpz * Q, const fmpz * A, slong len, const fmpz_t c);
 
+/*  Arithmetic modulo a fixed polynomial  ************************************/
+
+FLINT_DLL void fmpz_poly_mod_ctx_init(fmpz_poly_mod_ctx_t ctx,
+                                      const fmpz_poly_t B);
+
+FLINT_DLL void fmpz_poly_mod_ctx_clear(fmpz_poly_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_poly_rem_preinv(fmpz * R, const fmpz * A, slong lenA,
+                           const fmpz * B, const fmpz * B_inv, slong lenB);
+
+FLINT_DLL void fmpz_poly_rem_ctx(fmpz_poly_t R, const fmpz_poly_t A,
+                                 const fmpz_poly_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_poly_mulmod_preinv(fmpz * res, const fmpz * poly1,
+                    slong len1, const fmpz * poly2, slong len2,
+                    const fmpz * B, const fmpz * B_inv, slong lenB);
+
+FLINT_DLL void fmpz_poly_mulmod_ctx(fmpz_poly_t res, const fmpz_poly_t poly1,
+                 const fmpz_poly_t poly2, const fmpz_poly_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_poly_mulmod(fmpz_poly_t res, const fmpz_poly_t poly1,
+                              const fmpz_poly_t poly2, const fmpz_poly_t B);
+
+FLINT_DLL void _fmpz_poly_powmod_ui_preinv(fmpz * res, const fmpz * poly,
+                    ulong e, const fmpz * B, const fmpz * B_inv, slong lenB);
+
+FLINT_DLL void fmpz_poly_powmod_ui_ctx(fmpz_poly_t res,
+           const fmpz_poly_t poly, ulong e, const fmpz_poly_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_poly_powmod_ui(fmpz_poly_t res, const fmpz_poly_t poly,
+                                   ulong e, const fmpz_poly_t B);
+
 /*  Power series division  ***************************************************/
 
 FLINT_DLL void _fmpz_poly_inv_series_basecase(fmpz * Qinv, const fmpz * Q, slong Qlen, slong n);
@@ -993,7 +1090,14 @@ FLINT_DLL void fmpz_poly_compose_series_brent_kung(fmpz_poly_t res,
 FLINT_DLL void _fmpz_poly_compose_series_horner(fmpz * res, const fmpz * poly1, slong len1, 
                                       const fmpz * poly2, slong len2, slong n);
 
-FLINT_DLL void fmpz_poly_compose_series_horner(fmpz_poly_t res, 
+FLINT_DLL void fmpz_poly_compose_series_horner(fmpz_poly_t res,
+                    const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
+
+FLINT_DLL void _fmpz_poly_compose_series_multi_mod(fmpz * res,
+                    const fmpz * poly1, slong len1, const fmpz * poly2,
+                                                   slong len2, slong n);
+
+FLINT_DLL void fmpz_poly_compose_series_multi_mod(fmpz_poly_t res,
                     const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
 FLINT_DLL void _fmpz_poly_compose_series(fmpz * res, const fmpz * poly1, slong len1, 
@@ -1155,6 +1259,35 @@ FLINT_DLL void fmpz_poly_evaluate_fmpz_vec(fmpz * res, const fmpz_poly_t f,
 FLINT_DLL void fmpz_poly_interpolate_fmpz_vec(fmpz_poly_t poly,
                                     const fmpz * xs, const fmpz * ys, slong n);
 
+FLINT_DLL void fmpz_poly_multipoint_precompute(
+             fmpz_poly_multipoint_precomp_t T, const fmpz * xs, slong len);
+
+FLINT_DLL void fmpz_poly_multipoint_clear(fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void _fmpz_poly_multipoint_fit_primes(
+                       fmpz_poly_multipoint_precomp_t T, slong num_primes);
+
+FLINT_DLL void _fmpz_poly_multipoint_fit_weights(
+                                       fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void _fmpz_poly_evaluate_fmpz_vec_fast_precomp(fmpz * ys,
+   const fmpz * poly, slong plen, fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void fmpz_poly_evaluate_fmpz_vec_fast_precomp(fmpz * ys,
+             const fmpz_poly_t poly, fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void fmpz_poly_evaluate_fmpz_vec_fast(fmpz * ys,
+                      const fmpz_poly_t poly, const fmpz * xs, slong n);
+
+FLINT_DLL void _fmpz_poly_interpolate_multi_mod(fmpz * poly, const fmpz * ys,
+                    fmpz_poly_multipoint_precomp_t T, slong num_primes);
+
+FLINT_DLL void fmpz_poly_interpolate_fmpz_vec_fast_precomp(fmpz_poly_t poly,
+                   const fmpz * ys, fmpz_poly_multipoint_precomp_t T);
+
+FLINT_DLL void fmpz_poly_interpolate_fmpz_vec_fast(fmpz_poly_t poly,
+                                const fmpz * xs, const fmpz * ys, slong n);
+
 /* Hensel lifting ************************************************************/
 
 FLINT_DLL void fmpz_poly_hensel_build_tree(slong * link, fmpz_poly_t *v, fmpz_poly_t *w, 
@@ -1273,6 +1406,12 @@ FLINT_DLL slong _fmpz_poly_num_real_roots(const fmpz * pol, slong len);
 
 FLINT_DLL slong fmpz_poly_num_real_roots(const fmpz_poly_t poly);
 
+FLINT_DLL slong _fmpz_poly_isolate_real_roots(fmpz * a, fmpz * b,
+                              slong * exp, const fmpz * pol, slong len);
+
+FLINT_DLL slong fmpz_poly_isolate_real_roots(fmpz * a, fmpz * b,
+                              slong * exp, const fmpz_poly_t pol);
+
 /* CLD bounds */
 
 FLINT_DLL void fmpz_poly_CLD_bound(fmpz_t res, const fmpz_poly_t f, slong n);
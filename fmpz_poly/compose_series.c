@@ -20,8 +20,14 @@ void
 _fmpz_poly_compose_series(fmpz * res, const fmpz * poly1, slong len1, 
                                       const fmpz * poly2, slong len2, slong n)
 {
+    /*
+        The multimodular algorithm is several times slower on a single
+        core, but its images are independent and parallelise perfectly
+    */
     if (len1 <= 10)
         _fmpz_poly_compose_series_horner(res, poly1, len1, poly2, len2, n);
+    else if (len1 >= 256 && flint_get_num_threads() >= 8)
+        _fmpz_poly_compose_series_multi_mod(res, poly1, len1, poly2, len2, n);
     else
         _fmpz_poly_compose_series_brent_kung(res, poly1, len1, poly2, len2, n);
 }
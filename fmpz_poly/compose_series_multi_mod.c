@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    const fmpz * poly1;
+    slong len1;
+    const fmpz * poly2;
+    slong len2;
+    slong n;
+}
+compose_series_arg_t;
+
+static slong
+_fmpz_poly_compose_series_image(mp_ptr res, mp_limb_t p, void * arg_ptr)
+{
+    compose_series_arg_t * arg = (compose_series_arg_t *) arg_ptr;
+    mp_ptr a, b;
+    nmod_t mod;
+
+    nmod_init(&mod, p);
+
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    _fmpz_vec_get_nmod_vec(a, arg->poly1, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->poly2, arg->len2, mod);
+
+    _nmod_poly_compose_series(res, a, arg->len1, b, arg->len2, arg->n, mod);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+
+    return 1;
+}
+
+void
+_fmpz_poly_compose_series_multi_mod(fmpz * res, const fmpz * poly1,
+                  slong len1, const fmpz * poly2, slong len2, slong n)
+{
+    compose_series_arg_t arg;
+    mp_bitcnt_t bits1, bits2, bound;
+    fmpz_t t;
+    slong i;
+
+    if (n == 1)
+    {
+        fmpz_set(res, poly1);
+        return;
+    }
+
+    /*
+        The coefficients of poly2^j are bounded by |poly2|_1^j, so those of
+        the composition are bounded by len1 |poly1|_inf |poly2|_1^(len1 - 1).
+        Counting the compositions of k into j parts, the coefficient of x^k
+        is also bounded by |poly1|_inf h (1 + h)^(k - 1) with
+        h = |poly2|_inf < 2^bits2. One more bit for the sign.
+    */
+    fmpz_init(t);
+    for (i = 0; i < len2; i++)
+    {
+        if (fmpz_sgn(poly2 + i) >= 0)
+            fmpz_add(t, t, poly2 + i);
+        else
+            fmpz_sub(t, t, poly2 + i);
+    }
+
+    bits1 = FLINT_ABS(_fmpz_vec_max_bits(poly1, len1));
+    bits2 = FLINT_ABS(_fmpz_vec_max_bits(poly2, len2));
+    bound = FLINT_BIT_COUNT(len1) + (len1 - 1) * fmpz_bits(t);
+    bound = FLINT_MIN(bound, (n - 1) * bits2) + bits1 + 1;
+
+    fmpz_clear(t);
+
+    arg.poly1 = poly1;
+    arg.len1 = len1;
+    arg.poly2 = poly2;
+    arg.len2 = len2;
+    arg.n = n;
+
+    _fmpz_vec_multi_mod_CRT_threaded(res, n, _fmpz_poly_compose_series_image,
+                                      &arg, FLINT_BITS - 1, bound, 0);
+}
+
+void
+fmpz_poly_compose_series_multi_mod(fmpz_poly_t res,
+                    const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n)
+{
+    slong len1 = poly1->length;
+    slong len2 = poly2->length;
+    slong lenr;
+
+    if (len2 != 0 && !fmpz_is_zero(poly2->coeffs))
+    {
+        flint_printf("Exception (fmpz_poly_compose_series_multi_mod). Inner \n"
+               "polynomial must have zero constant term.\n");
+        flint_abort();
+    }
+
+    if (len1 == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len2 == 0 || len1 == 1)
+    {
+        fmpz_poly_set_fmpz(res, poly1->coeffs);
+        return;
+    }
+
+    lenr = FLINT_MIN((len1 - 1) * (len2 - 1) + 1, n);
+    len1 = FLINT_MIN(len1, lenr);
+    len2 = FLINT_MIN(len2, lenr);
+
+    if ((res != poly1) && (res != poly2))
+    {
+        fmpz_poly_fit_length(res, lenr);
+        _fmpz_poly_compose_series_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                             poly2->coeffs, len2, lenr);
+        _fmpz_poly_set_length(res, lenr);
+        _fmpz_poly_normalise(res);
+    }
+    else
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, lenr);
+        _fmpz_poly_compose_series_multi_mod(t->coeffs, poly1->coeffs, len1,
+                                             poly2->coeffs, len2, lenr);
+        _fmpz_poly_set_length(t, lenr);
+        _fmpz_poly_normalise(t);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+}
@@ -0,0 +1,162 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    mp_ptr * vals;
+    mp_ptr * polys;
+    slong plen;
+    fmpz_poly_multipoint_precomp_struct * T;
+    slong p0;
+    slong p1;
+}
+evaluate_arg_t;
+
+static void
+_fmpz_poly_evaluate_fmpz_vec_fast_range(const evaluate_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_t mod;
+
+        nmod_init(&mod, arg->T->primes[i]);
+        _nmod_poly_evaluate_nmod_vec_fast_scaled_precomp(arg->vals[i],
+            arg->polys[i], arg->plen, (const mp_ptr *) arg->T->trees[i],
+            arg->T->rinv[i], arg->T->len, mod);
+    }
+}
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+static void *
+_fmpz_poly_evaluate_fmpz_vec_fast_worker(void * arg_ptr)
+{
+    _fmpz_poly_evaluate_fmpz_vec_fast_range((evaluate_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
+void
+_fmpz_poly_evaluate_fmpz_vec_fast_precomp(fmpz * ys, const fmpz * poly,
+                           slong plen, fmpz_poly_multipoint_precomp_t T)
+{
+    slong i, len = T->len, num_primes, num_threads;
+    mp_bitcnt_t bits;
+    mp_ptr * polys, * vals;
+    evaluate_arg_t * args;
+
+    if (len == 0)
+        return;
+
+    if (plen == 0)
+    {
+        _fmpz_vec_zero(ys, len);
+        return;
+    }
+
+    /* |f(x_i)| < plen 2^(fbits + (plen - 1) xbits), plus a sign bit */
+    bits = FLINT_ABS(_fmpz_vec_max_bits(poly, plen));
+    bits += (plen - 1) * T->xbits + FLINT_BIT_COUNT(plen) + 1;
+    num_primes = (bits + FLINT_BITS - 2) / (FLINT_BITS - 1);
+
+    _fmpz_poly_multipoint_fit_primes(T, num_primes);
+
+    polys = flint_malloc(sizeof(mp_ptr) * num_primes);
+    vals = flint_malloc(sizeof(mp_ptr) * num_primes);
+    for (i = 0; i < num_primes; i++)
+    {
+        polys[i] = _nmod_vec_init(plen);
+        vals[i] = _nmod_vec_init(len);
+    }
+
+    _fmpz_vec_multi_mod_ui_threaded(polys, (fmpz *) poly, plen,
+                                    T->primes, num_primes, 0);
+
+    /* the primes are split between the threads */
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+    args = flint_malloc(sizeof(evaluate_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].vals = vals;
+        args[i].polys = polys;
+        args[i].plen = plen;
+        args[i].T = T;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+    }
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    if (num_threads > 1)
+    {
+        pthread_t * threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL,
+                _fmpz_poly_evaluate_fmpz_vec_fast_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+    }
+    else
+#endif
+    {
+        for (i = 0; i < num_threads; i++)
+            _fmpz_poly_evaluate_fmpz_vec_fast_range(&args[i]);
+    }
+
+    flint_free(args);
+
+    _fmpz_vec_multi_mod_ui_threaded(vals, ys, len, T->primes, num_primes, 1);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        _nmod_vec_clear(polys[i]);
+        _nmod_vec_clear(vals[i]);
+    }
+    flint_free(polys);
+    flint_free(vals);
+}
+
+void
+fmpz_poly_evaluate_fmpz_vec_fast_precomp(fmpz * ys,
+                const fmpz_poly_t poly, fmpz_poly_multipoint_precomp_t T)
+{
+    _fmpz_poly_evaluate_fmpz_vec_fast_precomp(ys, poly->coeffs,
+                                              poly->length, T);
+}
+
+void
+fmpz_poly_evaluate_fmpz_vec_fast(fmpz * ys, const fmpz_poly_t poly,
+                                                const fmpz * xs, slong n)
+{
+    fmpz_poly_multipoint_precomp_t T;
+
+    fmpz_poly_multipoint_precompute(T, xs, n);
+    fmpz_poly_evaluate_fmpz_vec_fast_precomp(ys, poly, T);
+    fmpz_poly_multipoint_clear(T);
+}
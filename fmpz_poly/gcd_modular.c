@@ -16,6 +16,45 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    const fmpz * l;
+}
+gcd_arg_t;
+
+/* computes the gcd modulo p, or returns 0 if p divides a leading coeff */
+static slong
+_fmpz_poly_gcd_image(mp_ptr h, mp_limb_t p, void * arg_ptr)
+{
+    gcd_arg_t * arg = (gcd_arg_t *) arg_ptr;
+    mp_ptr a, b;
+    nmod_t mod;
+    slong hlen;
+
+    if (fmpz_fdiv_ui(arg->l, p) == 0)
+        return 0;
+
+    nmod_init(&mod, p);
+
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    /* reduce polynomials modulo p */
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    /* compute gcd over Z/pZ */
+    hlen = _nmod_poly_gcd(h, a, arg->len1, b, arg->len2, mod);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+
+    return hlen;
+}
 
 void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -23,11 +62,12 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     mp_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
     fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
     fmpz * A, * B, * Q, * lead_A, * lead_B;
-    mp_ptr a, b, h;
+    mp_ptr h, primes, * images;
     mp_limb_t p, h_inv, g_mod;
     nmod_t mod;
-    slong i, n, n0, unlucky, hlen, bound;
+    slong i, n, n0, unlucky, hlen, bound, num_threads, batch, * status;
     int g_pm1;
+    gcd_arg_t arg;
 
     fmpz_init(ac);
     fmpz_init(bc);
@@ -126,10 +166,21 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     Q = _fmpz_vec_init(len1);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    h = _nmod_vec_init(len2);
+    /* primes are taken in batches of one per thread and the gcds modulo
+       the primes of a batch are computed in parallel */
+    num_threads = flint_get_num_threads();
+    primes = _nmod_vec_init(num_threads);
+    status = flint_malloc(sizeof(slong) * num_threads);
+    images = flint_malloc(sizeof(mp_ptr) * num_threads);
+    for (i = 0; i < num_threads; i++)
+        images[i] = _nmod_vec_init(len2);
+    batch = 0;
+
+    arg.A = A;
+    arg.len1 = len1;
+    arg.B = B;
+    arg.len2 = len2;
+    arg.l = l;
 
     /* zero entire output */
     _fmpz_vec_zero(res, len2);
@@ -145,22 +196,33 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     for (;;)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
+        /* get new batch of primes and their gcds */
+        if (batch == 0)
+        {
+            for (i = 0; i < num_threads; i++)
+            {
+                p = n_nextprime(p, 0);
+                primes[num_threads - i - 1] = p;
+            }
+
+            _fmpz_vec_multi_mod_images_threaded(images, status, primes,
+                                   num_threads, _fmpz_poly_gcd_image, &arg);
+            batch = num_threads;
+        }
+
+        /* take the primes of the batch in increasing order */
+        batch--;
+        p = primes[batch];
+        hlen = status[batch];
+        h = images[batch];
+
+        if (hlen == 0) /* p divides the leading coefficients */
         {
             unlucky += pbits;
             continue;
         }
         nmod_init(&mod, p);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
-
-        /* compute gcd over Z/pZ */
-        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
-
         if (hlen == 1) /* gcd is 1 */
         {
             fmpz_one(res);
@@ -278,9 +340,11 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     fmpz_clear(l); 
     fmpz_clear(hc);
 
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-    _nmod_vec_clear(h); 
+    for (i = 0; i < num_threads; i++)
+        _nmod_vec_clear(images[i]);
+    flint_free(images);
+    flint_free(status);
+    _nmod_vec_clear(primes);
 
     /* finally multiply by content */
     _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
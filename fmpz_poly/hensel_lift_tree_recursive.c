@@ -10,11 +10,39 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
 
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+    slong num_threads;
+}
+hensel_lift_tree_arg_t;
+
+void *
+_fmpz_poly_hensel_lift_tree_worker(void * arg_ptr)
+{
+    hensel_lift_tree_arg_t * arg = (hensel_lift_tree_arg_t *) arg_ptr;
+
+    flint_set_num_threads(arg->num_threads);
+    fmpz_poly_hensel_lift_tree_recursive(arg->link, arg->v, arg->w, arg->f,
+                                         arg->j, arg->inv, arg->p0, arg->p1);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
     const fmpz_t p0, const fmpz_t p1)
@@ -33,10 +61,43 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
                                                   v[j], v[j+1], w[j], w[j+1], 
                                                   p0, p1);
 
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
-            inv, p0, p1);
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
-            inv, p0, p1);
+        /*
+            The two subtrees involve disjoint entries of v and w, so they can
+            be lifted in parallel, each with half of the threads. Small
+            subtrees are not worth the cost of starting a thread.
+        */
+        if (flint_get_num_threads() > 1 && link[j] >= 0 && link[j + 1] >= 0
+            && FLINT_MIN(v[j]->length, v[j + 1]->length) >= 64)
+        {
+            pthread_t threads[2];
+            hensel_lift_tree_arg_t args[2];
+            slong k;
+
+            for (k = 0; k < 2; k++)
+            {
+                args[k].link = link;
+                args[k].v = v;
+                args[k].w = w;
+                args[k].f = v[j + k];
+                args[k].j = link[j + k];
+                args[k].inv = inv;
+                args[k].p0 = p0;
+                args[k].p1 = p1;
+                args[k].num_threads = flint_get_num_threads() / 2;
+
+                pthread_create(&threads[k], NULL,
+                               _fmpz_poly_hensel_lift_tree_worker, &args[k]);
+            }
+
+            pthread_join(threads[0], NULL);
+            pthread_join(threads[1], NULL);
+        }
+        else
+        {
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
+                inv, p0, p1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
+                inv, p0, p1);
+        }
     }
 }
-
@@ -0,0 +1,203 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    mp_ptr * polys;
+    mp_ptr * ys;
+    fmpz_poly_multipoint_precomp_struct * T;
+    slong p0;
+    slong p1;
+}
+interpolate_arg_t;
+
+static void
+_fmpz_poly_interpolate_multi_mod_range(const interpolate_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_t mod;
+
+        nmod_init(&mod, arg->T->primes[i]);
+        _nmod_poly_interpolate_nmod_vec_fast_precomp(arg->polys[i],
+            arg->ys[i], (const mp_ptr *) arg->T->trees[i],
+            arg->T->weights[i], arg->T->len, mod);
+    }
+}
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+static void *
+_fmpz_poly_interpolate_multi_mod_worker(void * arg_ptr)
+{
+    _fmpz_poly_interpolate_multi_mod_range((interpolate_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
+void
+_fmpz_poly_interpolate_multi_mod(fmpz * poly, const fmpz * ys,
+                      fmpz_poly_multipoint_precomp_t T, slong num_primes)
+{
+    slong i, len = T->len, num_threads;
+    mp_ptr * yr, * polys;
+    interpolate_arg_t * args;
+
+    _fmpz_poly_multipoint_fit_primes(T, num_primes);
+    _fmpz_poly_multipoint_fit_weights(T);
+
+    yr = flint_malloc(sizeof(mp_ptr) * num_primes);
+    polys = flint_malloc(sizeof(mp_ptr) * num_primes);
+    for (i = 0; i < num_primes; i++)
+    {
+        yr[i] = _nmod_vec_init(len);
+        polys[i] = _nmod_vec_init(len);
+    }
+
+    _fmpz_vec_multi_mod_ui_threaded(yr, (fmpz *) ys, len,
+                                    T->primes, num_primes, 0);
+
+    /* the primes are split between the threads */
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+    args = flint_malloc(sizeof(interpolate_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].polys = polys;
+        args[i].ys = yr;
+        args[i].T = T;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+    }
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    if (num_threads > 1)
+    {
+        pthread_t * threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL,
+                _fmpz_poly_interpolate_multi_mod_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+    }
+    else
+#endif
+    {
+        for (i = 0; i < num_threads; i++)
+            _fmpz_poly_interpolate_multi_mod_range(&args[i]);
+    }
+
+    flint_free(args);
+
+    _fmpz_vec_multi_mod_ui_threaded(polys, poly, len,
+                                    T->primes, num_primes, 1);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        _nmod_vec_clear(yr[i]);
+        _nmod_vec_clear(polys[i]);
+    }
+    flint_free(yr);
+    flint_free(polys);
+}
+
+void
+fmpz_poly_interpolate_fmpz_vec_fast_precomp(fmpz_poly_t poly,
+                        const fmpz * ys, fmpz_poly_multipoint_precomp_t T)
+{
+    slong len = T->len, plen, num_primes;
+    mp_bitcnt_t bits;
+    fmpz * t, * v;
+    int exact;
+
+    if (len == 0)
+    {
+        fmpz_poly_zero(poly);
+        return;
+    }
+    else if (len == 1)
+    {
+        fmpz_poly_set_fmpz(poly, ys);
+        return;
+    }
+
+    if (!T->distinct)
+    {
+        flint_printf("Exception (fmpz_poly_interpolate_fmpz_vec_fast). "
+                     "Repeated points.\n");
+        flint_abort();
+    }
+
+    /*
+        If the interpolating polynomial is integral, so are its divided
+        differences, which are bounded by len 2^ybits. The Newton basis
+        polynomials have coefficients bounded by 2^((len - 1) xbits).
+    */
+    bits = FLINT_ABS(_fmpz_vec_max_bits(ys, len));
+    bits += (len - 1) * T->xbits + 2 * FLINT_BIT_COUNT(len) + 1;
+    num_primes = (bits + FLINT_BITS - 2) / (FLINT_BITS - 1);
+
+    t = _fmpz_vec_init(len);
+    v = _fmpz_vec_init(len);
+
+    _fmpz_poly_interpolate_multi_mod(t, ys, T, num_primes);
+
+    plen = len;
+    while (plen > 0 && fmpz_is_zero(t + plen - 1))
+        plen--;
+
+    /* otherwise we have only found the interpolant modulo some integer */
+    _fmpz_poly_evaluate_fmpz_vec_fast_precomp(v, t, plen, T);
+    exact = _fmpz_vec_equal(v, ys, len);
+
+    if (exact)
+    {
+        fmpz_poly_fit_length(poly, len);
+        _fmpz_vec_swap(poly->coeffs, t, plen);
+        _fmpz_poly_set_length(poly, plen);
+    }
+
+    _fmpz_vec_clear(t, len);
+    _fmpz_vec_clear(v, len);
+
+    if (!exact)
+        flint_throw(FLINT_INEXACT, "Not an exact division in "
+                    "fmpz_poly_interpolate_fmpz_vec_fast");
+}
+
+void
+fmpz_poly_interpolate_fmpz_vec_fast(fmpz_poly_t poly,
+                                 const fmpz * xs, const fmpz * ys, slong n)
+{
+    fmpz_poly_multipoint_precomp_t T;
+
+    fmpz_poly_multipoint_precompute(T, xs, n);
+    fmpz_poly_interpolate_fmpz_vec_fast_precomp(poly, ys, T);
+    fmpz_poly_multipoint_clear(T);
+}
@@ -0,0 +1,331 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+/* number of sign changes in the sequence of coefficients, ignoring zeros */
+static slong
+_fmpz_vec_sign_changes(const fmpz * vec, slong len)
+{
+    slong i, v = 0;
+    int s = 0, t;
+
+    for (i = 0; i < len; i++)
+    {
+        t = fmpz_sgn(vec + i);
+
+        if (t != 0)
+        {
+            if (s != 0 && t != s)
+                v++;
+            s = t;
+        }
+    }
+
+    return v;
+}
+
+/*
+    Composes (poly, len) with x + 1 in-place. The multimodular shift only
+    pays off when the coefficients are small compared to the length.
+*/
+static void
+_fmpz_poly_taylor_shift_one(fmpz * poly, slong len)
+{
+    fmpz_t one;
+
+    fmpz_init_set_ui(one, 1);
+
+    if (flint_get_num_threads() > 1 && len >= 256 &&
+        FLINT_ABS(_fmpz_vec_max_bits(poly, len)) < len)
+        _fmpz_poly_taylor_shift_multi_mod_threaded(poly, one, len);
+    else
+        _fmpz_poly_taylor_shift(poly, one, len);
+
+    fmpz_clear(one);
+}
+
+/*
+    Returns the number of sign variations of (x + 1)^(len - 1) q(1 / (x + 1)),
+    using t as scratch space.
+
+    As the Taylor shift has nonnegative binomial coefficients, shifting the
+    reversal of q truncated to its top len + 64 bits, rounded down, gives
+    the j-th coefficient up to an error less than binomial(len, j + 1) in
+    the last place. The exact shift is only done if this does not determine
+    all the signs.
+*/
+static slong
+_fmpz_poly_descartes_test(fmpz * t, const fmpz * q, slong len)
+{
+    slong i, s, v;
+    int sgn, prev;
+
+    s = FLINT_ABS(_fmpz_vec_max_bits(q, len)) - len - 64;
+
+    if (s > 64)
+    {
+        fmpz_t u, w;
+
+        fmpz_init(u);
+        fmpz_init(w);
+
+        for (i = 0; i < len; i++)
+            fmpz_fdiv_q_2exp(t + i, q + len - i - 1, s);
+
+        _fmpz_poly_taylor_shift_one(t, len);
+
+        prev = 0;
+        v = 0;
+        fmpz_set_ui(u, len);
+
+        for (i = 0; i < len && v >= 0; i++)
+        {
+            if (fmpz_sgn(t + i) > 0)
+                sgn = 1;
+            else
+            {
+                fmpz_add(w, t + i, u);
+                sgn = (fmpz_sgn(w) < 0) ? -1 : 0;
+            }
+
+            if (sgn == 0)
+                v = -1;
+            else
+            {
+                if (prev != 0 && sgn != prev)
+                    v++;
+                prev = sgn;
+            }
+
+            /* binomial(len, i + 2) */
+            fmpz_mul_ui(u, u, len - i - 1);
+            fmpz_divexact_ui(u, u, i + 2);
+        }
+
+        fmpz_clear(u);
+        fmpz_clear(w);
+
+        if (v >= 0)
+            return v;
+    }
+
+    _fmpz_poly_reverse(t, q, len, len);
+    _fmpz_poly_taylor_shift_one(t, len);
+
+    return _fmpz_vec_sign_changes(t, len);
+}
+
+/*
+    Writes the isolating intervals for the roots of the squarefree
+    polynomial (q, len) in (0, 1) to a, b, exp and returns their number.
+    The unit interval corresponds to (c, c + 1) 2^(e - k) in the original
+    variable. The number of sign variations of the Descartes test is
+    written to v. The polynomial q is destroyed.
+*/
+static slong
+_fmpz_poly_isolate_real_roots_01(fmpz * a, fmpz * b, slong * exp, slong * v,
+                    fmpz * q, slong len, const fmpz_t c, slong k, slong e)
+{
+    fmpz * t;
+    slong n = 0, off = 0, vl, vr;
+
+    t = _fmpz_vec_init(len);
+
+    /* Descartes' rule of signs */
+    *v = _fmpz_poly_descartes_test(t, q, len);
+
+    if (*v == 1)
+    {
+        fmpz_set(a, c);
+        fmpz_add_ui(b, c, 1);
+        exp[0] = e - k;
+        n = 1;
+    }
+    else if (*v > 1)
+    {
+        fmpz_t d;
+
+        fmpz_init(d);
+
+        /* 2^(len - 1) q(x / 2) */
+        _fmpz_poly_scale_2exp(q, len, -1);
+        _fmpz_vec_set(t, q, len);
+
+        fmpz_mul_2exp(d, c, 1);
+        n = _fmpz_poly_isolate_real_roots_01(a, b, exp, &vl,
+                                             q, len, d, k + 1, e);
+
+        /*
+            The sign variations for the two halves and the midpoint add up
+            to at most those for the whole interval, so the right half can
+            often be discarded without any further Taylor shifts.
+        */
+        if (vl < *v)
+        {
+            /* 2^(len - 1) q((x + 1) / 2) */
+            _fmpz_poly_taylor_shift_one(t, len);
+            _fmpz_poly_remove_content_2exp(t, len);
+
+            fmpz_add_ui(d, d, 1);
+
+            /* the midpoint is a root */
+            if (fmpz_is_zero(t))
+            {
+                fmpz_set(a + n, d);
+                fmpz_set(b + n, d);
+                exp[n] = e - k - 1;
+                n++;
+                off = 1;
+            }
+
+            if (vl + off < *v)
+                n += _fmpz_poly_isolate_real_roots_01(a + n, b + n, exp + n,
+                                   &vr, t + off, len - off, d, k + 1, e);
+        }
+
+        fmpz_clear(d);
+    }
+
+    _fmpz_vec_clear(t, len);
+
+    return n;
+}
+
+slong
+_fmpz_poly_isolate_real_roots(fmpz * a, fmpz * b, slong * exp,
+                              const fmpz * pol, slong len)
+{
+    fmpz * q;
+    fmpz_t c;
+    slong i, j, e, n, m, v;
+
+    /* roots at zero */
+    i = 0;
+    while (i < len && fmpz_is_zero(pol + i))
+        i++;
+    pol += i;
+    len -= i;
+
+    n = 0;
+
+    if (len <= 1)
+    {
+        if (i > 0)
+        {
+            fmpz_zero(a);
+            fmpz_zero(b);
+            exp[0] = 0;
+            n = 1;
+        }
+
+        return n;
+    }
+
+    fmpz_init(c);
+    q = _fmpz_vec_init(len);
+
+    /* all roots are less than 2^e in absolute value */
+    _fmpz_poly_bound_roots(c, pol, len);
+    e = fmpz_bits(c);
+    fmpz_zero(c);
+
+    /* negative roots, from the positive roots of pol(-2^e x) */
+    for (j = 0; j < len; j++)
+    {
+        if (j % 2 == 0)
+            fmpz_set(q + j, pol + j);
+        else
+            fmpz_neg(q + j, pol + j);
+    }
+
+    _fmpz_poly_scale_2exp(q, len, e);
+    n = _fmpz_poly_isolate_real_roots_01(a, b, exp, &v, q, len, c, 0, e);
+
+    for (j = 0; j < n; j++)
+    {
+        fmpz_swap(a + j, b + j);
+        fmpz_neg(a + j, a + j);
+        fmpz_neg(b + j, b + j);
+    }
+
+    for (j = 0; j < n / 2; j++)
+    {
+        fmpz_swap(a + j, a + n - j - 1);
+        fmpz_swap(b + j, b + n - j - 1);
+        m = exp[j];
+        exp[j] = exp[n - j - 1];
+        exp[n - j - 1] = m;
+    }
+
+    if (i > 0)
+    {
+        fmpz_zero(a + n);
+        fmpz_zero(b + n);
+        exp[n] = 0;
+        n++;
+    }
+
+    /* positive roots, from those of pol(2^e x) */
+    _fmpz_vec_set(q, pol, len);
+    _fmpz_poly_scale_2exp(q, len, e);
+    n += _fmpz_poly_isolate_real_roots_01(a + n, b + n, exp + n, &v,
+                                          q, len, c, 0, e);
+
+    _fmpz_vec_clear(q, len);
+    fmpz_clear(c);
+
+    return n;
+}
+
+slong
+fmpz_poly_isolate_real_roots(fmpz * a, fmpz * b, slong * exp,
+                             const fmpz_poly_t pol)
+{
+    fmpz_poly_t g, f;
+    slong n;
+
+    if (fmpz_poly_is_zero(pol))
+    {
+        flint_printf("Exception (fmpz_poly_isolate_real_roots). "
+                     "Zero polynomial.\n");
+        flint_abort();
+    }
+
+    if (pol->length <= 2)
+        return _fmpz_poly_isolate_real_roots(a, b, exp,
+                                             pol->coeffs, pol->length);
+
+    /* isolate the roots of the squarefree part */
+    fmpz_poly_init(g);
+    fmpz_poly_init(f);
+
+    fmpz_poly_derivative(g, pol);
+    fmpz_poly_gcd(g, pol, g);
+
+    if (g->length > 1)
+    {
+        fmpz_poly_div(f, pol, g);
+        n = _fmpz_poly_isolate_real_roots(a, b, exp, f->coeffs, f->length);
+    }
+    else
+        n = _fmpz_poly_isolate_real_roots(a, b, exp,
+                                          pol->coeffs, pol->length);
+
+    fmpz_poly_clear(g);
+    fmpz_poly_clear(f);
+
+    return n;
+}
@@ -0,0 +1,42 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+
+void
+fmpz_poly_mod_ctx_init(fmpz_poly_mod_ctx_t ctx, const fmpz_poly_t B)
+{
+    slong len = B->length;
+
+    if (len == 0 || !fmpz_is_pm1(B->coeffs + len - 1))
+    {
+        flint_printf("Exception (fmpz_poly_mod_ctx_init). Modulus must have\n"
+               "leading coefficient +1 or -1.\n");
+        flint_abort();
+    }
+
+    fmpz_poly_init2(&ctx->poly, len);
+    fmpz_poly_init2(&ctx->inv, len);
+
+    fmpz_poly_set(&ctx->poly, B);
+    _fmpz_poly_preinvert(ctx->inv.coeffs, B->coeffs, len);
+    _fmpz_poly_set_length(&ctx->inv, len);
+}
+
+void
+fmpz_poly_mod_ctx_clear(fmpz_poly_mod_ctx_t ctx)
+{
+    fmpz_poly_clear(&ctx->poly);
+    fmpz_poly_clear(&ctx->inv);
+}
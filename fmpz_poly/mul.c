@@ -143,6 +143,28 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    /*
+        The per prime products are independent, but serially multi_mod
+        costs 2.5-4 times a KS or SS product for len2 >= 256 and small
+        coefficients, rising to 5-7 times for a thousand bits or more and
+        for shorter inputs. It only pays when about that many threads can
+        work at once, and no more threads than primes can.
+    */
+    if (len2 >= 128 && limbs1 + limbs2 <= 32)
+    {
+        slong num_threads = flint_get_num_threads();
+        slong num_primes = (bits1 + bits2) / (FLINT_BITS - 1) + 1;
+
+        if (FLINT_MIN(num_threads, num_primes)
+                >= 4 + (bits1 + bits2) / 512 + 2 * (len2 < 256))
+        {
+            _fmpz_poly_mul_multi_mod(res, poly1, len1, poly2, len2);
+            return;
+        }
+    }
+#endif
+
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
     else if (limbs1 + limbs2 <= 8)
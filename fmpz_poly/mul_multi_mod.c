@@ -0,0 +1,217 @@
+/*
+    Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    mp_ptr * res;
+    mp_ptr * residues1;
+    slong len1;
+    mp_ptr * residues2;
+    slong len2;
+    mp_srcptr primes;
+    slong p0;
+    slong p1;
+}
+mul_multi_mod_arg_t;
+
+static void
+_fmpz_poly_mul_multi_mod_range(const mul_multi_mod_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_t mod;
+
+        nmod_init(&mod, arg->primes[i]);
+
+        if (arg->residues1 == arg->residues2)
+            _nmod_poly_mul(arg->res[i], arg->residues1[i], arg->len1,
+                                        arg->residues1[i], arg->len1, mod);
+        else
+            _nmod_poly_mul(arg->res[i], arg->residues1[i], arg->len1,
+                                        arg->residues2[i], arg->len2, mod);
+    }
+}
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+static void *
+_fmpz_poly_mul_multi_mod_worker(void * arg_ptr)
+{
+    _fmpz_poly_mul_multi_mod_range((mul_multi_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
+void
+_fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1, slong len1,
+                                     const fmpz * poly2, slong len2)
+{
+    slong bits1, bits2, rbits, rlen, num_primes, num_threads, i;
+    mp_ptr primes;
+    mp_ptr * residues1, * residues2, * residues;
+    mul_multi_mod_arg_t * args;
+
+    rlen = len1 + len2 - 1;
+
+    bits1 = FLINT_ABS(_fmpz_vec_max_bits(poly1, len1));
+    bits2 = (poly1 == poly2) ? bits1 :
+                               FLINT_ABS(_fmpz_vec_max_bits(poly2, len2));
+
+    if (bits1 == 0 || bits2 == 0)
+    {
+        _fmpz_vec_zero(res, rlen);
+        return;
+    }
+
+    /* output coefficients are at most len2 * 2^(bits1 + bits2) in absolute
+       value, one more bit for the sign of the symmetric remainder */
+    rbits = bits1 + bits2 + FLINT_BIT_COUNT(FLINT_MIN(len1, len2)) + 1;
+
+    /* Use primes greater than 2^(FLINT_BITS-1) */
+    num_primes = (rbits + (FLINT_BITS - 1) - 1) / (FLINT_BITS - 1);
+    primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    primes[0] = n_nextprime(UWORD(1) << (FLINT_BITS - 1), 1);
+    for (i = 1; i < num_primes; i++)
+        primes[i] = n_nextprime(primes[i - 1], 1);
+
+    /* Space for the inputs and the product reduced modulo the primes */
+    residues1 = flint_malloc(sizeof(mp_ptr) * num_primes);
+    residues = flint_malloc(sizeof(mp_ptr) * num_primes);
+    for (i = 0; i < num_primes; i++)
+    {
+        residues1[i] = flint_malloc(sizeof(mp_limb_t) * len1);
+        residues[i] = flint_malloc(sizeof(mp_limb_t) * rlen);
+    }
+
+    _fmpz_vec_multi_mod_ui_threaded(residues1, (fmpz *) poly1, len1,
+                                                      primes, num_primes, 0);
+
+    if (poly1 == poly2 && len1 == len2)
+        residues2 = residues1;
+    else
+    {
+        residues2 = flint_malloc(sizeof(mp_ptr) * num_primes);
+        for (i = 0; i < num_primes; i++)
+            residues2[i] = flint_malloc(sizeof(mp_limb_t) * len2);
+
+        _fmpz_vec_multi_mod_ui_threaded(residues2, (fmpz *) poly2, len2,
+                                                      primes, num_primes, 0);
+    }
+
+    /* one product per prime, the primes are split between the threads */
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+    args = flint_malloc(sizeof(mul_multi_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = residues;
+        args[i].residues1 = residues1;
+        args[i].len1 = len1;
+        args[i].residues2 = residues2;
+        args[i].len2 = len2;
+        args[i].primes = primes;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+    }
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+    if (num_threads > 1)
+    {
+        pthread_t * threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL,
+                _fmpz_poly_mul_multi_mod_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+    }
+    else
+#endif
+    {
+        for (i = 0; i < num_threads; i++)
+            _fmpz_poly_mul_multi_mod_range(&args[i]);
+    }
+
+    flint_free(args);
+
+    _fmpz_vec_multi_mod_ui_threaded(residues, res, rlen, primes, num_primes, 1);
+
+    if (residues2 != residues1)
+    {
+        for (i = 0; i < num_primes; i++)
+            flint_free(residues2[i]);
+        flint_free(residues2);
+    }
+
+    for (i = 0; i < num_primes; i++)
+    {
+        flint_free(residues1[i]);
+        flint_free(residues[i]);
+    }
+    flint_free(residues1);
+    flint_free(residues);
+    flint_free(primes);
+}
+
+void
+fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                        const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+    slong rlen;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    rlen = len1 + len2 - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, rlen);
+        fmpz_poly_mul_multi_mod(t, poly1, poly2);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+        return;
+    }
+
+    fmpz_poly_fit_length(res, rlen);
+    if (len1 >= len2)
+        _fmpz_poly_mul_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                              poly2->coeffs, len2);
+    else
+        _fmpz_poly_mul_multi_mod(res->coeffs, poly2->coeffs, len2,
+                                              poly1->coeffs, len1);
+    _fmpz_poly_set_length(res, rlen);
+}
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+/* Assumes len1 >= len2 > 0 */
+void
+_fmpz_poly_mulmid(fmpz * res, const fmpz * poly1, slong len1,
+                              const fmpz * poly2, slong len2)
+{
+    mp_size_t limbs1, limbs2;
+    slong bits1, bits2, len_out = len1 - len2 + 1;
+
+    if (len2 < 7 || len_out < 7)
+    {
+        _fmpz_poly_mulmid_classical(res, poly1, len1, poly2, len2);
+        return;
+    }
+
+    bits1 = FLINT_ABS(_fmpz_vec_max_bits(poly1, len1));
+    bits2 = FLINT_ABS(_fmpz_vec_max_bits(poly2, len2));
+
+    limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
+    limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
+
+    /* the cyclic SS product has a transform half the length of the one
+       for the low product, so it wins over KS much earlier than for mullow */
+    if (limbs1 + limbs2 <= 4
+        || (limbs1 + limbs2) / 2048 > len1 + len2
+        || (limbs1 + limbs2) * FLINT_BITS * 16 <= len1)
+    {
+        fmpz * t = _fmpz_vec_init(len1);
+
+        _fmpz_poly_mullow(t, poly1, len1, poly2, len2, len1);
+        _fmpz_vec_swap(res, t + len2 - 1, len_out);
+
+        _fmpz_vec_clear(t, len1);
+    }
+    else
+        _fmpz_poly_mulmid_SS(res, poly1, len1, poly2, len2);
+}
+
+void
+fmpz_poly_mulmid(fmpz_poly_t res,
+                 const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+    slong len_out;
+
+    if (len1 == 0 || len2 == 0 || len1 < len2)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    len_out = len1 - len2 + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, len_out);
+        _fmpz_poly_mulmid(t->coeffs, poly1->coeffs, len1,
+                                     poly2->coeffs, len2);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, len_out);
+        _fmpz_poly_mulmid(res->coeffs, poly1->coeffs, len1,
+                                       poly2->coeffs, len2);
+    }
+
+    _fmpz_poly_set_length(res, len_out);
+    _fmpz_poly_normalise(res);
+}
@@ -0,0 +1,195 @@
+/*
+    Copyright (C) 2008-2011 William Hart
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fft.h"
+#include "fft_tuning.h"
+#include "flint.h"
+
+#if HAVE_OPENMP
+#include <omp.h> /* must be after flint.h */
+#endif
+
+/*
+    The coefficients len2 - 1, ..., len1 - 1 of the product are not affected
+    when it is reduced modulo x^L - 1 with L >= len1, since the coefficients
+    at and above L wrap around below len2 - 1. Thus a full cyclic convolution
+    of length 2^ceil(log2(len1)) suffices, instead of the transform of length
+    len1 + len2 - 1 needed for the whole product.
+*/
+
+/* Assumes len1 >= len2 > 0 */
+void _fmpz_poly_mulmid_SS(fmpz * output, const fmpz * input1, slong len1,
+               const fmpz * input2, slong len2)
+{
+    slong len_out, loglen, loglen2, n;
+    slong output_bits, limbs, size, i;
+    mp_limb_t * ptr, ** t1, ** t2, ** tt, ** s1, ** ii, ** jj;
+    slong bits1, bits2;
+    ulong size1, size2;
+    int sign = 0;
+#if HAVE_OPENMP
+    int N;
+#endif
+    TMP_INIT;
+
+    TMP_START;
+
+    len_out = len1 - len2 + 1;
+    loglen  = FLINT_MAX(FLINT_CLOG2(len1), 2);
+    loglen2 = FLINT_CLOG2(len2);
+    n = (WORD(1) << (loglen - 2));
+
+    size1 = _fmpz_vec_max_limbs(input1, len1); 
+    size2 = _fmpz_vec_max_limbs(input2, len2);
+
+    /* Start with an upper bound on the number of bits needed */
+    output_bits = FLINT_BITS * (size1 + size2) + loglen2 + 1; 
+    
+    /* round up for sqrt2 trick */
+    output_bits = (((output_bits - 1) >> (loglen - 2)) + 1) << (loglen - 2);
+
+    limbs = (output_bits - 1) / FLINT_BITS + 1; /* initial size of FFT coeffs */
+    if (limbs > FFT_MULMOD_2EXPP1_CUTOFF) /* can't be worse than next power of 2 limbs */
+        limbs = (WORD(1) << FLINT_CLOG2(limbs));
+    size = limbs + 1;
+
+    /* allocate space for ffts */
+
+#if HAVE_OPENMP
+    N = omp_get_max_threads();
+    ii = flint_malloc((4*(n + n*size) + 5*size*N)*sizeof(mp_limb_t));
+#else
+    ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+#endif
+    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
+        ii[i] = ptr;
+#if HAVE_OPENMP
+   t1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+   t2 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+   s1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+   tt = TMP_ALLOC(N*sizeof(mp_limb_t *));
+
+   t1[0] = ptr;
+   t2[0] = t1[0] + size*N;
+   s1[0] = t2[0] + size*N;
+   tt[0] = s1[0] + size*N;
+
+   for (i = 1; i < N; i++)
+   {
+      t1[i] = t1[i - 1] + size;
+      t2[i] = t2[i - 1] + size;
+      s1[i] = s1[i - 1] + size;
+      tt[i] = tt[i - 1] + 2*size;
+   }
+#else
+   t1 = TMP_ALLOC(sizeof(mp_limb_t *));
+   t2 = TMP_ALLOC(sizeof(mp_limb_t *));
+   s1 = TMP_ALLOC(sizeof(mp_limb_t *));
+   tt = TMP_ALLOC(sizeof(mp_limb_t *));
+
+   t1[0] = ptr;
+   t2[0] = t1[0] + size;
+   s1[0] = t2[0] + size;
+   tt[0] = s1[0] + size;
+#endif   
+
+    if (input1 != input2)
+    {
+        jj = flint_malloc(4*(n + n*size)*sizeof(mp_limb_t));
+        for (i = 0, ptr = (mp_limb_t *) jj + 4*n; i < 4*n; i++, ptr += size) 
+            jj[i] = ptr;
+    } else jj = ii;
+
+    /* put coefficients into FFT vecs */
+    bits1 = _fmpz_vec_get_fft(ii, input1, limbs, len1);
+    for (i = len1; i < 4*n; i++)
+        flint_mpn_zero(ii[i], limbs + 1);
+
+    if (input1 != input2) 
+    {
+        bits2 = _fmpz_vec_get_fft(jj, input2, limbs, len2);
+        for (i = len2; i < 4*n; i++)
+            flint_mpn_zero(jj[i], limbs + 1);
+    }
+    else bits2 = bits1;
+
+    if (bits1 < WORD(0) || bits2 < WORD(0)) 
+    {
+        sign = 1;  
+        bits1 = FLINT_ABS(bits1);
+        bits2 = FLINT_ABS(bits2);
+    }
+
+    /* Recompute the number of bits/limbs now that we know how large everything is */
+    output_bits = bits1 + bits2 + loglen2 + sign;
+
+    /* round up output bits for sqrt2 */
+    output_bits = (((output_bits - 1) >> (loglen - 2)) + 1) << (loglen - 2);
+
+    limbs = (output_bits - 1) / FLINT_BITS + 1;
+    limbs = fft_adjust_limbs(limbs); /* round up limbs for Nussbaumer */
+    
+    fft_convolution(ii, jj, loglen - 2, limbs, 4*n, t1, t2, s1, tt);
+
+    /* write output */
+    _fmpz_vec_set_fft(output, len_out, ii + len2 - 1, limbs, sign);
+
+    flint_free(ii); 
+    if (input1 != input2) 
+        flint_free(jj);
+
+    TMP_END;
+}
+
+void
+fmpz_poly_mulmid_SS(fmpz_poly_t res,
+                    const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+    slong len_out;
+
+    if (len1 == 0 || len2 == 0 || len1 < len2)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len2 <= 2 || len1 - len2 < 2)
+    {
+        fmpz_poly_mulmid_classical(res, poly1, poly2);
+        return;
+    }
+
+    len_out = len1 - len2 + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, len_out);
+        _fmpz_poly_mulmid_SS(t->coeffs, poly1->coeffs, len1,
+                                        poly2->coeffs, len2);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, len_out);
+        _fmpz_poly_mulmid_SS(res->coeffs, poly1->coeffs, len1,
+                                          poly2->coeffs, len2);
+    }
+
+    _fmpz_poly_set_length(res, len_out);
+    _fmpz_poly_normalise(res);
+}
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+void
+_fmpz_poly_mulmod_preinv(fmpz * res, const fmpz * poly1, slong len1,
+                         const fmpz * poly2, slong len2,
+                         const fmpz * B, const fmpz * B_inv, slong lenB)
+{
+    const slong lenT = len1 + len2 - 1;
+    fmpz * T;
+
+    if (lenT < lenB)
+    {
+        if (len1 >= len2)
+            _fmpz_poly_mul(res, poly1, len1, poly2, len2);
+        else
+            _fmpz_poly_mul(res, poly2, len2, poly1, len1);
+        _fmpz_vec_zero(res + lenT, lenB - 1 - lenT);
+        return;
+    }
+
+    T = _fmpz_vec_init(lenT);
+
+    if (len1 >= len2)
+        _fmpz_poly_mul(T, poly1, len1, poly2, len2);
+    else
+        _fmpz_poly_mul(T, poly2, len2, poly1, len1);
+
+    _fmpz_poly_rem_preinv(res, T, lenT, B, B_inv, lenB);
+
+    _fmpz_vec_clear(T, lenT);
+}
+
+void
+fmpz_poly_mulmod_ctx(fmpz_poly_t res, const fmpz_poly_t poly1,
+                 const fmpz_poly_t poly2, const fmpz_poly_mod_ctx_t ctx)
+{
+    const slong len1 = poly1->length, len2 = poly2->length;
+    const slong lenB = ctx->poly.length;
+
+    if (len1 == 0 || len2 == 0 || lenB == 1)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len1 + len2 - 1 < lenB)
+    {
+        fmpz_poly_mul(res, poly1, poly2);
+        return;
+    }
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, lenB - 1);
+        _fmpz_poly_mulmod_preinv(t->coeffs, poly1->coeffs, len1,
+                 poly2->coeffs, len2, ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, lenB - 1);
+        _fmpz_poly_mulmod_preinv(res->coeffs, poly1->coeffs, len1,
+                 poly2->coeffs, len2, ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+    }
+
+    _fmpz_poly_set_length(res, lenB - 1);
+    _fmpz_poly_normalise(res);
+}
+
+void
+fmpz_poly_mulmod(fmpz_poly_t res, const fmpz_poly_t poly1,
+                 const fmpz_poly_t poly2, const fmpz_poly_t B)
+{
+    fmpz_poly_mod_ctx_t ctx;
+
+    if (B->length == 0 || !fmpz_is_pm1(B->coeffs + B->length - 1))
+    {
+        flint_printf("Exception (fmpz_poly_mulmod). Modulus must have\n"
+               "leading coefficient +1 or -1.\n");
+        flint_abort();
+    }
+
+    fmpz_poly_mod_ctx_init(ctx, B);
+    fmpz_poly_mulmod_ctx(res, poly1, poly2, ctx);
+    fmpz_poly_mod_ctx_clear(ctx);
+}
@@ -0,0 +1,222 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    mp_ptr * images;
+    slong * status;
+    mp_srcptr primes;
+    slong j0;
+    slong j1;
+    fmpz_multi_mod_image_func_t image;
+    void * arg;
+}
+multi_mod_image_arg_t;
+
+void *
+_fmpz_vec_multi_mod_images_worker(void * arg_ptr)
+{
+    multi_mod_image_arg_t arg = *((multi_mod_image_arg_t *) arg_ptr);
+    slong j;
+
+    for (j = arg.j0; j < arg.j1; j++)
+        arg.status[j] = arg.image(arg.images[j], arg.primes[j], arg.arg);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_fmpz_vec_multi_mod_images_threaded(mp_ptr * images, slong * status,
+    mp_srcptr primes, slong num_primes, fmpz_multi_mod_image_func_t image,
+    void * arg)
+{
+    pthread_t * threads;
+    multi_mod_image_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < num_primes; i++)
+            status[i] = image(images[i], primes[i], arg);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(multi_mod_image_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].images = images;
+        args[i].status = status;
+        args[i].primes = primes;
+        args[i].j0 = (num_primes * i) / num_threads;
+        args[i].j1 = (num_primes * (i + 1)) / num_threads;
+        args[i].image = image;
+        args[i].arg = arg;
+
+        pthread_create(&threads[i], NULL,
+            _fmpz_vec_multi_mod_images_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+int
+_fmpz_vec_multi_mod_CRT_threaded(fmpz * res, slong len,
+    fmpz_multi_mod_image_func_t image, void * arg, mp_bitcnt_t pbits,
+    mp_bitcnt_t bound, mp_bitcnt_t stable_bits)
+{
+    fmpz_t modulus;
+    fmpz * t = NULL;
+    mp_ptr * images;
+    mp_ptr primes;
+    slong * status;
+    slong i, j, k, num, alloc = 0, num_threads;
+    mp_bitcnt_t stable = 0;
+    mp_limb_t p;
+    int first = 1, proved, done = 0;
+
+    fmpz_init(modulus);
+    fmpz_one(modulus);
+    _fmpz_vec_zero(res, len);
+
+    if (stable_bits != 0)
+        t = _fmpz_vec_init(len);
+
+    num_threads = flint_get_num_threads();
+
+    images = NULL;
+    primes = NULL;
+    status = NULL;
+
+    p = UWORD(1) << pbits;
+
+    while (!done && fmpz_bits(modulus) <= bound)
+    {
+        /* each prime contributes at least pbits bits */
+        num = (bound + 1 - fmpz_bits(modulus) + FLINT_MAX(pbits, 1) - 1)
+                                                     / FLINT_MAX(pbits, 1);
+
+        /* if we may stop early, only do one prime per thread at a time */
+        if (stable_bits != 0)
+            num = FLINT_MIN(num, num_threads);
+
+        if (num > alloc)
+        {
+            for (j = 0; j < alloc; j++)
+                _nmod_vec_clear(images[j]);
+
+            images = flint_realloc(images, sizeof(mp_ptr) * num);
+            primes = flint_realloc(primes, sizeof(mp_limb_t) * num);
+            status = flint_realloc(status, sizeof(slong) * num);
+
+            for (j = 0; j < num; j++)
+                images[j] = _nmod_vec_init(len);
+
+            alloc = num;
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            p = n_nextprime(p, 0);
+            primes[j] = p;
+        }
+
+        _fmpz_vec_multi_mod_images_threaded(images, status, primes, num,
+                                                                image, arg);
+
+        /* discard the unlucky primes */
+        for (j = k = 0; j < num; j++)
+        {
+            if (status[j] != 0)
+            {
+                MP_PTR_SWAP(images[k], images[j]);
+                primes[k] = primes[j];
+                k++;
+            }
+        }
+
+        if (k == 0)
+            continue;
+
+        if (first && stable_bits == 0)
+        {
+            /* everything at once with a subproduct tree */
+            _fmpz_vec_multi_mod_ui_threaded(images, res, len, primes, k, 1);
+
+            for (j = 0; j < k; j++)
+                fmpz_mul_ui(modulus, modulus, primes[j]);
+        }
+        else
+        {
+            for (j = 0; j < k && !done; j++)
+            {
+                nmod_t mod;
+
+                nmod_init(&mod, primes[j]);
+
+                if (stable_bits == 0)
+                {
+                    _fmpz_poly_CRT_ui(res, res, len, modulus, images[j], len,
+                                      mod.n, mod.ninv, 1);
+                }
+                else
+                {
+                    _fmpz_poly_CRT_ui(t, res, len, modulus, images[j], len,
+                                      mod.n, mod.ninv, 1);
+
+                    /* the product of the primes since the last change */
+                    if (_fmpz_vec_equal(t, res, len))
+                        stable += FLINT_BIT_COUNT(primes[j]);
+                    else
+                        stable = FLINT_BIT_COUNT(primes[j]);
+
+                    _fmpz_vec_swap(t, res, len);
+
+                    done = (stable > stable_bits);
+                }
+
+                fmpz_mul_ui(modulus, modulus, primes[j]);
+            }
+        }
+
+        first = 0;
+    }
+
+    for (i = 0; i < alloc; i++)
+        _nmod_vec_clear(images[i]);
+    flint_free(images);
+    flint_free(primes);
+    flint_free(status);
+
+    if (stable_bits != 0)
+        _fmpz_vec_clear(t, len);
+
+    proved = (fmpz_bits(modulus) > bound);
+
+    fmpz_clear(modulus);
+
+    return proved;
+}
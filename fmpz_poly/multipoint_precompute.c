@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+static int
+_fmpz_cmp_qsort(const void * a, const void * b)
+{
+    return fmpz_cmp((const fmpz *) a, (const fmpz *) b);
+}
+
+static int
+_ulong_cmp_qsort(const void * a, const void * b)
+{
+    mp_limb_t x = *((const mp_limb_t *) a);
+    mp_limb_t y = *((const mp_limb_t *) b);
+
+    return (x < y) ? -1 : (x > y);
+}
+
+void
+fmpz_poly_multipoint_precompute(fmpz_poly_multipoint_precomp_t T,
+                                                const fmpz * xs, slong len)
+{
+    slong i;
+
+    T->xs = _fmpz_vec_init(len);
+    _fmpz_vec_set(T->xs, xs, len);
+    T->len = len;
+    T->xbits = FLINT_ABS(_fmpz_vec_max_bits(xs, len));
+
+    /* repeated points are fine for evaluation, but then we must not
+       insist on the points being distinct modulo each prime */
+    T->distinct = 1;
+    if (len > 1)
+    {
+        fmpz * t = _fmpz_vec_init(len);
+
+        _fmpz_vec_set(t, xs, len);
+        qsort(t, len, sizeof(fmpz), _fmpz_cmp_qsort);
+        for (i = 1; i < len && T->distinct; i++)
+            T->distinct = !fmpz_equal(t + i - 1, t + i);
+
+        _fmpz_vec_clear(t, len);
+    }
+
+    T->primes = NULL;
+    T->num_primes = 0;
+    T->alloc = 0;
+    T->trees = NULL;
+    T->rinv = NULL;
+    T->weights = NULL;
+}
+
+void
+fmpz_poly_multipoint_clear(fmpz_poly_multipoint_precomp_t T)
+{
+    slong i;
+
+    for (i = 0; i < T->num_primes; i++)
+    {
+        _nmod_poly_tree_free(T->trees[i], T->len);
+        flint_free(T->rinv[i]);
+        flint_free(T->weights[i]);
+    }
+
+    flint_free(T->primes);
+    flint_free(T->trees);
+    flint_free(T->rinv);
+    flint_free(T->weights);
+
+    _fmpz_vec_clear(T->xs, T->len);
+}
+
+void
+_fmpz_poly_multipoint_fit_primes(fmpz_poly_multipoint_precomp_t T,
+                                                         slong num_primes)
+{
+    slong i, len = T->len;
+    mp_limb_t p;
+    mp_ptr xr, t;
+
+    if (num_primes <= T->num_primes)
+        return;
+
+    if (num_primes > T->alloc)
+    {
+        slong alloc = FLINT_MAX(num_primes, 2 * T->alloc);
+
+        T->primes = flint_realloc(T->primes, sizeof(mp_limb_t) * alloc);
+        T->trees = flint_realloc(T->trees, sizeof(mp_ptr *) * alloc);
+        T->rinv = flint_realloc(T->rinv, sizeof(mp_ptr) * alloc);
+        T->weights = flint_realloc(T->weights, sizeof(mp_ptr) * alloc);
+        T->alloc = alloc;
+    }
+
+    p = (T->num_primes == 0) ? UWORD(1) << (FLINT_BITS - 1)
+                             : T->primes[T->num_primes - 1];
+
+    xr = _nmod_vec_init(len);
+    t = _nmod_vec_init(len);
+
+    while (T->num_primes < num_primes)
+    {
+        nmod_t mod;
+        int ok = 1;
+
+        p = n_nextprime(p, 0);
+        nmod_init(&mod, p);
+
+        for (i = 0; i < len; i++)
+            xr[i] = fmpz_fdiv_ui(T->xs + i, p);
+
+        /* skip primes dividing a difference of two points */
+        if (T->distinct && len > 1)
+        {
+            _nmod_vec_set(t, xr, len);
+            qsort(t, len, sizeof(mp_limb_t), _ulong_cmp_qsort);
+            for (i = 1; i < len && ok; i++)
+                ok = (t[i - 1] != t[i]);
+        }
+
+        if (!ok)
+            continue;
+
+        i = T->num_primes;
+
+        T->primes[i] = p;
+        T->trees[i] = _nmod_poly_tree_alloc(len);
+        _nmod_poly_tree_build(T->trees[i], xr, len, mod);
+        T->rinv[i] = _nmod_vec_init(len);
+        _nmod_poly_tree_inv_root(T->rinv[i], T->trees[i], len, mod);
+        T->weights[i] = NULL;
+
+        T->num_primes++;
+    }
+
+    _nmod_vec_clear(xr);
+    _nmod_vec_clear(t);
+}
+
+void
+_fmpz_poly_multipoint_fit_weights(fmpz_poly_multipoint_precomp_t T)
+{
+    slong i;
+
+    for (i = 0; i < T->num_primes; i++)
+    {
+        if (T->weights[i] == NULL)
+        {
+            nmod_t mod;
+
+            nmod_init(&mod, T->primes[i]);
+            T->weights[i] = _nmod_vec_init(T->len);
+            _nmod_poly_interpolation_weights(T->weights[i],
+                               (const mp_ptr *) T->trees[i], T->len, mod);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+void
+_fmpz_poly_powmod_ui_preinv(fmpz * res, const fmpz * poly, ulong e,
+                          const fmpz * B, const fmpz * B_inv, slong lenB)
+{
+    fmpz * T;
+    slong i, len, lenP, lenT;
+
+    if (lenB <= 2)
+    {
+        fmpz_pow_ui(res, poly, e);
+        return;
+    }
+
+    lenP = lenB - 1;
+    FMPZ_VEC_NORM(poly, lenP);
+
+    if (lenP == 0)
+    {
+        _fmpz_vec_zero(res, lenB - 1);
+        return;
+    }
+
+    T = _fmpz_vec_init(2 * lenB - 3);
+
+    _fmpz_vec_set(res, poly, lenP);
+    _fmpz_vec_zero(res + lenP, lenB - 1 - lenP);
+    len = lenP;
+
+    /*
+        Left-to-right binary exponentiation. The length of res is tracked
+        so that small powers are not reduced.
+    */
+    for (i = ((slong) FLINT_BIT_COUNT(e) - 2); i >= 0 && len > 0; i--)
+    {
+        lenT = 2 * len - 1;
+        _fmpz_poly_sqr(T, res, len);
+
+        if (lenT >= lenB)
+        {
+            _fmpz_poly_rem_preinv(res, T, lenT, B, B_inv, lenB);
+            len = lenB - 1;
+        }
+        else
+        {
+            _fmpz_vec_swap(res, T, lenT);
+            len = lenT;
+        }
+
+        if (e & (UWORD(1) << i))
+        {
+            lenT = len + lenP - 1;
+            if (len >= lenP)
+                _fmpz_poly_mul(T, res, len, poly, lenP);
+            else
+                _fmpz_poly_mul(T, poly, lenP, res, len);
+
+            if (lenT >= lenB)
+            {
+                _fmpz_poly_rem_preinv(res, T, lenT, B, B_inv, lenB);
+                len = lenB - 1;
+            }
+            else
+            {
+                _fmpz_vec_swap(res, T, lenT);
+                len = lenT;
+            }
+        }
+
+        FMPZ_VEC_NORM(res, len);
+    }
+
+    _fmpz_vec_zero(res + len, lenB - 1 - len);
+
+    _fmpz_vec_clear(T, 2 * lenB - 3);
+}
+
+void
+fmpz_poly_powmod_ui_ctx(fmpz_poly_t res, const fmpz_poly_t poly, ulong e,
+                        const fmpz_poly_mod_ctx_t ctx)
+{
+    const slong lenB = ctx->poly.length;
+    slong len = poly->length;
+    fmpz * p;
+    int pcopy = 0;
+
+    if (lenB == 1)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (e == 0)
+    {
+        fmpz_poly_one(res);
+        return;
+    }
+
+    if (len >= lenB)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init(t);
+        fmpz_poly_rem_ctx(t, poly, ctx);
+        fmpz_poly_powmod_ui_ctx(res, t, e, ctx);
+        fmpz_poly_clear(t);
+        return;
+    }
+
+    if (len == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (e == 1)
+    {
+        fmpz_poly_set(res, poly);
+        return;
+    }
+
+    if (len < lenB - 1)
+    {
+        p = _fmpz_vec_init(lenB - 1);
+        _fmpz_vec_set(p, poly->coeffs, len);
+        pcopy = 1;
+    }
+    else
+        p = poly->coeffs;
+
+    if (res == poly && !pcopy)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, lenB - 1);
+        _fmpz_poly_powmod_ui_preinv(t->coeffs, p, e,
+                                    ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, lenB - 1);
+        _fmpz_poly_powmod_ui_preinv(res->coeffs, p, e,
+                                    ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+    }
+
+    if (pcopy)
+        _fmpz_vec_clear(p, lenB - 1);
+
+    _fmpz_poly_set_length(res, lenB - 1);
+    _fmpz_poly_normalise(res);
+}
+
+void
+fmpz_poly_powmod_ui(fmpz_poly_t res, const fmpz_poly_t poly, ulong e,
+                    const fmpz_poly_t B)
+{
+    fmpz_poly_mod_ctx_t ctx;
+
+    if (B->length == 0 || !fmpz_is_pm1(B->coeffs + B->length - 1))
+    {
+        flint_printf("Exception (fmpz_poly_powmod_ui). Modulus must have\n"
+               "leading coefficient +1 or -1.\n");
+        flint_abort();
+    }
+
+    fmpz_poly_mod_ctx_init(ctx, B);
+    fmpz_poly_powmod_ui_ctx(res, poly, e, ctx);
+    fmpz_poly_mod_ctx_clear(ctx);
+}
@@ -59,7 +59,7 @@ _fmpz_poly_preinvert(fmpz * Binv, const fmpz * B, slong len)
             m = n;
             n = a[i];
 
-            _fmpz_poly_mullow(W, T, n, Binv, m, n);
+            _fmpz_poly_mulmid(W + m - 1, T, n, Binv, m);
             _fmpz_poly_mullow(Binv + m, Binv, m, W + m, n - m, n - m);
             _fmpz_vec_neg(Binv + m, Binv + m, n - m);
         }
@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+void
+_fmpz_poly_rem_preinv(fmpz * R, const fmpz * A, slong lenA,
+                           const fmpz * B, const fmpz * B_inv, slong lenB)
+{
+    const slong lenQ = lenA - lenB + 1;
+    fmpz * Q, * P;
+
+    if (lenB == 1)
+        return;
+
+    if (lenB < FMPZ_POLY_REM_PREINV_CUTOFF)
+    {
+        P = _fmpz_vec_init(lenA);
+        _fmpz_poly_rem_basecase(P, A, lenA, B, lenB);
+        _fmpz_vec_swap(R, P, lenB - 1);
+        _fmpz_vec_clear(P, lenA);
+        return;
+    }
+
+    Q = _fmpz_vec_init(lenQ + lenB - 1);
+    P = Q + lenQ;
+
+    _fmpz_poly_div_preinv(Q, A, lenA, B, B_inv, lenB);
+
+    /* only the low lenB - 1 coefficients of B Q are needed */
+    if (lenQ >= lenB - 1)
+        _fmpz_poly_mullow(P, Q, lenB - 1, B, lenB - 1, lenB - 1);
+    else
+        _fmpz_poly_mullow(P, B, lenB - 1, Q, lenQ, lenB - 1);
+
+    _fmpz_vec_sub(R, A, P, lenB - 1);
+
+    _fmpz_vec_clear(Q, lenQ + lenB - 1);
+}
+
+void
+fmpz_poly_rem_ctx(fmpz_poly_t R, const fmpz_poly_t A,
+                                 const fmpz_poly_mod_ctx_t ctx)
+{
+    const slong lenA = A->length, lenB = ctx->poly.length;
+
+    if (lenA < lenB)
+    {
+        fmpz_poly_set(R, A);
+        return;
+    }
+
+    if (R == A)
+    {
+        _fmpz_poly_rem_preinv(R->coeffs, A->coeffs, lenA,
+                              ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+    }
+    else
+    {
+        fmpz_poly_fit_length(R, lenB - 1);
+        _fmpz_poly_rem_preinv(R->coeffs, A->coeffs, lenA,
+                              ctx->poly.coeffs, ctx->inv.coeffs, lenB);
+    }
+
+    _fmpz_poly_set_length(R, lenB - 1);
+    _fmpz_poly_normalise(R);
+}
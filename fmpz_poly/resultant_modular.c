@@ -17,18 +17,64 @@
 #include "mpn_extras.h"
 
 
+typedef struct
+{
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    const fmpz * l;
+    mp_limb_t p0;       /* the first prime used, or 0 */
+    mp_limb_t r0;       /* the resultant modulo p0 */
+}
+resultant_arg_t;
+
+static slong
+_fmpz_poly_resultant_image(mp_ptr r, mp_limb_t p, void * arg_ptr)
+{
+    resultant_arg_t * arg = (resultant_arg_t *) arg_ptr;
+    mp_ptr a, b;
+    nmod_t mod;
+
+    /* the image modulo the first prime is already known */
+    if (p == arg->p0)
+    {
+        r[0] = arg->r0;
+        return 1;
+    }
+
+    /* discard primes dividing the leading coefficients */
+    if (fmpz_fdiv_ui(arg->l, p) == 0)
+        return 0;
+
+    nmod_init(&mod, p);
+
+    /* make space for polynomials mod p */
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    /* reduce polynomials modulo p */
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    /* compute resultant over Z/pZ */
+    r[0] = _nmod_poly_resultant(a, arg->len1, b, arg->len2, mod);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+
+    return 1;
+}
+
 void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
 {
-    mp_bitcnt_t bits1, bits2, bound, pbits, curr_bits = 0; 
-    slong i, num_primes;
-    fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
-    fmpz_t ac, bc, l, modulus;
+    mp_bitcnt_t bits1, bits2, bound;
+    fmpz_t ac, bc, l;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
-    mp_limb_t p;
-    nmod_t mod;
+    resultant_arg_t arg;
+    mp_limb_t p, r;
+    int zero = 0;
     
     /* special case, one of the polys is a constant */
     if (len2 == 1) /* if len1 == 1 then so does len2 */
@@ -51,74 +97,62 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     _fmpz_vec_scalar_divexact_fmpz(A, poly1, len1, ac);
     _fmpz_vec_scalar_divexact_fmpz(B, poly2, len2, bc);
     
-    /* get product of leading coefficients */
     fmpz_init(l);
-    
-    lead_A = A + len1 - 1;
-    lead_B = B + len2 - 1;
-    fmpz_mul(l, lead_A, lead_B);
 
-    /* set size of first prime */
-    pbits = FLINT_BITS - 1;
-    p = (UWORD(1)<<pbits);
+    /*
+        Hadamard bound |res| <= |A|_2^(len2 - 1) |B|_2^(len1 - 1) for the
+        rows of the Sylvester matrix, where bits1 and bits2 bound the
+        logarithms of the squares of the 2-norms; one more bit for the sign
+    */
+    _fmpz_vec_dot(l, A, A, len1);
+    bits1 = fmpz_bits(l);
+    _fmpz_vec_dot(l, B, B, len2);
+    bits2 = fmpz_bits(l);
 
-    /* get bound on size of resultant */
-    bits1 = FLINT_ABS(_fmpz_vec_max_bits(A, len1)); 
-    bits2 = FLINT_ABS(_fmpz_vec_max_bits(B, len2));
+    bound = ((len2 - 1)*bits1 + (len1 - 1)*bits2 + 1)/2 + 1;
 
-    /* bound on number of bits of 2(deg1 + deg2)! */
-    bound = (len1 + len2 - 1)*FLINT_BIT_COUNT((10*(len1 + len2 - 1) + 26)/27) + 3;
-
-    /* Upper bound Hadamard bound */
-    bound += (len1 - 1)*bits2 + (len2 - 1)*bits1;
-    
-    num_primes = (bound + pbits - 1)/pbits;
+    /* get product of leading coefficients */
+    lead_A = A + len1 - 1;
+    lead_B = B + len2 - 1;
+    fmpz_mul(l, lead_A, lead_B);
 
-    parr = _nmod_vec_init(num_primes);
-    rarr = _nmod_vec_init(num_primes);
+    /* the resultants modulo the different primes are computed in parallel */
+    arg.A = A;
+    arg.len1 = len1;
+    arg.B = B;
+    arg.len2 = len2;
+    arg.l = l;
+    arg.p0 = 0;
+
+    /*
+        If the resultant vanishes modulo a first prime, check for a common
+        factor, in which case the resultant is zero and there is no need
+        to go all the way up to the bound.
+    */
+    p = UWORD(1) << (FLINT_BITS - 1);
+    do
+        p = n_nextprime(p, 0);
+    while (!_fmpz_poly_resultant_image(&r, p, &arg));
 
-    fmpz_init(modulus);
-    fmpz_set_ui(modulus, 1);
-    fmpz_zero(res);
+    /* the CRT below starts from the same prime, and reuses this image */
+    arg.p0 = p;
+    arg.r0 = r;
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    
-    for (i = 0; curr_bits < bound; )
+    if (r == 0)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
-            continue;
-        
-        curr_bits += pbits;
+        fmpz * G = _fmpz_vec_init(len2);
 
-        nmod_init(&mod, p);
+        _fmpz_poly_gcd(G, A, len1, B, len2);
+        zero = !_fmpz_vec_is_zero(G + 1, len2 - 1);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
-
-        /* compute resultant over Z/pZ */
-        parr[i] = p;
-        rarr[i++] = _nmod_poly_resultant(a, len1, b, len2, mod);
+        _fmpz_vec_clear(G, len2);
     }
 
-    fmpz_comb_init(comb, parr, num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
-    
-    fmpz_multi_CRT_ui(res, rarr, comb, comb_temp, 1);
-        
-    fmpz_clear(modulus);
-    fmpz_comb_temp_clear(comb_temp);
-    fmpz_comb_clear(comb);
-        
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-
-    _nmod_vec_clear(parr);
-    _nmod_vec_clear(rarr);
+    if (zero)
+        fmpz_zero(res);
+    else
+        _fmpz_vec_multi_mod_CRT_threaded(res, 1, _fmpz_poly_resultant_image,
+                                         &arg, FLINT_BITS - 1, bound, 0);
     
     /* finally multiply by powers of content */
     if (!fmpz_is_one(ac))
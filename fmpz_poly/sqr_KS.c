@@ -16,6 +16,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "fft.h"
 
 void
 _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, slong len)
@@ -54,7 +55,10 @@ _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, slong len)
 
     arr3 = (mp_limb_t *) flint_malloc((2 * limbs) * sizeof(mp_limb_t));
 
-    mpn_sqr(arr3, arr, limbs);
+    if (limbs < 2000)
+       mpn_sqr(arr3, arr, limbs);
+    else
+       flint_mpn_sqr_fft_main(arr3, arr, limbs);
 
     if (sign)
         _fmpz_poly_bit_unpack(rop, 2 * len - 1, arr3, bits, 0);
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2008-2011 William Hart
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+
+void _fmpz_poly_sqr_SS(fmpz * output, const fmpz * input, slong len)
+{
+    _fmpz_poly_sqrlow_SS(output, input, len, 2*len - 1);
+}
+
+void
+fmpz_poly_sqr_SS(fmpz_poly_t res, const fmpz_poly_t poly)
+{
+    const slong len = poly->length;
+    slong rlen;
+
+    if (len == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len <= 2)
+    {
+        fmpz_poly_sqr_classical(res, poly);
+        return;
+    }
+
+    rlen = 2*len - 1;
+
+    fmpz_poly_fit_length(res, rlen);
+    _fmpz_poly_sqr_SS(res->coeffs, poly->coeffs, len);
+    _fmpz_poly_set_length(res, rlen);
+}
@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+
+/* _fmpz_poly_mullow_SS only does one forward FFT for aliased inputs */
+void _fmpz_poly_sqrlow_SS(fmpz * output, const fmpz * input, slong len,
+                                                                   slong trunc)
+{
+    _fmpz_poly_mullow_SS(output, input, len, input, len, trunc);
+}
+
+void
+fmpz_poly_sqrlow_SS(fmpz_poly_t res, const fmpz_poly_t poly, slong n)
+{
+    const slong len = poly->length;
+
+    if (len == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len <= 2 || n <= 2)
+    {
+        fmpz_poly_sqrlow_classical(res, poly, n);
+        return;
+    }
+
+    n = FLINT_MIN(n, 2*len - 1);
+    fmpz_poly_fit_length(res, n);
+
+    _fmpz_poly_sqrlow_SS(res->coeffs, poly->coeffs, len, n);
+
+    _fmpz_poly_set_length(res, n);
+    _fmpz_poly_normalise(res);
+}
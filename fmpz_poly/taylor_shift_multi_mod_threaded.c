@@ -27,39 +27,44 @@ typedef struct
 }
 mod_ui_arg_t;
 
-void *
-_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
+static void
+_fmpz_vec_multi_mod_ui_range(const mod_ui_arg_t * arg)
 {
-    mod_ui_arg_t arg = *((mod_ui_arg_t *) arg_ptr);
     mp_ptr tmp;
     slong i, j;
 
     fmpz_comb_t comb;
     fmpz_comb_temp_t comb_temp;
 
-    tmp = flint_malloc(sizeof(mp_limb_t) * arg.num_primes);
-    fmpz_comb_init(comb, arg.primes, arg.num_primes);
+    tmp = flint_malloc(sizeof(mp_limb_t) * arg->num_primes);
+    fmpz_comb_init(comb, arg->primes, arg->num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
 
-    for (i = arg.n0; i < arg.n1; i++)
+    for (i = arg->n0; i < arg->n1; i++)
     {
-        if (arg.crt)
+        if (arg->crt)
         {
-            for (j = 0; j < arg.num_primes; j++)
-                tmp[j] = arg.residues[j][i];
-            fmpz_multi_CRT_ui(arg.vec + i, tmp, comb, comb_temp, 1);
+            for (j = 0; j < arg->num_primes; j++)
+                tmp[j] = arg->residues[j][i];
+            fmpz_multi_CRT_ui(arg->vec + i, tmp, comb, comb_temp, 1);
         }
         else
         {
-            fmpz_multi_mod_ui(tmp, arg.vec + i, comb, comb_temp);
-            for (j = 0; j < arg.num_primes; j++)
-                arg.residues[j][i] = tmp[j];
+            fmpz_multi_mod_ui(tmp, arg->vec + i, comb, comb_temp);
+            for (j = 0; j < arg->num_primes; j++)
+                arg->residues[j][i] = tmp[j];
         }
     }
 
     flint_free(tmp);
     fmpz_comb_clear(comb);
     fmpz_comb_temp_clear(comb_temp);
+}
+
+void *
+_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
+{
+    _fmpz_vec_multi_mod_ui_range((mod_ui_arg_t *) arg_ptr);
 
     flint_cleanup();
     return NULL;
@@ -73,7 +78,26 @@ _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec, slong len,
     mod_ui_arg_t * args;
     slong i, num_threads;
 
-    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    /* a new thread has to set up its own fmpz memory pool, which costs
+       far more than a small reduction */
+    if (num_threads <= 1)
+    {
+        mod_ui_arg_t arg;
+
+        arg.vec = vec;
+        arg.residues = residues;
+        arg.n0 = 0;
+        arg.n1 = len;
+        arg.primes = primes;
+        arg.num_primes = num_primes;
+        arg.crt = crt;
+
+        _fmpz_vec_multi_mod_ui_range(&arg);
+        return;
+    }
+
     threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(mod_ui_arg_t) * num_threads);
 
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_fmpz_vec_fast....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t P, Q;
+        fmpz_poly_multipoint_precomp_t T;
+        fmpz *x, *y, *z;
+        slong j, n, npoints;
+        mp_bitcnt_t bits, xbits;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        npoints = n_randint(state, (i % 20 == 0) ? 600 : 50);
+        n = n_randint(state, (i % 20 == 0) ? 600 : 50);
+        bits = n_randint(state, 200);
+        xbits = n_randint(state, (i % 20 == 0) ? 20 : 100);
+
+        x = _fmpz_vec_init(npoints);
+        y = _fmpz_vec_init(npoints);
+        z = _fmpz_vec_init(npoints);
+
+        fmpz_poly_init(P);
+        fmpz_poly_init(Q);
+
+        fmpz_poly_randtest(P, state, n, bits);
+        fmpz_poly_randtest(Q, state, n, bits);
+
+        /* repeated points are allowed */
+        for (j = 0; j < npoints; j++)
+            fmpz_randtest(x + j, state, xbits);
+
+        fmpz_poly_multipoint_precompute(T, x, npoints);
+
+        /* the same precomputation is reused for both polynomials */
+        fmpz_poly_evaluate_fmpz_vec_fast_precomp(y, P, T);
+        for (j = 0; j < npoints; j++)
+            fmpz_poly_evaluate_fmpz(z + j, P, x + j);
+
+        result = _fmpz_vec_equal(y, z, npoints);
+        if (!result)
+        {
+            flint_printf("FAIL (P):\n");
+            fmpz_poly_print(P), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_evaluate_fmpz_vec_fast_precomp(y, Q, T);
+        for (j = 0; j < npoints; j++)
+            fmpz_poly_evaluate_fmpz(z + j, Q, x + j);
+
+        result = _fmpz_vec_equal(y, z, npoints);
+        if (!result)
+        {
+            flint_printf("FAIL (Q):\n");
+            fmpz_poly_print(Q), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_multipoint_clear(T);
+
+        fmpz_poly_evaluate_fmpz_vec_fast(y, P, x, npoints);
+        for (j = 0; j < npoints; j++)
+            fmpz_poly_evaluate_fmpz(z + j, P, x + j);
+
+        result = _fmpz_vec_equal(y, z, npoints);
+        if (!result)
+        {
+            flint_printf("FAIL (no precomp):\n");
+            fmpz_poly_print(P), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(P);
+        fmpz_poly_clear(Q);
+        _fmpz_vec_clear(x, npoints);
+        _fmpz_vec_clear(y, npoints);
+        _fmpz_vec_clear(z, npoints);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("interpolate_fmpz_vec_fast....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t P, Q, R;
+        fmpz_poly_multipoint_precomp_t T;
+        fmpz *x, *y;
+        slong j, n, npoints;
+        mp_bitcnt_t bits, xbits;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        npoints = n_randint(state, (i % 20 == 0) ? 300 : 50);
+        n = n_randint(state, npoints + 1);
+        bits = n_randint(state, 100);
+        xbits = n_randint(state, 20);
+
+        x = _fmpz_vec_init(npoints);
+        y = _fmpz_vec_init(npoints);
+
+        fmpz_poly_init(P);
+        fmpz_poly_init(Q);
+        fmpz_poly_init(R);
+
+        fmpz_poly_randtest(P, state, n, bits);
+
+        /* distinct points */
+        if (npoints > 0)
+            fmpz_randtest(x, state, xbits);
+        for (j = 1; j < npoints; j++)
+        {
+            fmpz_randtest_unsigned(x + j, state, xbits);
+            fmpz_add_ui(x + j, x + j, 1);
+            fmpz_add(x + j, x + j, x + j - 1);
+        }
+
+        fmpz_poly_multipoint_precompute(T, x, npoints);
+
+        fmpz_poly_evaluate_fmpz_vec_fast_precomp(y, P, T);
+        fmpz_poly_interpolate_fmpz_vec_fast_precomp(Q, y, T);
+
+        result = fmpz_poly_equal(P, Q);
+        if (!result)
+        {
+            flint_printf("FAIL (P != Q):\n");
+            fmpz_poly_print(P), flint_printf("\n\n");
+            fmpz_poly_print(Q), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_multipoint_clear(T);
+
+        fmpz_poly_interpolate_fmpz_vec_fast(R, x, y, npoints);
+
+        result = fmpz_poly_equal(P, R);
+        if (!result)
+        {
+            flint_printf("FAIL (P != R):\n");
+            fmpz_poly_print(P), flint_printf("\n\n");
+            fmpz_poly_print(R), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(P);
+        fmpz_poly_clear(Q);
+        fmpz_poly_clear(R);
+        _fmpz_vec_clear(x, npoints);
+        _fmpz_vec_clear(y, npoints);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
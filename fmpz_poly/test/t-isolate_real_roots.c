@@ -0,0 +1,190 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpq.h"
+#include "ulong_extras.h"
+
+/* sets x to c 2^e */
+static void
+_fmpq_set_2exp(fmpq_t x, const fmpz_t c, slong e)
+{
+    fmpz_set(fmpq_numref(x), c);
+    fmpz_one(fmpq_denref(x));
+
+    if (e >= 0)
+        fmpz_mul_2exp(fmpq_numref(x), fmpq_numref(x), e);
+    else
+        fmpz_mul_2exp(fmpq_denref(x), fmpq_denref(x), -e);
+
+    fmpq_canonicalise(x);
+}
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("isolate_real_roots....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz * a, * b;
+        slong * exp;
+        fmpq_t x, y, fa, fb;
+        slong j, n, deg, num;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpq_init(x);
+        fmpq_init(y);
+        fmpq_init(fa);
+        fmpq_init(fb);
+
+        /* a product of linear factors, possibly with repeated and dyadic
+           roots, times a polynomial with no real roots */
+        fmpz_poly_set_ui(f, 1);
+        num = n_randint(state, 10);
+        for (j = 0; j < num; j++)
+        {
+            fmpz_poly_fit_length(g, 2);
+            fmpz_randtest(g->coeffs, state, 20);
+            if (n_randint(state, 2))
+                fmpz_one(g->coeffs + 1);
+            else
+                fmpz_randtest_not_zero(g->coeffs + 1, state, 20);
+            _fmpz_poly_set_length(g, 2);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        if (n_randint(state, 2))
+        {
+            fmpz_poly_randtest_no_real_root(g, state,
+                                            1 + n_randint(state, 10), 20);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        if (fmpz_poly_is_zero(f))
+            fmpz_poly_set_ui(f, 1);
+
+        /* large coefficients */
+        if (n_randint(state, 2))
+        {
+            fmpz_t m;
+            fmpz_init(m);
+            fmpz_randtest_not_zero(m, state, 400);
+            fmpz_poly_scalar_mul_fmpz(f, f, m);
+            fmpz_clear(m);
+        }
+
+        deg = fmpz_poly_degree(f);
+        a = _fmpz_vec_init(deg + 1);
+        b = _fmpz_vec_init(deg + 1);
+        exp = flint_malloc(sizeof(slong) * (deg + 1));
+
+        n = fmpz_poly_isolate_real_roots(a, b, exp, f);
+
+        /* count the distinct real roots */
+        fmpz_poly_derivative(g, f);
+        fmpz_poly_gcd(g, f, g);
+        fmpz_poly_div(g, f, g);
+        result = (n == (g->length <= 1 ? 0 : fmpz_poly_num_real_roots(g)));
+
+        for (j = 0; j < n && result; j++)
+        {
+            _fmpq_set_2exp(x, a + j, exp[j]);
+            _fmpq_set_2exp(y, b + j, exp[j]);
+            fmpz_poly_evaluate_fmpq(fa, f, x);
+            fmpz_poly_evaluate_fmpq(fb, f, y);
+
+            if (fmpz_equal(a + j, b + j))
+            {
+                result = fmpq_is_zero(fa);
+            }
+            else
+            {
+                int sa, sb;
+
+                /* the squarefree part changes sign inside; at an endpoint
+                   which is a root, the sign inside is given by g' */
+                fmpz_poly_evaluate_fmpq(fa, g, x);
+                fmpz_poly_evaluate_fmpq(fb, g, y);
+                sa = fmpq_sgn(fa);
+                sb = fmpq_sgn(fb);
+
+                fmpz_poly_derivative(h, g);
+                if (sa == 0)
+                {
+                    fmpz_poly_evaluate_fmpq(fa, h, x);
+                    sa = fmpq_sgn(fa);
+                }
+                if (sb == 0)
+                {
+                    fmpz_poly_evaluate_fmpq(fb, h, y);
+                    sb = -fmpq_sgn(fb);
+                }
+
+                result = (sa * sb < 0) && fmpz_cmp(a + j, b + j) < 0;
+            }
+
+            /* increasing and disjoint */
+            if (result && j > 0)
+            {
+                _fmpq_set_2exp(x, b + j - 1, exp[j - 1]);
+                _fmpq_set_2exp(y, a + j, exp[j]);
+                result = fmpq_cmp(x, y) <= 0;
+
+                if (result && fmpz_equal(a + j, b + j) &&
+                              fmpz_equal(a + j - 1, b + j - 1))
+                    result = fmpq_cmp(x, y) < 0;
+            }
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n");
+            flint_printf("n = %wd\n", n);
+            for (j = 0; j < n; j++)
+            {
+                flint_printf("("), fmpz_print(a + j), flint_printf(", ");
+                fmpz_print(b + j), flint_printf(") 2^%wd\n", exp[j]);
+            }
+            abort();
+        }
+
+        _fmpz_vec_clear(a, deg + 1);
+        _fmpz_vec_clear(b, deg + 1);
+        flint_free(exp);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpq_clear(x);
+        fmpq_clear(y);
+        fmpq_clear(fa);
+        fmpq_clear(fb);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod....");
+    fflush(stdout);
+
+    /* Compare with mul and rem */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, f, r, r2, r3;
+        fmpz_poly_mod_ctx_t ctx;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(f);
+        fmpz_poly_init(r);
+        fmpz_poly_init(r2);
+        fmpz_poly_init(r3);
+
+        fmpz_poly_randtest_not_zero(f, state, n_randint(state, 200) + 1, 20);
+        if (n_randint(state, 2))
+            fmpz_one(f->coeffs + f->length - 1);
+        else
+            fmpz_set_si(f->coeffs + f->length - 1, -1);
+
+        fmpz_poly_randtest(a, state, n_randint(state, 300), 20);
+        fmpz_poly_randtest(b, state, n_randint(state, 300), 20);
+
+        fmpz_poly_mul(r, a, b);
+        fmpz_poly_rem(r, r, f);
+
+        fmpz_poly_mulmod(r2, a, b, f);
+
+        fmpz_poly_mod_ctx_init(ctx, f);
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                fmpz_poly_mulmod_ctx(r3, a, b, ctx);
+                break;
+            case 1:
+                fmpz_poly_set(r3, a);
+                fmpz_poly_mulmod_ctx(r3, r3, b, ctx);
+                break;
+            default:
+                fmpz_poly_set(r3, b);
+                fmpz_poly_mulmod_ctx(r3, a, r3, ctx);
+        }
+        fmpz_poly_mod_ctx_clear(ctx);
+
+        result = (fmpz_poly_equal(r, r2) && fmpz_poly_equal(r, r3));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            fmpz_poly_print(f), flint_printf("\n\n");
+            fmpz_poly_print(r), flint_printf("\n\n");
+            fmpz_poly_print(r2), flint_printf("\n\n");
+            fmpz_poly_print(r3), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(r);
+        fmpz_poly_clear(r2);
+        fmpz_poly_clear(r3);
+    }
+
+    /* Check aliasing of res and the modulus */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, f, r;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(f);
+        fmpz_poly_init(r);
+
+        fmpz_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, 100);
+        fmpz_one(f->coeffs + f->length - 1);
+        fmpz_poly_randtest(a, state, n_randint(state, 50), 100);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 100);
+
+        fmpz_poly_mulmod(r, a, b, f);
+        fmpz_poly_mulmod(f, a, b, f);
+
+        result = (fmpz_poly_equal(r, f));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            fmpz_poly_print(r), flint_printf("\n\n");
+            fmpz_poly_print(f), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powmod_ui....");
+    fflush(stdout);
+
+    /* Compare with pow and rem */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, f, r, r2;
+        ulong e;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(f);
+        fmpz_poly_init(r);
+        fmpz_poly_init(r2);
+
+        fmpz_poly_randtest_not_zero(f, state, n_randint(state, 30) + 1, 10);
+        if (n_randint(state, 2))
+            fmpz_one(f->coeffs + f->length - 1);
+        else
+            fmpz_set_si(f->coeffs + f->length - 1, -1);
+
+        fmpz_poly_randtest(a, state, n_randint(state, 40), 10);
+        e = n_randint(state, 20);
+
+        fmpz_poly_pow(r, a, e);
+        fmpz_poly_rem(r, r, f);
+
+        if (n_randint(state, 2))
+        {
+            fmpz_poly_powmod_ui(r2, a, e, f);
+        }
+        else
+        {
+            fmpz_poly_set(r2, a);
+            fmpz_poly_powmod_ui(r2, r2, e, f);
+        }
+
+        result = (fmpz_poly_equal(r, r2));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("e = %wu\n", e);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(f), flint_printf("\n\n");
+            fmpz_poly_print(r), flint_printf("\n\n");
+            fmpz_poly_print(r2), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(r);
+        fmpz_poly_clear(r2);
+    }
+
+    /* Check a^(e1 + e2) = a^e1 a^e2 with a shared context */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, f, r1, r2, r3;
+        fmpz_poly_mod_ctx_t ctx;
+        ulong e1, e2;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(f);
+        fmpz_poly_init(r1);
+        fmpz_poly_init(r2);
+        fmpz_poly_init(r3);
+
+        fmpz_poly_randtest_not_zero(f, state, n_randint(state, 30) + 1, 5);
+        fmpz_one(f->coeffs + f->length - 1);
+        fmpz_poly_randtest(a, state, n_randint(state, 30), 5);
+        e1 = n_randint(state, 30);
+        e2 = n_randint(state, 30);
+
+        fmpz_poly_mod_ctx_init(ctx, f);
+        fmpz_poly_powmod_ui_ctx(r1, a, e1, ctx);
+        fmpz_poly_powmod_ui_ctx(r2, a, e2, ctx);
+        fmpz_poly_mulmod_ctx(r2, r1, r2, ctx);
+        fmpz_poly_powmod_ui_ctx(r3, a, e1 + e2, ctx);
+        fmpz_poly_mod_ctx_clear(ctx);
+
+        result = (fmpz_poly_equal(r2, r3));
+        if (!result)
+        {
+            flint_printf("FAIL (exponent sum):\n");
+            flint_printf("e1 = %wu, e2 = %wu\n", e1, e2);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(f), flint_printf("\n\n");
+            fmpz_poly_print(r2), flint_printf("\n\n");
+            fmpz_poly_print(r3), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(r1);
+        fmpz_poly_clear(r2);
+        fmpz_poly_clear(r3);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rem_ctx....");
+    fflush(stdout);
+
+    /* Compare with rem, reusing the context */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, r, r2;
+        fmpz_poly_mod_ctx_t ctx;
+        slong j;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(r);
+        fmpz_poly_init(r2);
+
+        fmpz_poly_randtest_not_zero(b, state, n_randint(state, 300) + 1, 20);
+        if (n_randint(state, 2))
+            fmpz_one(b->coeffs + b->length - 1);
+        else
+            fmpz_set_si(b->coeffs + b->length - 1, -1);
+
+        fmpz_poly_mod_ctx_init(ctx, b);
+
+        for (j = 0; j < 3; j++)
+        {
+            fmpz_poly_randtest(a, state, n_randint(state, 800), 20);
+
+            fmpz_poly_rem(r, a, b);
+            fmpz_poly_rem_ctx(r2, a, ctx);
+
+            result = (fmpz_poly_equal(r, r2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                fmpz_poly_print(a), flint_printf("\n\n");
+                fmpz_poly_print(b), flint_printf("\n\n");
+                fmpz_poly_print(r), flint_printf("\n\n");
+                fmpz_poly_print(r2), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_poly_mod_ctx_clear(ctx);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(r);
+        fmpz_poly_clear(r2);
+    }
+
+    /* Check aliasing of r and a */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, r;
+        fmpz_poly_mod_ctx_t ctx;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(r);
+
+        fmpz_poly_randtest(a, state, n_randint(state, 200), 100);
+        fmpz_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, 100);
+        fmpz_one(b->coeffs + b->length - 1);
+
+        fmpz_poly_mod_ctx_init(ctx, b);
+        fmpz_poly_rem(r, a, b);
+        fmpz_poly_rem_ctx(a, a, ctx);
+
+        result = (fmpz_poly_equal(a, r));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(r), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_mod_ctx_clear(ctx);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
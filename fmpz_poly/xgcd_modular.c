@@ -17,15 +17,76 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * r;
+    const fmpz * poly1;
+    slong len1;
+    const fmpz * poly2;
+    slong len2;
+}
+xgcd_arg_t;
+
+/*
+    Computes S and T with S*A + T*B = r mod p, where A and B are the inputs
+    mod p, writing S followed by T to ST. Returns 0 if p is unsuitable.
+*/
+static slong
+_fmpz_poly_xgcd_image(mp_ptr ST, mp_limb_t p, void * arg_ptr)
+{
+    xgcd_arg_t * arg = (xgcd_arg_t *) arg_ptr;
+    slong len1 = arg->len1, len2 = arg->len2;
+    mp_ptr G, A, B, S, T;
+    mp_limb_t R, RGinv;
+    nmod_t mod;
+
+    /* Resultant mod p */
+    R = fmpz_fdiv_ui(arg->r, p);
+
+    /* If p divides resultant or either leading coeff, discard p */
+    if ((fmpz_fdiv_ui(arg->poly1 + len1 - 1, p) == WORD(0)) || 
+        (fmpz_fdiv_ui(arg->poly2 + len2 - 1, p) == WORD(0)) || (R == 0))
+        return 0;
+
+    nmod_init(&mod, p);
+
+    G = _nmod_vec_init(len1 + 2 * len2);
+    A = G + len2;
+    B = A + len1;
+    S = ST;
+    T = ST + len2;
+    _nmod_vec_zero(ST, len2 + len1);
+
+    /* Reduce polynomials modulo p */
+    _fmpz_vec_get_nmod_vec(A, arg->poly1, len1, mod);
+    _fmpz_vec_get_nmod_vec(B, arg->poly2, len2, mod);
+
+    /* Compute xgcd mod p */
+    _nmod_poly_xgcd(G, S, T, A, len1, B, len2, mod);
+    RGinv = n_invmod(G[0], mod.n);
+    RGinv = n_mulmod2_preinv(RGinv, R, mod.n, mod.ninv);
+
+    /* Scale appropriately */
+    _nmod_vec_scalar_mul_nmod(S, S, len2, RGinv, mod);
+    _nmod_vec_scalar_mul_nmod(T, T, len1, RGinv, mod);
+
+    _nmod_vec_clear(G);
+
+    return 1;
+}
+
 void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t, 
                              const fmpz * poly1, slong len1, 
                              const fmpz * poly2, slong len2)
 {
     mp_ptr G, S, T, A, B, T1, T2;
+    mp_ptr primes, * images;
+    slong i, batch, num_threads, * status;
     fmpz_t prod;
-    int stabilised = 0, first;
+    int stabilised = 0, first, computed = 0;
     mp_limb_t p;
     mp_bitcnt_t s_bits = 0, t_bits = 0;
+    xgcd_arg_t arg;
 
     /* Compute resultant of input polys */
     _fmpz_poly_resultant(r, poly1, len1, poly2, len2);
@@ -51,6 +112,25 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
 
     _nmod_vec_zero(S, len2 + len1); /* S = T = 0 */
 
+    /*
+        Until the CRT has stabilised, primes are taken in batches of one per
+        thread and the xgcds modulo the primes of a batch are computed in
+        parallel. Once it has, we only check one prime at a time.
+    */
+    num_threads = flint_get_num_threads();
+    primes = _nmod_vec_init(num_threads);
+    status = flint_malloc(sizeof(slong) * num_threads);
+    images = flint_malloc(sizeof(mp_ptr) * num_threads);
+    for (i = 0; i < num_threads; i++)
+        images[i] = _nmod_vec_init(len1 + len2);
+    batch = 0;
+
+    arg.r = r;
+    arg.poly1 = poly1;
+    arg.len1 = len1;
+    arg.poly2 = poly2;
+    arg.len2 = len2;
+
     first = 1;
 
     for (;;) 
@@ -59,7 +139,24 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
         nmod_t mod;
 
         /* Get next prime */
-        p = n_nextprime(p, 0);
+        if (batch == 0)
+        {
+            batch = stabilised ? 1 : num_threads;
+
+            for (i = 0; i < batch; i++)
+            {
+                p = n_nextprime(p, 0);
+                primes[batch - i - 1] = p;
+            }
+
+            computed = !stabilised;
+            if (computed)
+                _fmpz_vec_multi_mod_images_threaded(images, status, primes,
+                                        batch, _fmpz_poly_xgcd_image, &arg);
+        }
+
+        batch--;
+        p = primes[batch];
 
         /* Resultant mod p */
         R = fmpz_fdiv_ui(r, p);
@@ -97,16 +194,10 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
 
         if (!stabilised) /* Need to keep computing xgcds mod p */
         {
-            mp_limb_t RGinv;
-
-            /* Compute xgcd mod p */
-            _nmod_poly_xgcd(G, S, T, A, len1, B, len2, mod);
-            RGinv = n_invmod(G[0], mod.n);
-            RGinv = n_mulmod2_preinv(RGinv, R, mod.n, mod.ninv);
-
-            /* Scale appropriately */
-            _nmod_vec_scalar_mul_nmod(S, S, len2, RGinv, mod);
-            _nmod_vec_scalar_mul_nmod(T, T, len1, RGinv, mod);
+            if (computed) /* Already computed by the batch */
+                _nmod_vec_set(S, images[batch], len1 + len2);
+            else
+                _fmpz_poly_xgcd_image(S, p, &arg);
 
             if (first) /* First time around set s and t to S and T */
             {
@@ -154,6 +245,12 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
         }
     }
 
+    for (i = 0; i < num_threads; i++)
+        _nmod_vec_clear(images[i]);
+    flint_free(images);
+    flint_free(status);
+    _nmod_vec_clear(primes);
+
     _nmod_vec_clear(G);
     fmpz_clear(prod);
 }
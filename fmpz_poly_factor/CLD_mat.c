@@ -10,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include <stdlib.h>
 #include "flint.h"
@@ -19,6 +20,98 @@
 
 #include "fmpz_mod_poly.h"
 
+/*
+   Computes the CLD data for the lifted factors i0, ..., i1 - 1, that is
+   the bottom lo_n and top hi_n coefficients of each fg'/g, reduced mod P.
+*/
+static void
+_fmpz_poly_factor_CLD_mat_rows(fmpz_mat_t res, const fmpz_poly_t f,
+            const fmpz_poly_factor_t lifted_fac, const fmpz_t P,
+            slong lo_n, slong hi_n, slong i0, slong i1)
+{
+   slong i, zeroes;
+   fmpz_poly_t gd, gcld, temp;
+   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+
+   fmpz_poly_init(gd);
+   fmpz_poly_init(gcld);
+   /* do not initialise trunc_f */
+   /* do not initialise trunc_fac */
+
+   if (lo_n > 0)
+   {
+      for (i = i0; i < i1; i++)
+      {
+         zeroes = 0;
+         while (fmpz_is_zero(lifted_fac->p[i].coeffs + zeroes))
+            zeroes++;
+
+         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
+         fmpz_poly_derivative(gd, trunc_fac);
+         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
+         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
+      }      
+   }
+
+   if (hi_n > 0)
+   {
+      fmpz_poly_init(temp);
+
+      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
+      
+      for (i = i0; i < i1; i++)
+      {
+         slong len = lifted_fac->p[i].length - hi_n - 1;
+
+         if (len < 0)
+         {
+            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
+            fmpz_poly_derivative(gd, temp);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
+         } else
+         {
+            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
+            fmpz_poly_derivative(gd, trunc_fac);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
+         }
+      }
+
+      fmpz_poly_clear(temp);      
+   }
+
+   /* do not clear trunc_fac */
+   /* do not clear trunc_f */
+   fmpz_poly_clear(gd);
+   fmpz_poly_clear(gcld);
+}
+
+typedef struct
+{
+   fmpz_mat_struct * res;
+   const fmpz_poly_struct * f;
+   const fmpz_poly_factor_struct * lifted_fac;
+   const fmpz * P;
+   slong lo_n;
+   slong hi_n;
+   slong i0;
+   slong i1;
+}
+CLD_mat_arg_t;
+
+void *
+_fmpz_poly_factor_CLD_mat_worker(void * arg_ptr)
+{
+   CLD_mat_arg_t arg = *((CLD_mat_arg_t *) arg_ptr);
+
+   _fmpz_poly_factor_CLD_mat_rows(arg.res, arg.f, arg.lifted_fac, arg.P,
+                                  arg.lo_n, arg.hi_n, arg.i0, arg.i1);
+
+   flint_cleanup();
+   return NULL;
+}
+
 slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                               fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k)
 {
@@ -30,10 +123,9 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
       initialised to be of size (r + 1, 2k).
    */
 
-   slong i, zeroes, bound, lo_n, hi_n, r = lifted_fac->num;
+   slong i, bound, lo_n, hi_n, r = lifted_fac->num;
    slong bit_r = FLINT_MAX(r, 20);
-   fmpz_poly_t gd, gcld, temp;
-   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+   slong num_threads;
    fmpz_t t;
 
    /* insert CLD bounds in last row of matrix */
@@ -70,54 +162,46 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
 
    fmpz_clear(t);
 
-   /* now insert data into matrix */
+   /*
+      now insert data into matrix; the rows for the different factors are
+      independent, but only worth threading if the factors are not tiny
+   */
 
-   fmpz_poly_init(gd);
-   fmpz_poly_init(gcld);
-   /* do not initialise trunc_f */
-   /* do not initialise trunc_fac */
+   num_threads = flint_get_num_threads();
+   if (f->length < 128 || lo_n + hi_n == 0)
+      num_threads = 1;
+   num_threads = FLINT_MIN(num_threads, r);
 
-   if (lo_n > 0)
+   if (num_threads <= 1)
+      _fmpz_poly_factor_CLD_mat_rows(res, f, lifted_fac, P, lo_n, hi_n, 0, r);
+   else
    {
-      for (i = 0; i < r; i++)
-      {
-         zeroes = 0;
-         while (lifted_fac->p[i].coeffs + zeroes)
-            zeroes++;
-
-         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
-         fmpz_poly_derivative(gd, trunc_fac);
-         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
-         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
-      }      
-   }
+      pthread_t * threads;
+      CLD_mat_arg_t * args;
 
-   if (hi_n > 0)
-   {
-      fmpz_poly_init(temp);
+      threads = flint_malloc(sizeof(pthread_t) * num_threads);
+      args = flint_malloc(sizeof(CLD_mat_arg_t) * num_threads);
 
-      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
-      
-      for (i = 0; i < r; i++)
+      for (i = 0; i < num_threads; i++)
       {
-         slong len = lifted_fac->p[i].length - hi_n - 1;
-
-         if (len < 0)
-         {
-            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
-            fmpz_poly_derivative(gd, temp);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
-         } else
-         {
-            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
-            fmpz_poly_derivative(gd, trunc_fac);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
-         }
+         args[i].res = res;
+         args[i].f = f;
+         args[i].lifted_fac = lifted_fac;
+         args[i].P = P;
+         args[i].lo_n = lo_n;
+         args[i].hi_n = hi_n;
+         args[i].i0 = (r * i) / num_threads;
+         args[i].i1 = (r * (i + 1)) / num_threads;
+
+         pthread_create(&threads[i], NULL,
+                        _fmpz_poly_factor_CLD_mat_worker, &args[i]);
       }
 
-      fmpz_poly_clear(temp);      
+      for (i = 0; i < num_threads; i++)
+         pthread_join(threads[i], NULL);
+
+      flint_free(threads);
+      flint_free(args);
    }
 
    if (hi_n > 0)
@@ -127,11 +211,5 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
          fmpz_set(res->rows[r] + lo_n + i, res->rows[r] + 2*k - hi_n + i);
    }
 
-   /* do not clear trunc_fac */
-   /* do not clear trunc_f */
-   fmpz_poly_clear(gd);
-   fmpz_poly_clear(gcld);
-
    return lo_n + hi_n;
 }
-
@@ -12,9 +12,48 @@
 
 #include <stdlib.h>
 #include "fmpz_poly.h"
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+#include <pthread.h>
+#endif
 
 #define TRACE_ZASSENHAUS 0
 
+/*
+    number of primes to try when choosing a modular factorisation; this
+    must not depend on the number of threads, so that the factorisation
+    is found along the same path whatever the thread count
+*/
+#define ZASSENHAUS_NUM_PRIMES 3
+
+typedef struct
+{
+    nmod_poly_factor_struct * facs;
+    nmod_poly_struct * t;
+    slong i0;
+    slong i1;
+    slong num_threads;
+}
+zassenhaus_prime_arg_t;
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+static void *
+_fmpz_poly_factor_zassenhaus_worker(void * arg_ptr)
+{
+    zassenhaus_prime_arg_t arg = *((zassenhaus_prime_arg_t *) arg_ptr);
+    slong i;
+
+    flint_set_num_threads(arg.num_threads);
+
+    for (i = arg.i0; i < arg.i1; i++)
+        nmod_poly_factor(arg.facs + i, arg.t + i);
+
+    flint_cleanup();
+    return NULL;
+}
+
+#endif
+
 /*
     Let $f$ be a polynomial of degree $m = \deg(f) \geq 2$. 
     If another polynomial $g$ divides $f$ then, for all 
@@ -103,19 +142,29 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
     }
     else
     {
-        slong i;
+        slong i, num_primes, num_threads, best;
         slong r = lenF;
         mp_limb_t p = 2;
-        nmod_poly_t d, g, t;
+        nmod_poly_t d, g;
+        nmod_poly_struct * t;
+        nmod_poly_factor_struct * facs;
         nmod_poly_factor_t fac;
 
+        num_primes = ZASSENHAUS_NUM_PRIMES;
+
+        t = flint_malloc(sizeof(nmod_poly_struct) * num_primes);
+        facs = flint_malloc(sizeof(nmod_poly_factor_struct) * num_primes);
+
         nmod_poly_factor_init(fac);
-        nmod_poly_init_preinv(t, 1, 0);
         nmod_poly_init_preinv(d, 1, 0);
         nmod_poly_init_preinv(g, 1, 0);
 
-        for (i = 0; i < 3; i++)
+        /* find primes for which f remains squarefree and of full degree */
+        for (i = 0; i < num_primes; i++)
         {
+            nmod_poly_init_preinv(t + i, 1, 0);
+            nmod_poly_factor_init(facs + i);
+
             for ( ; ; p = n_nextprime(p, 0))
             {
                 nmod_t mod;
@@ -123,36 +172,82 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
                 nmod_init(&mod, p);
                 d->mod = mod;
                 g->mod = mod;
-                t->mod = mod;
+                (t + i)->mod = mod;
 
-                fmpz_poly_get_nmod_poly(t, f);
-                if (t->length == lenF && t->coeffs[0] != 0)
+                fmpz_poly_get_nmod_poly(t + i, f);
+                if ((t + i)->length == lenF && (t + i)->coeffs[0] != 0)
                 {
-                    nmod_poly_derivative(d, t);
-                    nmod_poly_gcd(g, t, d);
+                    nmod_poly_derivative(d, t + i);
+                    nmod_poly_gcd(g, t + i, d);
 
                     if (nmod_poly_is_one(g))
-                    {
-                        nmod_poly_factor_t temp_fac;
-
-                        nmod_poly_factor_init(temp_fac);
-                        nmod_poly_factor(temp_fac, t);
-
-                        if (temp_fac->num <= r)
-                        {
-                            r = temp_fac->num;
-                            nmod_poly_factor_set(fac, temp_fac);
-                        }
-                        nmod_poly_factor_clear(temp_fac);
                         break;
-                    }
                 }
             }
             p = n_nextprime(p, 0);
         }
         nmod_poly_clear(d);
         nmod_poly_clear(g);
-        nmod_poly_clear(t);
+
+        /* the modular factorisations are independent */
+        num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+        if (num_threads > 1)
+        {
+            pthread_t * threads;
+            zassenhaus_prime_arg_t * args;
+            slong j;
+
+            threads = flint_malloc(sizeof(pthread_t) * num_threads);
+            args = flint_malloc(sizeof(zassenhaus_prime_arg_t) * num_threads);
+
+            for (j = 0; j < num_threads; j++)
+            {
+                args[j].facs = facs;
+                args[j].t = t;
+                args[j].i0 = (num_primes * j) / num_threads;
+                args[j].i1 = (num_primes * (j + 1)) / num_threads;
+                args[j].num_threads = FLINT_MAX(1,
+                                  flint_get_num_threads() / num_threads);
+
+                pthread_create(&threads[j], NULL,
+                               _fmpz_poly_factor_zassenhaus_worker, &args[j]);
+            }
+
+            for (j = 0; j < num_threads; j++)
+                pthread_join(threads[j], NULL);
+
+            flint_free(threads);
+            flint_free(args);
+        }
+        else
+#endif
+        {
+            for (i = 0; i < num_primes; i++)
+                nmod_poly_factor(facs + i, t + i);
+        }
+
+        /* choose the prime giving the fewest modular factors */
+        best = 0;
+        for (i = 0; i < num_primes; i++)
+        {
+            if ((facs + i)->num <= r)
+            {
+                r = (facs + i)->num;
+                best = i;
+            }
+        }
+
+        nmod_poly_factor_set(fac, facs + best);
+
+        for (i = 0; i < num_primes; i++)
+        {
+            nmod_poly_clear(t + i);
+            nmod_poly_factor_clear(facs + i);
+        }
+        flint_free(t);
+        flint_free(facs);
 
         p = (fac->p + 0)->mod.n;
             
@@ -168,9 +168,18 @@ FLINT_DLL void fmpz_poly_mat_mul_classical(fmpz_poly_mat_t C, const fmpz_poly_ma
 FLINT_DLL void fmpz_poly_mat_mul_KS(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
                                             const fmpz_poly_mat_t B);
 
+FLINT_DLL void fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C,
+                    const fmpz_poly_mat_t A, const fmpz_poly_mat_t B);
+
+FLINT_DLL int _fmpz_poly_mat_mul_use_multi_mod(const fmpz_poly_mat_t A,
+                                               const fmpz_poly_mat_t B);
+
 FLINT_DLL void fmpz_poly_mat_mullow(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
     const fmpz_poly_mat_t B, slong len);
 
+FLINT_DLL void fmpz_poly_mat_mullow_multi_mod(fmpz_poly_mat_t C,
+        const fmpz_poly_mat_t A, const fmpz_poly_mat_t B, slong len);
+
 FLINT_DLL void fmpz_poly_mat_sqr(fmpz_poly_mat_t B, const fmpz_poly_mat_t A);
 
 FLINT_DLL void fmpz_poly_mat_sqr_classical(fmpz_poly_mat_t B, const fmpz_poly_mat_t A);
@@ -218,6 +227,8 @@ FLINT_DLL void fmpz_poly_mat_det_fflu(fmpz_poly_t det, const fmpz_poly_mat_t A);
 
 FLINT_DLL void fmpz_poly_mat_det_interpolate(fmpz_poly_t det, const fmpz_poly_mat_t A);
 
+FLINT_DLL void fmpz_poly_mat_det_multi_mod(fmpz_poly_t det, const fmpz_poly_mat_t A);
+
 FLINT_DLL slong fmpz_poly_mat_rank(const fmpz_poly_mat_t A);
 
 /* Inverse *******************************************************************/
@@ -241,6 +252,9 @@ FLINT_DLL void fmpz_poly_mat_solve_fflu_precomp(fmpz_poly_mat_t X,
                     const slong * perm,
                     const fmpz_poly_mat_t FFLU, const fmpz_poly_mat_t B);
 
+FLINT_DLL int fmpz_poly_mat_solve_multi_mod(fmpz_poly_mat_t X, fmpz_poly_t den,
+                    const fmpz_poly_mat_t A, const fmpz_poly_mat_t B);
+
 #ifdef __cplusplus
 }
 #endif
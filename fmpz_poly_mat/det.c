@@ -38,12 +38,12 @@ fmpz_poly_mat_det(fmpz_poly_t det, const fmpz_poly_mat_t A)
         fmpz_poly_sub(det, det, tmp);
         fmpz_poly_clear(tmp);
     }
-    else if (n < 15)  /* should be entry sensitive too */
+    else if (n < 8)  /* should be entry sensitive too */
     {
         fmpz_poly_mat_det_fflu(det, A);
     }
     else
     {
-        fmpz_poly_mat_det_interpolate(det, A);
+        fmpz_poly_mat_det_multi_mod(det, A);
     }
 }
@@ -0,0 +1,167 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_mat.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    const fmpz_poly_mat_struct * A;
+    slong len;
+}
+det_multi_mod_arg_t;
+
+static slong
+_fmpz_poly_mat_det_image(mp_ptr res, mp_limb_t p, void * arg_ptr)
+{
+    det_multi_mod_arg_t * arg = (det_multi_mod_arg_t *) arg_ptr;
+    const fmpz_poly_mat_struct * A = arg->A;
+    nmod_poly_mat_t Ap;
+    nmod_poly_t d;
+    slong i, j, len;
+
+    nmod_poly_mat_init(Ap, A->r, A->c, p);
+    nmod_poly_init(d, p);
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            fmpz_poly_get_nmod_poly(nmod_poly_mat_entry(Ap, i, j),
+                                    fmpz_poly_mat_entry(A, i, j));
+
+    nmod_poly_mat_det(d, Ap);
+
+    len = FLINT_MIN(d->length, arg->len);
+    _nmod_vec_set(res, d->coeffs, len);
+    _nmod_vec_zero(res + len, arg->len - len);
+
+    nmod_poly_mat_clear(Ap);
+    nmod_poly_clear(d);
+
+    return 1;
+}
+
+/* sets t to the sum of the absolute values of the coefficients */
+static void
+_fmpz_poly_norm1(fmpz_t t, const fmpz_poly_t a)
+{
+    slong i;
+
+    fmpz_zero(t);
+    for (i = 0; i < a->length; i++)
+    {
+        if (fmpz_sgn(a->coeffs + i) >= 0)
+            fmpz_add(t, t, a->coeffs + i);
+        else
+            fmpz_sub(t, t, a->coeffs + i);
+    }
+}
+
+void
+fmpz_poly_mat_det_multi_mod(fmpz_poly_t det, const fmpz_poly_mat_t A)
+{
+    det_multi_mod_arg_t arg;
+    slong i, j, n, len, Dr, Dc;
+    fmpz * rs, * cs;
+    fmpz_t bound, t;
+    fmpz * res;
+    slong * rd, * cd;
+
+    n = A->r;
+
+    if (n == 0)
+    {
+        fmpz_poly_one(det);
+        return;
+    }
+
+    /*
+        The coefficients of det(A) are bounded by the permanent of the
+        matrix of 1-norms of the entries, hence by the product of its row
+        sums and by that of its column sums. The degree is bounded
+        likewise by the sums of the row and column degrees.
+    */
+    rs = _fmpz_vec_init(2 * n);
+    cs = rs + n;
+    rd = flint_malloc(2 * n * sizeof(slong));
+    cd = rd + n;
+    fmpz_init(bound);
+    fmpz_init(t);
+
+    for (i = 0; i < 2 * n; i++)
+        rd[i] = -1;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            const fmpz_poly_struct * a = fmpz_poly_mat_entry(A, i, j);
+
+            _fmpz_poly_norm1(t, a);
+            fmpz_add(rs + i, rs + i, t);
+            fmpz_add(cs + j, cs + j, t);
+            rd[i] = FLINT_MAX(rd[i], a->length - 1);
+            cd[j] = FLINT_MAX(cd[j], a->length - 1);
+        }
+    }
+
+    Dr = Dc = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (rd[i] < 0 || cd[i] < 0)
+            break;
+        Dr += rd[i];
+        Dc += cd[i];
+    }
+
+    if (i < n)
+    {
+        fmpz_poly_zero(det);
+    }
+    else
+    {
+        fmpz_one(bound);
+        fmpz_one(t);
+        for (i = 0; i < n; i++)
+        {
+            fmpz_mul(bound, bound, rs + i);
+            fmpz_mul(t, t, cs + i);
+        }
+        if (fmpz_cmp(t, bound) < 0)
+            fmpz_swap(t, bound);
+
+        len = FLINT_MIN(Dr, Dc) + 1;
+        res = _fmpz_vec_init(len);
+
+        arg.A = A;
+        arg.len = len;
+
+        _fmpz_vec_multi_mod_CRT_threaded(res, len, _fmpz_poly_mat_det_image,
+                            &arg, FLINT_BITS - 1, fmpz_bits(bound) + 1, 0);
+
+        fmpz_poly_fit_length(det, len);
+        _fmpz_vec_swap(det->coeffs, res, len);
+        _fmpz_poly_set_length(det, len);
+        _fmpz_poly_normalise(det);
+
+        _fmpz_vec_clear(res, len);
+    }
+
+    _fmpz_vec_clear(rs, 2 * n);
+    flint_free(rd);
+    fmpz_clear(bound);
+    fmpz_clear(t);
+}
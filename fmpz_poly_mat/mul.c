@@ -21,9 +21,14 @@ fmpz_poly_mat_mul(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
     if (A->r < 8 || B->r < 8 || B->c < 8)
     {
         fmpz_poly_mat_mul_classical(C, A, B);
+        return;
     }
-    else
+
+    if (_fmpz_poly_mat_mul_use_multi_mod(A, B))
     {
-        fmpz_poly_mat_mul_KS(C, A, B);
+        fmpz_poly_mat_mul_multi_mod(C, A, B);
+        return;
     }
+
+    fmpz_poly_mat_mul_KS(C, A, B);
 }
@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_mat.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    const fmpz_poly_mat_struct * A;
+    const fmpz_poly_mat_struct * B;
+    slong len;
+}
+mul_multi_mod_arg_t;
+
+static void
+_fmpz_poly_mat_get_nmod_poly_mat(nmod_poly_mat_t Ap, const fmpz_poly_mat_t A)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            fmpz_poly_get_nmod_poly(nmod_poly_mat_entry(Ap, i, j),
+                                    fmpz_poly_mat_entry(A, i, j));
+}
+
+/* the truncated product modulo p, entry (i, j) at offset (i c + j) len */
+static slong
+_fmpz_poly_mat_mul_image(mp_ptr res, mp_limb_t p, void * arg_ptr)
+{
+    mul_multi_mod_arg_t * arg = (mul_multi_mod_arg_t *) arg_ptr;
+    const fmpz_poly_mat_struct * A = arg->A;
+    const fmpz_poly_mat_struct * B = arg->B;
+    nmod_poly_mat_t Ap, Bp, Cp;
+    slong i, j, len = arg->len;
+
+    nmod_poly_mat_init(Ap, A->r, A->c, p);
+    nmod_poly_mat_init(Bp, B->r, B->c, p);
+    nmod_poly_mat_init(Cp, A->r, B->c, p);
+
+    _fmpz_poly_mat_get_nmod_poly_mat(Ap, A);
+    _fmpz_poly_mat_get_nmod_poly_mat(Bp, B);
+
+    nmod_poly_mat_mullow(Cp, Ap, Bp, len);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            nmod_poly_struct * c = nmod_poly_mat_entry(Cp, i, j);
+            mp_ptr r = res + (i * B->c + j) * len;
+            slong n = FLINT_MIN(c->length, len);
+
+            _nmod_vec_set(r, c->coeffs, n);
+            _nmod_vec_zero(r + n, len - n);
+        }
+    }
+
+    nmod_poly_mat_clear(Ap);
+    nmod_poly_mat_clear(Bp);
+    nmod_poly_mat_clear(Cp);
+
+    return 1;
+}
+
+int
+_fmpz_poly_mat_mul_use_multi_mod(const fmpz_poly_mat_t A,
+                                 const fmpz_poly_mat_t B)
+{
+    slong threads, len, bits;
+
+    threads = flint_get_num_threads();
+
+    if (threads <= 1 || A->r < 8 || B->r < 8 || B->c < 8)
+        return 0;
+
+    len = FLINT_MIN(fmpz_poly_mat_max_length(A), fmpz_poly_mat_max_length(B));
+
+    if (len < 4)
+        return 0;
+
+    bits = FLINT_ABS(fmpz_poly_mat_max_bits(A))
+         + FLINT_ABS(fmpz_poly_mat_max_bits(B));
+
+    /* no more threads than primes can take part */
+    threads = FLINT_MIN(threads, bits / (FLINT_BITS - 1) + 1);
+
+    /*
+        Single threaded, the multimodular product costs about
+        1 + 512 / bits times as much as KS, where bits is the sum of
+        the coefficient sizes, and up to twice that for entries shorter
+        than 16. Constant matrices are better left to KS.
+    */
+    return (threads - 1) * bits >= (len < 16 ? 2048 : 512);
+}
+
+void
+fmpz_poly_mat_mullow_multi_mod(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
+                               const fmpz_poly_mat_t B, slong len)
+{
+    mul_multi_mod_arg_t arg;
+    slong A_len, B_len, A_bits, B_bits, i, j;
+    mp_bitcnt_t bound;
+    fmpz * res;
+
+    if (A->r == 0 || B->c == 0)
+        return;
+
+    A_len = fmpz_poly_mat_max_length(A);
+    B_len = fmpz_poly_mat_max_length(B);
+
+    if (B->r == 0 || A_len == 0 || B_len == 0 || len <= 0)
+    {
+        fmpz_poly_mat_zero(C);
+        return;
+    }
+
+    len = FLINT_MIN(len, A_len + B_len - 1);
+
+    A_bits = FLINT_ABS(fmpz_poly_mat_max_bits(A));
+    B_bits = FLINT_ABS(fmpz_poly_mat_max_bits(B));
+
+    /*
+        Each coefficient of the product is a sum of at most
+        B->r min(A_len, B_len) products, one more bit for the sign.
+    */
+    bound = A_bits + B_bits + FLINT_BIT_COUNT(B->r)
+          + FLINT_BIT_COUNT(FLINT_MIN(A_len, B_len)) + 1;
+
+    res = _fmpz_vec_init(A->r * B->c * len);
+
+    arg.A = A;
+    arg.B = B;
+    arg.len = len;
+
+    _fmpz_vec_multi_mod_CRT_threaded(res, A->r * B->c * len,
+                   _fmpz_poly_mat_mul_image, &arg, FLINT_BITS - 1, bound, 0);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            fmpz_poly_struct * c = fmpz_poly_mat_entry(C, i, j);
+
+            fmpz_poly_fit_length(c, len);
+            _fmpz_vec_swap(c->coeffs, res + (i * B->c + j) * len, len);
+            _fmpz_poly_set_length(c, len);
+            _fmpz_poly_normalise(c);
+        }
+    }
+
+    _fmpz_vec_clear(res, A->r * B->c * len);
+}
+
+void
+fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
+                            const fmpz_poly_mat_t B)
+{
+    fmpz_poly_mat_mullow_multi_mod(C, A, B, WORD_MAX);
+}
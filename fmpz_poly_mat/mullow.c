@@ -42,6 +42,12 @@ fmpz_poly_mat_mullow(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
         return;
     }
 
+    if (_fmpz_poly_mat_mul_use_multi_mod(A, B))
+    {
+        fmpz_poly_mat_mullow_multi_mod(C, A, B, len);
+        return;
+    }
+
     fmpz_poly_init(t);
 
     for (i = 0; i < ar; i++)
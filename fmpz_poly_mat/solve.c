@@ -20,5 +20,8 @@ int
 fmpz_poly_mat_solve(fmpz_poly_mat_t X, fmpz_poly_t den,
                     const fmpz_poly_mat_t A, const fmpz_poly_mat_t B)
 {
-    return fmpz_poly_mat_solve_fflu(X, den, A, B);
+    if (fmpz_poly_mat_nrows(A) < 8)
+        return fmpz_poly_mat_solve_fflu(X, den, A, B);
+    else
+        return fmpz_poly_mat_solve_multi_mod(X, den, A, B);
 }
@@ -0,0 +1,221 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_mat.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    const fmpz_poly_mat_struct * A;
+    const fmpz_poly_mat_struct * B;
+    const fmpz_poly_struct * det;
+    slong len;
+}
+solve_multi_mod_arg_t;
+
+static void
+_fmpz_poly_mat_get_nmod_poly_mat(nmod_poly_mat_t Ap, const fmpz_poly_mat_t A)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            fmpz_poly_get_nmod_poly(nmod_poly_mat_entry(Ap, i, j),
+                                    fmpz_poly_mat_entry(A, i, j));
+}
+
+/* adj(A) B modulo p, entry (i, j) at offset (i c + j) len */
+static slong
+_fmpz_poly_mat_solve_image(mp_ptr res, mp_limb_t p, void * arg_ptr)
+{
+    solve_multi_mod_arg_t * arg = (solve_multi_mod_arg_t *) arg_ptr;
+    const fmpz_poly_mat_struct * A = arg->A;
+    const fmpz_poly_mat_struct * B = arg->B;
+    nmod_poly_mat_t Ap, Bp, Xp;
+    nmod_poly_t d, den;
+    slong i, j, len = arg->len;
+    int result;
+
+    nmod_poly_init(d, p);
+    fmpz_poly_get_nmod_poly(d, arg->det);
+
+    /* p divides the content of det(A) */
+    if (nmod_poly_is_zero(d))
+    {
+        nmod_poly_clear(d);
+        return 0;
+    }
+
+    nmod_poly_mat_init(Ap, A->r, A->c, p);
+    nmod_poly_mat_init(Bp, B->r, B->c, p);
+    nmod_poly_mat_init(Xp, B->r, B->c, p);
+    nmod_poly_init(den, p);
+
+    _fmpz_poly_mat_get_nmod_poly_mat(Ap, A);
+    _fmpz_poly_mat_get_nmod_poly_mat(Bp, B);
+
+    result = nmod_poly_mat_solve(Xp, den, Ap, Bp);
+
+    if (result)
+    {
+        /* scale so that the denominator is det(A) mod p */
+        nmod_poly_div(den, d, den);
+
+        for (i = 0; i < B->r; i++)
+        {
+            for (j = 0; j < B->c; j++)
+            {
+                nmod_poly_struct * x = nmod_poly_mat_entry(Xp, i, j);
+                mp_ptr r = res + (i * B->c + j) * len;
+                slong n;
+
+                nmod_poly_mul(x, x, den);
+                n = FLINT_MIN(x->length, len);
+                _nmod_vec_set(r, x->coeffs, n);
+                _nmod_vec_zero(r + n, len - n);
+            }
+        }
+    }
+
+    nmod_poly_mat_clear(Ap);
+    nmod_poly_mat_clear(Bp);
+    nmod_poly_mat_clear(Xp);
+    nmod_poly_clear(den);
+    nmod_poly_clear(d);
+
+    return result;
+}
+
+int
+fmpz_poly_mat_solve_multi_mod(fmpz_poly_mat_t X, fmpz_poly_t den,
+                    const fmpz_poly_mat_t A, const fmpz_poly_mat_t B)
+{
+    solve_multi_mod_arg_t arg;
+    slong i, j, k, n, m, len, Bdeg, Nr;
+    fmpz_t bound, s, t, u, v;
+    fmpz_poly_t d;
+    fmpz * res;
+
+    if (fmpz_poly_mat_is_empty(B))
+    {
+        fmpz_poly_one(den);
+        return 1;
+    }
+
+    fmpz_poly_init(d);
+    fmpz_poly_mat_det_multi_mod(d, A);
+
+    if (fmpz_poly_is_zero(d))
+    {
+        fmpz_poly_zero(den);
+        fmpz_poly_clear(d);
+        return 0;
+    }
+
+    n = A->r;
+    m = B->c;
+
+    fmpz_init(bound);
+    fmpz_init(s);
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+
+    /*
+        Entry (i, j) of adj(A) B is det(A) with column i replaced by
+        column j of B. Bound its coefficients by the product of the row
+        sums of 1-norms, each row sum including the largest 1-norm in
+        that row of B, and its degree by the sum of the row degrees.
+    */
+    Bdeg = fmpz_poly_mat_max_length(B) - 1;
+    fmpz_one(bound);
+    Nr = 0;
+
+    for (k = 0; k < n; k++)
+    {
+        slong rd = Bdeg;
+
+        fmpz_zero(s);
+        for (j = 0; j < n; j++)
+        {
+            const fmpz_poly_struct * a = fmpz_poly_mat_entry(A, k, j);
+
+            for (i = 0; i < a->length; i++)
+            {
+                fmpz_abs(u, a->coeffs + i);
+                fmpz_add(s, s, u);
+            }
+            rd = FLINT_MAX(rd, a->length - 1);
+        }
+
+        fmpz_zero(t);
+        for (j = 0; j < m; j++)
+        {
+            const fmpz_poly_struct * b = fmpz_poly_mat_entry(B, k, j);
+
+            fmpz_zero(v);
+            for (i = 0; i < b->length; i++)
+            {
+                fmpz_abs(u, b->coeffs + i);
+                fmpz_add(v, v, u);
+            }
+            if (fmpz_cmp(v, t) > 0)
+                fmpz_swap(v, t);
+        }
+
+        fmpz_add(s, s, t);
+        fmpz_mul(bound, bound, s);
+        Nr += FLINT_MAX(rd, 0);
+    }
+
+    len = Nr + 1;
+    res = _fmpz_vec_init(n * m * len);
+
+    arg.A = A;
+    arg.B = B;
+    arg.det = d;
+    arg.len = len;
+
+    _fmpz_vec_multi_mod_CRT_threaded(res, n * m * len,
+                   _fmpz_poly_mat_solve_image, &arg, FLINT_BITS - 1,
+                   fmpz_bits(bound) + 1, 0);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            fmpz_poly_struct * x = fmpz_poly_mat_entry(X, i, j);
+
+            fmpz_poly_fit_length(x, len);
+            _fmpz_vec_swap(x->coeffs, res + (i * m + j) * len, len);
+            _fmpz_poly_set_length(x, len);
+            _fmpz_poly_normalise(x);
+        }
+    }
+
+    fmpz_poly_swap(den, d);
+
+    _fmpz_vec_clear(res, n * m * len);
+    fmpz_poly_clear(d);
+    fmpz_clear(bound);
+    fmpz_clear(s);
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+
+    return 1;
+}
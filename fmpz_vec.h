@@ -207,6 +207,9 @@ FLINT_DLL void _fmpz_vec_scalar_submul_fmpz(fmpz * vec1, const fmpz * vec2,
 FLINT_DLL void _fmpz_vec_scalar_submul_si_2exp(fmpz * vec1, const fmpz * vec2, 
                                                slong len2, slong c, ulong exp);
 
+FLINT_DLL void _fmpz_vec_scalar_submul_si_multi(fmpz * vec1,
+            fmpz * const * vecs, const slong * c, slong num, slong len);
+
 /*  Vector sum and product  **************************************************/
 
 FLINT_DLL void _fmpz_vec_sum(fmpz_t res, const fmpz * vec, slong len);
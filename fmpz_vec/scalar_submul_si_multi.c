@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+#define SIGN_EXT(x) ((mp_limb_t) (((slong) (x)) >> (FLINT_BITS - 1)))
+
+void
+_fmpz_vec_scalar_submul_si_multi(fmpz * vec1, fmpz * const * vecs,
+                                 const slong * c, slong num, slong len)
+{
+    mp_limb_t a2, a1, a0, p1, p0;
+    slong i, j, k, nbig;
+    slong * big;
+    TMP_INIT;
+
+    TMP_START;
+    big = TMP_ALLOC(len * sizeof(slong));
+    nbig = 0;
+
+    /*
+        Columns whose entries are all small are done in one go, the sum
+        being accumulated in three limbs: the products take two limbs and
+        there are far fewer than 2^62 of them.
+    */
+    for (k = 0; k < len; k++)
+    {
+        if (!COEFF_IS_MPZ(vec1[k]))
+        {
+            a0 = vec1[k];
+            a1 = a2 = SIGN_EXT(a0);
+
+            for (i = 0; i < num; i++)
+            {
+                fmpz v = vecs[i][k];
+
+                if (COEFF_IS_MPZ(v))
+                    break;
+
+                smul_ppmm(p1, p0, v, c[i]);
+                sub_dddmmmsss(a2, a1, a0, a2, a1, a0, SIGN_EXT(p1), p1, p0);
+            }
+
+            if (i == num)
+            {
+                fmpz_set_signed_uiuiui(vec1 + k, a2, a1, a0);
+                continue;
+            }
+        }
+
+        big[nbig++] = k;
+    }
+
+    /* the others are done a row at a time, which suits multiprecision */
+    for (i = 0; i < num; i++)
+    {
+        for (j = 0; j < nbig; j++)
+        {
+            fmpz * r = vec1 + big[j];
+            const fmpz * v = vecs[i] + big[j];
+
+            if (c[i] == 1)
+                fmpz_sub(r, r, v);
+            else if (c[i] == -1)
+                fmpz_add(r, r, v);
+            else if (c[i] >= 0)
+                fmpz_submul_ui(r, v, c[i]);
+            else
+                fmpz_addmul_ui(r, v, -(ulong) c[i]);
+        }
+    }
+
+    TMP_END;
+}
@@ -37,6 +37,8 @@
 #define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
 #define FQ_NMOD_POLY_GCD_CUTOFF 120
 
+#define FQ_NMOD_POLY_TREE_THREADED_CUTOFF 256 /* Subproduct trees: serial -> threaded */
+
 
 #ifdef T
 #undef T
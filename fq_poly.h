@@ -36,6 +36,8 @@
 #define FQ_POLY_SMALL_GCD_CUTOFF 80
 #define FQ_POLY_GCD_CUTOFF 90
 
+#define FQ_POLY_TREE_THREADED_CUTOFF 256 /* Subproduct trees: serial -> threaded */
+
 #ifdef T
 #undef T
 #endif
@@ -20,7 +20,7 @@ TEMPLATE(T, poly_iterated_frobenius_preinv) (TEMPLATE(T, poly_t) * rop,
                                              const TEMPLATE(T, poly_t) vinv,
                                              const TEMPLATE(T, ctx_t) ctx)
 {
-    slong i;
+    slong i, k, c;
     fmpz_t q;
     TEMPLATE(T, mat_t) HH;
 
@@ -29,7 +29,37 @@ TEMPLATE(T, poly_iterated_frobenius_preinv) (TEMPLATE(T, poly_t) * rop,
     TEMPLATE(T, ctx_order) (q, ctx);
     TEMPLATE(T, poly_gen) (rop[0], ctx);
 
-    if (TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length))
+    if (TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length)
+        && flint_get_num_threads() > 1 && n > 2 && v->length > 2)
+    {
+        /*
+            Doubling: given x^(q^i) for 1 <= i <= k, the next k powers are
+            x^(q^i) composed with x^(q^k), computed as one threaded vector
+            composition.
+        */
+        TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop[1], rop[0], q, 0, v,
+                                                      vinv, ctx);
+        for (k = 1; k < n - 1; k *= 2)
+        {
+            c = FLINT_MIN(k, n - 1 - k);
+
+            for (i = 0; i < c; i++)
+            {
+                TEMPLATE(T, poly_fit_length) (rop[k + 1 + i], v->length - 1,
+                                              ctx);
+                _TEMPLATE(T, poly_set_length) (rop[k + 1 + i],
+                                               v->length - 1, ctx);
+            }
+
+            _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded)
+                (*(rop + k + 1), *(rop + 1), k, c, v->coeffs, v->length,
+                 vinv->coeffs, vinv->length, ctx);
+
+            for (i = 0; i < c; i++)
+                _TEMPLATE(T, poly_normalise) (rop[k + 1 + i], ctx);
+        }
+    }
+    else if (TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length))
     {
         TEMPLATE(T, mat_init) (HH, n_sqrt(v->length - 1) + 1, v->length - 1,
                                ctx);
@@ -31,6 +31,8 @@ main(void)
         TEMPLATE(T, ctx_t) ctx;
         TEMPLATE(T, poly_t) v, vinv, *h1, *h2;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         TEMPLATE(T, ctx_randtest) (ctx, state);
 
         fmpz_init(q);
@@ -45,7 +47,7 @@ main(void)
         TEMPLATE(T, poly_reverse) (vinv, v, v->length, ctx);
         TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, v->length, ctx);
 
-        n = n_randint(state, 5) + 2;
+        n = n_randint(state, 10) + 2;
         if (!(h1 = flint_malloc((2 * n) * sizeof(TEMPLATE(T, poly_struct)))))
         {
             flint_printf("Exception (t-fq_poly_iterated_frobenius_preinv):\n");
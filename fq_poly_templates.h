@@ -1159,6 +1159,19 @@ FLINT_DLL void TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)(
     const TEMPLATE(T, poly_t) poly3inv,
     const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL void _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded)(
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong lenpolys, slong l,
+    const TEMPLATE(T, struct) * poly, slong len,
+    const TEMPLATE(T, struct) * polyinv, slong leninv,
+    const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded)(
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1, slong n,
+    const TEMPLATE(T, poly_t) poly, const TEMPLATE(T, poly_t) polyinv,
+    const TEMPLATE(T, ctx_t) ctx);
+
 /*  Input and output  ********************************************************/
 
 FLINT_DLL int _TEMPLATE(T, poly_fprint_pretty)(FILE *file,
@@ -0,0 +1,240 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include <pthread.h>
+#include "templates.h"
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * res;
+    const TEMPLATE(T, poly_struct) * polys;
+    const TEMPLATE(T, mat_struct) * A;
+    const TEMPLATE(T, struct) * h;
+    const TEMPLATE(T, struct) * poly;
+    const TEMPLATE(T, struct) * polyinv;
+    slong j0;
+    slong j1;
+    slong k;
+    slong len;
+    slong leninv;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, compose_vec_arg_t);
+
+/*
+    Composes polys[j0], ..., polys[j1 - 1] with the polynomial whose powers
+    are the rows of A; h is the m-th power. Each thread forms its own slice
+    of the Brent-Kung matrix product, so that both the product and the
+    Horner evaluations are distributed.
+*/
+void *
+_TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_worker)(void * arg_ptr)
+{
+    TEMPLATE(T, compose_vec_arg_t) arg =
+                            *((TEMPLATE(T, compose_vec_arg_t) *) arg_ptr);
+    const TEMPLATE(T, ctx_struct) * ctx = arg.ctx;
+    TEMPLATE(T, mat_t) B, C;
+    TEMPLATE(T, struct) * t;
+    slong i, j, n, m, k, num, len1;
+
+    n = arg.len - 1;
+    m = arg.A->r;
+    k = arg.k;
+    num = arg.j1 - arg.j0;
+
+    TEMPLATE(T, mat_init) (B, k * num, m, ctx);
+    TEMPLATE(T, mat_init) (C, k * num, n, ctx);
+    t = _TEMPLATE(T, vec_init) (n, ctx);
+
+    /* Set rows of B to the segments of polys */
+    for (j = 0; j < num; j++)
+    {
+        const TEMPLATE(T, poly_struct) * f = arg.polys + arg.j0 + j;
+
+        len1 = f->length;
+        for (i = 0; i < len1 / m; i++)
+            _TEMPLATE(T, vec_set) (B->rows[i + j * k], f->coeffs + i * m, m,
+                                   ctx);
+        _TEMPLATE(T, vec_set) (B->rows[i + j * k], f->coeffs + i * m,
+                               len1 % m, ctx);
+    }
+
+    TEMPLATE(T, mat_mul) (C, B, arg.A, ctx);
+
+    /* Evaluate block composition using the Horner scheme */
+    for (j = 0; j < num; j++)
+    {
+        TEMPLATE(T, struct) * r = (arg.res + arg.j0 + j)->coeffs;
+
+        _TEMPLATE(T, vec_set) (r, C->rows[(j + 1) * k - 1], n, ctx);
+        for (i = 2; i <= k; i++)
+        {
+            _TEMPLATE(T, poly_mulmod_preinv) (t, r, n, arg.h, n, arg.poly,
+                                   arg.len, arg.polyinv, arg.leninv, ctx);
+            _TEMPLATE(T, poly_add) (r, t, n, C->rows[(j + 1) * k - i], n,
+                                    ctx);
+        }
+    }
+
+    _TEMPLATE(T, vec_clear) (t, n, ctx);
+    TEMPLATE(T, mat_clear) (B, ctx);
+    TEMPLATE(T, mat_clear) (C, ctx);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded) (
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong lenpolys, slong l,
+    const TEMPLATE(T, struct) * poly, slong len,
+    const TEMPLATE(T, struct) * polyinv, slong leninv,
+    const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, mat_t) A;
+    TEMPLATE(T, struct) * h;
+    const TEMPLATE(T, poly_struct) * g = polys + lenpolys - 1;
+    slong i, n, m, k, num_threads;
+    pthread_t * threads;
+    TEMPLATE(T, compose_vec_arg_t) * args;
+
+    n = len - 1;
+    m = n_sqrt(n * l) + 1;
+    k = len / m + 1;
+
+    TEMPLATE(T, mat_init) (A, m, n, ctx);
+    h = _TEMPLATE(T, vec_init) (n, ctx);
+
+    /* Set rows of A to powers of last element of polys */
+    TEMPLATE(T, one) (A->rows[0], ctx);
+    _TEMPLATE(T, vec_set) (A->rows[1], g->coeffs, g->length, ctx);
+    for (i = 2; i < m; i++)
+        _TEMPLATE(T, poly_mulmod_preinv) (A->rows[i], A->rows[i - 1], n,
+                       A->rows[1], n, poly, len, polyinv, leninv, ctx);
+
+    _TEMPLATE(T, poly_mulmod_preinv) (h, A->rows[m - 1], n, A->rows[1], n,
+                                      poly, len, polyinv, leninv, ctx);
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), l);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(TEMPLATE(T, compose_vec_arg_t)) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res     = res;
+        args[i].polys   = polys;
+        args[i].A       = A;
+        args[i].h       = h;
+        args[i].poly    = poly;
+        args[i].polyinv = polyinv;
+        args[i].j0      = (l * i) / num_threads;
+        args[i].j1      = (l * (i + 1)) / num_threads;
+        args[i].k       = k;
+        args[i].len     = len;
+        args[i].leninv  = leninv;
+        args[i].ctx     = ctx;
+    }
+
+    if (num_threads <= 1)
+    {
+        _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_worker) (args);
+    }
+    else
+    {
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL,
+                _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_worker),
+                &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+
+    _TEMPLATE(T, vec_clear) (h, n, ctx);
+    TEMPLATE(T, mat_clear) (A, ctx);
+}
+
+void
+TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded) (
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1, slong n,
+    const TEMPLATE(T, poly_t) poly, const TEMPLATE(T, poly_t) polyinv,
+    const TEMPLATE(T, ctx_t) ctx)
+{
+    slong len2 = poly->length;
+    slong i;
+
+    for (i = 0; i < len1; i++)
+    {
+        if ((polys + i)->length >= len2)
+        {
+            TEMPLATE_PRINTF("Exception (%s_poly_compose_mod_brent_kung_vec_"
+                            "preinv_threaded). The degree of the\n", T);
+            flint_printf("first polynomial must be smaller than that of the "
+                         "modulus.\n");
+            flint_abort();
+        }
+    }
+
+    if (n > len1)
+    {
+        TEMPLATE_PRINTF("Exception (%s_poly_compose_mod_brent_kung_vec_"
+                        "preinv_threaded). n is larger than the\n", T);
+        flint_printf("length of polys.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+        return;
+
+    if (len2 == 1)
+    {
+        for (i = 0; i < n; i++)
+            TEMPLATE(T, poly_init) (res + i, ctx);
+        return;
+    }
+
+    if (len2 == 2)
+    {
+        for (i = 0; i < n; i++)
+        {
+            TEMPLATE(T, poly_init) (res + i, ctx);
+            TEMPLATE(T, poly_set) (res + i, polys + i, ctx);
+        }
+        return;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        TEMPLATE(T, poly_init2) (res + i, len2 - 1, ctx);
+        _TEMPLATE(T, poly_set_length) (res + i, len2 - 1, ctx);
+    }
+
+    _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded) (res, polys,
+                                     len1, n, poly->coeffs, len2,
+                                     polyinv->coeffs, polyinv->length, ctx);
+
+    for (i = 0; i < n; i++)
+        _TEMPLATE(T, poly_normalise) (res + i, ctx);
+}
+
+#endif
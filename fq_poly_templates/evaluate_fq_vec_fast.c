@@ -13,8 +13,163 @@
 
 #ifdef T
 
+#include <pthread.h>
 #include "templates.h"
 
+/*
+    If poly is not NULL, reduces (poly, plen) modulo the blocks b0, ..., b1 - 1
+    of level i, writing to u. Otherwise, reduces the pairs of blocks
+    b0, ..., b1 - 1 of level i + 1 in t modulo their children.
+*/
+static void
+_TEMPLATE(T, poly_evaluate_level)(TEMPLATE(T, struct) * u,
+                                  const TEMPLATE(T, struct) * t,
+                                  const TEMPLATE(T, struct) * poly, slong plen,
+                                  TEMPLATE(T, poly_struct) * const * tree,
+                                  slong len, slong i, slong b0, slong b1,
+                                  const TEMPLATE(T, ctx_t) ctx)
+{
+    slong pow, left;
+    TEMPLATE(T, t) inv;
+    const TEMPLATE(T, struct) * pb;
+    TEMPLATE(T, struct) * pc;
+    TEMPLATE(T, poly_struct) * pa;
+
+    TEMPLATE(T, init)(inv, ctx);
+
+    pow = WORD(1) << i;
+
+    if (poly != NULL)
+    {
+        for (pa = tree[i] + b0; b0 < b1; b0++, pa++)
+        {
+            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
+            _TEMPLATE(T, poly_rem)(u + b0 * pow, poly, plen, pa->coeffs, pa->length, inv, ctx);
+        }
+
+        TEMPLATE(T, clear)(inv, ctx);
+        return;
+    }
+
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + 2 * b0;
+    pb = t + b0 * 2 * pow;
+    pc = u + b0 * 2 * pow;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
+        _TEMPLATE(T, poly_rem)(pc, pb, 2 * pow, pa->coeffs, pa->length, inv, ctx);
+
+        pa++;
+        TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
+        _TEMPLATE(T, poly_rem)(pc + pow, pb, 2 * pow, pa->coeffs, pa->length, inv, ctx);
+
+        pa++;
+        pb += 2 * pow;
+        pc += 2 * pow;
+        left -= 2 * pow;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
+            _TEMPLATE(T, poly_rem)(pc, pb, left, pa->coeffs, pa->length, inv, ctx);
+
+            pa ++;
+            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
+            _TEMPLATE(T, poly_rem)(pc + pow, pb, left, pa->coeffs, pa->length, inv, ctx);
+        }
+        else if (left > 0)
+            _TEMPLATE(T, vec_set)(pc, pb, left, ctx);
+    }
+
+    TEMPLATE(T, clear)(inv, ctx);
+}
+
+typedef struct
+{
+    TEMPLATE(T, struct) * u;
+    const TEMPLATE(T, struct) * t;
+    const TEMPLATE(T, struct) * poly;
+    slong plen;
+    TEMPLATE(T, poly_struct) * const * tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, evaluate_level_arg_t);
+
+void *
+_TEMPLATE(T, poly_evaluate_level_worker)(void * arg_ptr)
+{
+    TEMPLATE(T, evaluate_level_arg_t) arg =
+                            *((TEMPLATE(T, evaluate_level_arg_t) *) arg_ptr);
+
+    _TEMPLATE(T, poly_evaluate_level)(arg.u, arg.t, arg.poly, arg.plen,
+                  arg.tree, arg.len, arg.i, arg.b0, arg.b1, arg.ctx);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_TEMPLATE(T, poly_evaluate_level_threaded)(TEMPLATE(T, struct) * u,
+                                  const TEMPLATE(T, struct) * t,
+                                  const TEMPLATE(T, struct) * poly, slong plen,
+                                  TEMPLATE(T, poly_struct) * const * tree,
+                                  slong len, slong i,
+                                  const TEMPLATE(T, ctx_t) ctx)
+{
+    slong blocks, j, num_threads;
+    pthread_t * threads;
+    TEMPLATE(T, evaluate_level_arg_t) * args;
+
+    /* the blocks of level i, or the pairs of blocks of level i + 1 */
+    blocks = (poly != NULL) ? ((len - 1) >> i) + 1 : ((len - 1) >> (i + 1)) + 1;
+
+    num_threads = (len < TEMPLATE(CAP_T, POLY_TREE_THREADED_CUTOFF)) ?
+                                            1 : flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, blocks);
+
+    if (num_threads <= 1)
+    {
+        _TEMPLATE(T, poly_evaluate_level)(u, t, poly, plen, tree, len, i,
+                                                           0, blocks, ctx);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(TEMPLATE(T, evaluate_level_arg_t)) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        args[j].u = u;
+        args[j].t = t;
+        args[j].poly = poly;
+        args[j].plen = plen;
+        args[j].tree = tree;
+        args[j].len = len;
+        args[j].i = i;
+        args[j].b0 = (blocks * j) / num_threads;
+        args[j].b1 = (blocks * (j + 1)) / num_threads;
+        args[j].ctx = ctx;
+
+        pthread_create(&threads[j], NULL,
+                       _TEMPLATE(T, poly_evaluate_level_worker), &args[j]);
+    }
+
+    for (j = 0; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _TEMPLATE4(T, poly_evaluate, T, vec_fast_precomp)
     (TEMPLATE(T, struct) * vs,
@@ -22,96 +177,52 @@ _TEMPLATE4(T, poly_evaluate, T, vec_fast_precomp)
      TEMPLATE(T, poly_struct) * const * tree, slong len,
      const TEMPLATE(T, ctx_t) ctx)
 {
-    slong height, i, j, pow, left;
+    slong height, i;
     slong tree_height;
-    TEMPLATE(T, t) temp, inv;
-    TEMPLATE(T, struct) * t, * u, * pb, * pc, * swap;
-    TEMPLATE(T, poly_struct) * pa;
-
-    TEMPLATE(T, init)(temp, ctx);
-    TEMPLATE(T, init)(inv, ctx);
+    TEMPLATE(T, t) temp;
+    TEMPLATE(T, struct) * t, * u, * swap;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
     {
         if (len == 1)
         {
+            TEMPLATE(T, init)(temp, ctx);
             TEMPLATE(T, neg)(temp, tree[0]->coeffs, ctx);
             _TEMPLATE3(T, poly_evaluate, T)(vs, poly, plen, temp, ctx);
+            TEMPLATE(T, clear)(temp, ctx);
         } else if (len != 0 && plen == 0)
             _TEMPLATE(T, vec_zero)(vs, len, ctx);
         else if (len != 0 && plen == 1)
             for (i = 0; i < len; i++)
                 TEMPLATE(T, set)(vs + i, poly, ctx);
         
-        TEMPLATE(T, clear)(temp, ctx);
         return;
     }
 
     t = _TEMPLATE(T, vec_init)(2*len, ctx);
     u = _TEMPLATE(T, vec_init)(2*len, ctx);
 
-    left = len;
-
     /* Initial reduction. We allow the polynomial to be larger
        or smaller than the number of points. */
     height = FLINT_BIT_COUNT(plen - 1) - 1;
     tree_height = FLINT_CLOG2(len);
     while (height >= tree_height)
         height--;
-    pow = WORD(1) << height;
 
-    for (i = j = 0; i < len; i += pow, j++)
-    {
-        pa = tree[height] + j;
-        TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
-        _TEMPLATE(T, poly_rem)(t + i, poly, plen, pa->coeffs, pa->length, inv, ctx);
-    }
+    _TEMPLATE(T, poly_evaluate_level_threaded)(t, NULL, poly, plen,
+                                               tree, len, height, ctx);
 
     for (i = height - 1; i >= 0; i--)
     {
-        pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
-
-        left = len;
-        while (left >= 2 * pow)
-        {
-            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
-            _TEMPLATE(T, poly_rem)(pc, pb, 2 * pow, pa->coeffs, pa->length, inv, ctx);
-            
-            pa++;
-            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
-            _TEMPLATE(T, poly_rem)(pc + pow, pb, 2 * pow, pa->coeffs, pa->length, inv, ctx);
-            
-            pa++;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
-        
-        if (left > pow)
-        {
-            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
-            _TEMPLATE(T, poly_rem)(pc, pb, left, pa->coeffs, pa->length, inv, ctx);
-            
-            pa ++;
-            TEMPLATE(T, inv)(inv, pa->coeffs + pa->length - 1, ctx);
-            _TEMPLATE(T, poly_rem)(pc + pow, pb, left, pa->coeffs, pa->length, inv, ctx);
-        }
-        else if (left > 0)
-            _TEMPLATE(T, vec_set)(pc, pb, left, ctx);
+        _TEMPLATE(T, poly_evaluate_level_threaded)(u, t, NULL, 0,
+                                                   tree, len, i, ctx);
 
         swap = t;
         t = u;
         u = swap;
     }
 
-    TEMPLATE(T, clear)(temp, ctx);
-    TEMPLATE(T, clear)(inv, ctx);
-
     _TEMPLATE(T, vec_set)(vs, t, len, ctx);
 
     _TEMPLATE(T, vec_clear)(t, 2*len, ctx);
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("compose_mod_brent_kung_vec_preinv_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) a, ainv, b, c;
+        TEMPLATE(T, poly_struct) * pow, * res;
+        slong j, k, l;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (a, ctx);
+        TEMPLATE(T, poly_init) (ainv, ctx);
+        TEMPLATE(T, poly_init) (b, ctx);
+        TEMPLATE(T, poly_init) (c, ctx);
+
+        TEMPLATE(T, poly_randtest_not_zero) (a, state,
+                                             n_randint(state, 20) + 1, ctx);
+        TEMPLATE(T, poly_randtest) (b, state, n_randint(state, 20) + 1, ctx);
+        l = n_randint(state, 20) + 1;
+        k = n_randint(state, l) + 1;
+
+        TEMPLATE(T, poly_rem) (b, b, a, ctx);
+        TEMPLATE(T, poly_reverse) (ainv, a, a->length, ctx);
+        TEMPLATE(T, poly_inv_series_newton) (ainv, ainv, a->length, ctx);
+
+        pow = flint_malloc((l + k) * sizeof(TEMPLATE(T, poly_struct)));
+        res = pow + l;
+
+        for (j = 0; j < l - 1; j++)
+        {
+            TEMPLATE(T, poly_init) (pow + j, ctx);
+            TEMPLATE(T, poly_randtest) (pow + j, state,
+                                        n_randint(state, 20) + 1, ctx);
+            TEMPLATE(T, poly_rem) (pow + j, pow + j, a, ctx);
+        }
+
+        TEMPLATE(T, poly_init) (pow + l - 1, ctx);
+        TEMPLATE(T, poly_set) (pow + l - 1, b, ctx);
+
+        TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv_threaded) (res,
+                                                  pow, l, k, a, ainv, ctx);
+
+        for (j = 0; j < k; j++)
+        {
+            TEMPLATE(T, poly_compose_mod) (c, pow + j, b, a, ctx);
+
+            if (!TEMPLATE(T, poly_equal) (res + j, c, ctx))
+            {
+                flint_printf("FAIL (composition):\n");
+                flint_printf("a:\n");
+                TEMPLATE(T, poly_print) (a, ctx);
+                flint_printf("\n");
+                flint_printf("res:\n");
+                TEMPLATE(T, poly_print) (res + j, ctx);
+                flint_printf("\n");
+                flint_printf("pow:\n");
+                TEMPLATE(T, poly_print) (pow + j, ctx);
+                flint_printf("\n");
+                flint_printf("b:\n");
+                TEMPLATE(T, poly_print) (b, ctx);
+                flint_printf("\n");
+                flint_printf("c:\n");
+                TEMPLATE(T, poly_print) (c, ctx);
+                flint_printf("\n");
+                flint_printf("j: %wd\n", j);
+                abort();
+            }
+        }
+
+        TEMPLATE(T, poly_clear) (a, ctx);
+        TEMPLATE(T, poly_clear) (ainv, ctx);
+        TEMPLATE(T, poly_clear) (b, ctx);
+        TEMPLATE(T, poly_clear) (c, ctx);
+        for (j = 0; j < l; j++)
+            TEMPLATE(T, poly_clear) (pow + j, ctx);
+        for (j = 0; j < k; j++)
+            TEMPLATE(T, poly_clear) (res + j, ctx);
+        flint_free(pow);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
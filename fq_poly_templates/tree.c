@@ -13,6 +13,7 @@
 
 #ifdef T
 
+#include <pthread.h>
 #include "templates.h"
 
 TEMPLATE(T, poly_struct) **
@@ -56,14 +57,85 @@ _TEMPLATE(T, poly_tree_free)(TEMPLATE(T, poly_struct) ** tree, slong len,
     }
 }
 
+/* computes tree[i + 1] from tree[i] for the pairs of blocks b0, ..., b1 - 1 */
+static void
+_TEMPLATE(T, poly_tree_build_level)(TEMPLATE(T, poly_struct) ** tree,
+                                    slong len, slong i, slong b0, slong b1,
+                                    const TEMPLATE(T, ctx_t) ctx)
+{
+    slong pow, left;
+    TEMPLATE(T, poly_struct) * pa, * pb;
+
+    pow = WORD(1) << i;
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + 2 * b0;
+    pb = tree[i + 1] + b0;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        TEMPLATE(T, poly_fit_length)(pb, pa->length + (pa + 1)->length - 1,
+                                     ctx);
+        _TEMPLATE(T, poly_mul)(pb->coeffs,
+                               pa->coeffs, pa->length,
+                               (pa + 1)->coeffs, (pa + 1)->length,
+                               ctx);
+        _TEMPLATE(T, poly_set_length)(pb, pa->length + (pa + 1)->length - 1,
+                                      ctx);
+        left -= 2 * pow;
+        pa += 2;
+        pb += 1;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            TEMPLATE(T, poly_fit_length)(pb, pa->length + (pa + 1)->length - 1,
+                                         ctx);
+            _TEMPLATE(T, poly_mul)(pb->coeffs,
+                                   pa->coeffs, pa->length,
+                                   (pa + 1)->coeffs, (pa + 1)->length,
+                                   ctx);
+            _TEMPLATE(T, poly_set_length)(pb, pa->length + (pa + 1)->length - 1,
+                                          ctx);
+        } else if (left > 0)
+            TEMPLATE(T, poly_set)(pb, pa, ctx);
+    }
+}
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) ** tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, tree_build_arg_t);
+
+void *
+_TEMPLATE(T, poly_tree_build_worker)(void * arg_ptr)
+{
+    TEMPLATE(T, tree_build_arg_t) arg =
+                                *((TEMPLATE(T, tree_build_arg_t) *) arg_ptr);
+
+    _TEMPLATE(T, poly_tree_build_level)(arg.tree, arg.len, arg.i,
+                                        arg.b0, arg.b1, arg.ctx);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _TEMPLATE(T, poly_tree_build)(TEMPLATE(T, poly_struct) ** tree,
                               const TEMPLATE(T, struct) * roots,
                               slong len,
                               const TEMPLATE(T, ctx_t) ctx)
 {
-    slong height, pow, left, i;
-    TEMPLATE(T, poly_struct) * pa, * pb;
+    slong height, pairs, i, j, num_threads;
+    pthread_t * threads;
+    TEMPLATE(T, tree_build_arg_t) * args;
 
     if (len == 0)
         return;
@@ -77,42 +149,45 @@ _TEMPLATE(T, poly_tree_build)(TEMPLATE(T, poly_struct) ** tree,
         TEMPLATE(T, neg)((tree[0] + i)->coeffs, roots + i, ctx);
     }
 
+    num_threads = (len < TEMPLATE(CAP_T, POLY_TREE_THREADED_CUTOFF)) ?
+                                            1 : flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(TEMPLATE(T, tree_build_arg_t)) * num_threads);
+
+    /* the products at each level are independent, so the pairs of blocks
+       are split between the threads */
     for (i = 0; i < height - 1; i++)
     {
-        left = len;
-        pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        slong nt;
 
-        while (left >= 2 * pow)
+        pairs = ((len - 1) >> (i + 1)) + 1;
+        nt = FLINT_MIN(num_threads, pairs);
+
+        if (nt <= 1)
         {
-            TEMPLATE(T, poly_fit_length)(pb, pa->length + (pa + 1)->length - 1,
-                                         ctx);
-            _TEMPLATE(T, poly_mul)(pb->coeffs,
-                                   pa->coeffs, pa->length,
-                                   (pa + 1)->coeffs, (pa + 1)->length,
-                                   ctx);
-            _TEMPLATE(T, poly_set_length)(pb, pa->length + (pa + 1)->length - 1,
-                                          ctx);
-            left -= 2 * pow;
-            pa += 2;
-            pb += 1;
+            _TEMPLATE(T, poly_tree_build_level)(tree, len, i, 0, pairs, ctx);
+            continue;
         }
 
-        if (left > pow)
+        for (j = 0; j < nt; j++)
         {
-            TEMPLATE(T, poly_fit_length)(pb, pa->length + (pa + 1)->length - 1,
-                                         ctx);
-            _TEMPLATE(T, poly_mul)(pb->coeffs,
-                                   pa->coeffs, pa->length,
-                                   (pa + 1)->coeffs, (pa + 1)->length,
-                                   ctx);
-            _TEMPLATE(T, poly_set_length)(pb, pa->length + (pa + 1)->length - 1,
-                                          ctx);
-        } else if (left > 0)
-            TEMPLATE(T, poly_set)(pb, pa, ctx);
+            args[j].tree = tree;
+            args[j].len = len;
+            args[j].i = i;
+            args[j].b0 = (pairs * j) / nt;
+            args[j].b1 = (pairs * (j + 1)) / nt;
+            args[j].ctx = ctx;
+
+            pthread_create(&threads[j], NULL,
+                           _TEMPLATE(T, poly_tree_build_worker), &args[j]);
+        }
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
     }
-}
 
+    flint_free(threads);
+    flint_free(args);
+}
 
 #endif
@@ -36,6 +36,8 @@
 #define FQ_ZECH_POLY_GCD_CUTOFF 96
 #define FQ_ZECH_POLY_SMALL_GCD_CUTOFF 96
 
+#define FQ_ZECH_POLY_TREE_THREADED_CUTOFF 256 /* Subproduct trees: serial -> threaded */
+
 #ifdef T
 #undef T
 #endif
@@ -0,0 +1,180 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#ifdef GF2_MAT_INLINES_C
+#define GF2_MAT_INLINE FLINT_DLL
+#else
+#define GF2_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Entry (i, j) is bit j % FLINT_BITS of rows[i][j / FLINT_BITS]. Each row
+    takes stride limbs, and the unused bits of the last limb of each row
+    are always zero.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong r;
+    slong c;
+    slong stride;
+    mp_limb_t ** rows;
+}
+gf2_mat_struct;
+
+/* gf2_mat_t allows reference-like semantics for gf2_mat_struct */
+typedef gf2_mat_struct gf2_mat_t[1];
+
+/* Number of limbs needed for a row of c entries */
+#define GF2_MAT_ROW_LIMBS(c) (((c) + FLINT_BITS - 1) / FLINT_BITS)
+
+GF2_MAT_INLINE
+int gf2_mat_get_entry(const gf2_mat_t mat, slong i, slong j)
+{
+    return (mat->rows[i][j / FLINT_BITS] >> (j % FLINT_BITS)) & 1;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_set_entry(gf2_mat_t mat, slong i, slong j, int x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        mat->rows[i][j / FLINT_BITS] |= bit;
+    else
+        mat->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_nrows(const gf2_mat_t mat)
+{
+    return mat->r;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_ncols(const gf2_mat_t mat)
+{
+    return mat->c;
+}
+
+/* Bit vectors */
+
+/* Returns the k <= FLINT_BITS bits of vec starting at bit off */
+GF2_MAT_INLINE
+mp_limb_t _gf2_vec_get_bits(mp_srcptr vec, slong off, int k)
+{
+    int s = off % FLINT_BITS;
+    mp_limb_t x = vec[off / FLINT_BITS] >> s;
+
+    if (s != 0 && s + k > FLINT_BITS)
+        x |= vec[off / FLINT_BITS + 1] << (FLINT_BITS - s);
+
+    if (k < FLINT_BITS)
+        x &= (UWORD(1) << k) - 1;
+
+    return x;
+}
+
+FLINT_DLL void _gf2_vec_copy_bits(mp_ptr res, slong roff, mp_srcptr vec,
+                                  slong off, slong len);
+
+/* Memory management */
+FLINT_DLL void gf2_mat_init(gf2_mat_t mat, slong rows, slong cols);
+FLINT_DLL void gf2_mat_init_set(gf2_mat_t mat, const gf2_mat_t src);
+FLINT_DLL void gf2_mat_clear(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_set(gf2_mat_t mat, const gf2_mat_t src);
+
+GF2_MAT_INLINE
+void gf2_mat_swap(gf2_mat_t mat1, gf2_mat_t mat2)
+{
+    gf2_mat_struct t = *mat1;
+    *mat1 = *mat2;
+    *mat2 = t;
+}
+
+/* Basic properties and manipulation */
+FLINT_DLL void gf2_mat_zero(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_one(gf2_mat_t mat);
+FLINT_DLL int gf2_mat_equal(const gf2_mat_t mat1, const gf2_mat_t mat2);
+FLINT_DLL int gf2_mat_is_zero(const gf2_mat_t mat);
+
+/* Random matrix generation */
+FLINT_DLL void gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state);
+
+/* Input and output */
+FLINT_DLL void gf2_mat_print_pretty(const gf2_mat_t mat);
+
+/* Conversions */
+FLINT_DLL void gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A);
+FLINT_DLL void gf2_mat_get_nmod_mat(nmod_mat_t B, const gf2_mat_t A);
+
+/* Transpose and concatenation */
+FLINT_DLL void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+FLINT_DLL void gf2_mat_concat_horizontal(gf2_mat_t res,
+                                 const gf2_mat_t mat1, const gf2_mat_t mat2);
+
+/* Addition */
+FLINT_DLL void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Matrix multiplication */
+FLINT_DLL void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+FLINT_DLL void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A,
+                                     const gf2_mat_t B);
+FLINT_DLL void gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A,
+                                const gf2_mat_t B);
+
+/* Gaussian elimination */
+FLINT_DLL slong gf2_mat_lu(slong * P, gf2_mat_t A, int rank_check);
+FLINT_DLL slong _gf2_mat_rref(gf2_mat_t A, slong * pivots, int reduced);
+FLINT_DLL slong gf2_mat_rref(gf2_mat_t A);
+FLINT_DLL slong gf2_mat_rank(const gf2_mat_t A);
+FLINT_DLL slong gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A);
+
+/* Solving and inverse */
+FLINT_DLL int gf2_mat_solve(gf2_mat_t X, const gf2_mat_t A,
+                            const gf2_mat_t B);
+FLINT_DLL int gf2_mat_inv(gf2_mat_t B, const gf2_mat_t A);
+
+/* Tuning parameters *********************************************************/
+
+/* Size at which the Method of Four Russians beats classical multiplication */
+#define GF2_MAT_MUL_M4RM_CUTOFF 192
+
+/* Number of rows combined by each lookup table in M4RM and M4RI */
+#define GF2_MAT_M4RM_BITS 8
+
+/* Number of rows per thread needed for M4RM to use threads */
+#define GF2_MAT_MUL_THREAD_ROWS 512
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
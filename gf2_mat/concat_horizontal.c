@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_concat_horizontal(gf2_mat_t res, const gf2_mat_t mat1,
+                                                        const gf2_mat_t mat2)
+{
+    slong i;
+
+    for (i = 0; i < mat1->r; i++)
+    {
+        flint_mpn_copyi(res->rows[i], mat1->rows[i], mat1->stride);
+        _gf2_vec_copy_bits(res->rows[i], mat1->c, mat2->rows[i], 0, mat2->c);
+    }
+}
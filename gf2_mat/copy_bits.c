@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+_gf2_vec_copy_bits(mp_ptr res, slong roff, mp_srcptr vec, slong off,
+                                                                slong len)
+{
+    int s, b;
+    mp_limb_t x, mask;
+
+    while (len > 0)
+    {
+        /* as many bits as fit in the current limb of res */
+        s = roff % FLINT_BITS;
+        b = FLINT_MIN(FLINT_BITS - s, len);
+
+        x = _gf2_vec_get_bits(vec, off, b);
+        mask = (b == FLINT_BITS) ? ~UWORD(0) : (UWORD(1) << b) - 1;
+
+        res[roff / FLINT_BITS] = (res[roff / FLINT_BITS] & ~(mask << s))
+                                                                | (x << s);
+        roff += b;
+        off += b;
+        len -= b;
+    }
+}
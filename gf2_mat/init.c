@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_init(gf2_mat_t mat, slong rows, slong cols)
+{
+    slong i, stride = GF2_MAT_ROW_LIMBS(cols);
+
+    mat->entries = NULL;
+    mat->rows = NULL;
+
+    if (rows != 0)
+    {
+        if (stride != 0)
+            mat->entries = flint_calloc(rows * stride, sizeof(mp_limb_t));
+
+        mat->rows = flint_malloc(rows * sizeof(mp_limb_t *));
+
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = mat->entries + i * stride;
+    }
+
+    mat->r = rows;
+    mat->c = cols;
+    mat->stride = stride;
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+int
+gf2_mat_inv(gf2_mat_t B, const gf2_mat_t A)
+{
+    gf2_mat_t I;
+    int result;
+
+    gf2_mat_init(I, A->r, A->r);
+    gf2_mat_one(I);
+    result = gf2_mat_solve(B, A, I);
+    gf2_mat_clear(I);
+
+    return result;
+}
@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    The same elimination as nmod_mat_lu_classical, with rows added a limb
+    at a time. The multipliers, which are all 1, are stored in column
+    rank - 1 as there.
+*/
+slong
+gf2_mat_lu(slong * P, gf2_mat_t A, int rank_check)
+{
+    slong i, j, m, n, w, t, rank, row, col;
+    mp_limb_t bit, high;
+    mp_ptr a, p;
+
+    m = A->r;
+    n = A->c;
+
+    rank = row = col = 0;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    while (row < m && col < n)
+    {
+        w = col / FLINT_BITS;
+        bit = UWORD(1) << (col % FLINT_BITS);
+
+        for (i = row; i < m && !(A->rows[i][w] & bit); i++) ;
+
+        if (i == m)
+        {
+            if (rank_check)
+                return 0;
+            col++;
+            continue;
+        }
+
+        if (i != row)
+        {
+            p = A->rows[i];
+            A->rows[i] = A->rows[row];
+            A->rows[row] = p;
+
+            t = P[i];
+            P[i] = P[row];
+            P[row] = t;
+        }
+
+        rank++;
+
+        /* the columns after col in limb w */
+        high = ~((bit << 1) - 1);
+        p = A->rows[row];
+
+        for (i = row + 1; i < m; i++)
+        {
+            a = A->rows[i];
+
+            if (a[w] & bit)
+            {
+                a[w] ^= (p[w] & high) | bit;
+                for (j = w + 1; j < A->stride; j++)
+                    a[j] ^= p[j];
+
+                a[(rank - 1) / FLINT_BITS] |=
+                                    UWORD(1) << ((rank - 1) % FLINT_BITS);
+            }
+        }
+
+        row++;
+        col++;
+    }
+
+    return rank;
+}
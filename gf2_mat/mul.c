@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    if (C->r != A->r || C->c != B->c || A->c != B->r)
+    {
+        flint_printf("Exception (gf2_mat_mul). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (A->r < GF2_MAT_MUL_M4RM_CUTOFF || A->c < GF2_MAT_MUL_M4RM_CUTOFF)
+        gf2_mat_mul_classical(C, A, B);
+    else
+        gf2_mat_mul_m4rm(C, A, B);
+}
@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, k, l, stride;
+    mp_limb_t x;
+    mp_ptr c;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_classical(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+
+        return;
+    }
+
+    stride = B->stride;
+
+    /* row i of C is the sum of the rows of B selected by row i of A */
+    for (i = 0; i < A->r; i++)
+    {
+        c = C->rows[i];
+        flint_mpn_zero(c, stride);
+
+        for (j = 0; j < A->stride; j++)
+        {
+            x = A->rows[i][j];
+
+            for (k = j * FLINT_BITS; x != 0; k++, x >>= 1)
+                if (x & 1)
+                    for (l = 0; l < stride; l++)
+                        c[l] ^= B->rows[k][l];
+        }
+    }
+}
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "gf2_mat.h"
+
+typedef struct
+{
+    gf2_mat_struct * C;
+    const gf2_mat_struct * A;
+    const gf2_mat_struct * B;
+    slong r0;
+    slong r1;
+}
+mul_m4rm_arg_t;
+
+/*
+    Method of Four Russians: for each group of k rows of B, all their 2^k
+    sums are tabulated, each built from a previous one by adding a single
+    row. Then every row of C needs a single table lookup per group instead
+    of a row addition per bit of A.
+*/
+static void
+_gf2_mat_mul_m4rm_rows(mul_m4rm_arg_t * arg)
+{
+    const gf2_mat_struct * A = arg->A, * B = arg->B;
+    slong i, j, l, b, t, stride;
+    int k, kb;
+    mp_limb_t x;
+    mp_ptr table, c, s;
+
+    /* a table should not be much larger than the number of rows */
+    for (k = GF2_MAT_M4RM_BITS; k > 1 && (WORD(1) << k) > arg->r1 - arg->r0;
+                                                                        k--) ;
+
+    stride = B->stride;
+    table = flint_malloc((WORD(1) << k) * stride * sizeof(mp_limb_t));
+
+    for (i = arg->r0; i < arg->r1; i++)
+        flint_mpn_zero(arg->C->rows[i], stride);
+
+    flint_mpn_zero(table, stride);
+
+    for (b = 0; b < A->c; b += k)
+    {
+        kb = FLINT_MIN(k, A->c - b);
+
+        /* table[j] = sum of the rows b + t of B with bit t of j set */
+        for (j = 1; j < (WORD(1) << kb); j++)
+        {
+            count_trailing_zeros(t, (mp_limb_t) j);
+            s = table + (j & (j - 1)) * stride;
+            c = table + j * stride;
+
+            for (l = 0; l < stride; l++)
+                c[l] = s[l] ^ B->rows[b + t][l];
+        }
+
+        for (i = arg->r0; i < arg->r1; i++)
+        {
+            x = _gf2_vec_get_bits(A->rows[i], b, kb);
+
+            if (x != 0)
+            {
+                c = arg->C->rows[i];
+                s = table + x * stride;
+
+                for (l = 0; l < stride; l++)
+                    c[l] ^= s[l];
+            }
+        }
+    }
+
+    flint_free(table);
+}
+
+static void *
+_gf2_mat_mul_m4rm_worker(void * arg_ptr)
+{
+    _gf2_mat_mul_m4rm_rows((mul_m4rm_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, m, num_threads;
+    mul_m4rm_arg_t * args;
+    pthread_t * threads;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_m4rm(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+
+        return;
+    }
+
+    m = A->r;
+
+    if (m == 0 || B->stride == 0)
+        return;
+
+    /* every thread builds its own tables, so it needs enough rows
+       to make up for that */
+    num_threads = FLINT_MIN(flint_get_num_threads(),
+                            m / GF2_MAT_MUL_THREAD_ROWS);
+
+    if (num_threads <= 1)
+    {
+        mul_m4rm_arg_t arg;
+
+        arg.C = C;
+        arg.A = A;
+        arg.B = B;
+        arg.r0 = 0;
+        arg.r1 = m;
+
+        _gf2_mat_mul_m4rm_rows(&arg);
+
+        return;
+    }
+
+    args = flint_malloc(sizeof(mul_m4rm_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+        args[i].r0 = (m * i) / num_threads;
+        args[i].r1 = (m * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _gf2_mat_mul_m4rm_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+}
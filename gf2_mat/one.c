@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_one(gf2_mat_t mat)
+{
+    slong i;
+
+    gf2_mat_zero(mat);
+
+    for (i = 0; i < FLINT_MIN(mat->r, mat->c); i++)
+        gf2_mat_set_entry(mat, i, i, 1);
+}
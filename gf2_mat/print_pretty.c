@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "gf2_mat.h"
+
+void
+gf2_mat_print_pretty(const gf2_mat_t mat)
+{
+    slong i, j;
+
+    flint_printf("<%wd x %wd matrix over GF(2)>\n", mat->r, mat->c);
+
+    if (!(mat->c) || !(mat->r))
+        return;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        flint_printf("[");
+
+        for (j = 0; j < mat->c; j++)
+        {
+            flint_printf("%d", gf2_mat_get_entry(mat, i, j));
+            if (j + 1 < mat->c)
+                flint_printf(" ");
+        }
+
+        flint_printf("]\n");
+    }
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    slong dim;
+    int algorithm;
+} mat_mul_t;
+
+void sample(void * arg, ulong count)
+{
+    mat_mul_t * params = (mat_mul_t *) arg;
+    slong dim = params->dim;
+    int algorithm = params->algorithm;
+    ulong i;
+    gf2_mat_t A, B, C;
+    nmod_mat_t AA, BB, CC;
+    FLINT_TEST_INIT(state);
+
+    gf2_mat_init(A, dim, dim);
+    gf2_mat_init(B, dim, dim);
+    gf2_mat_init(C, dim, dim);
+    nmod_mat_init(AA, dim, dim, 2);
+    nmod_mat_init(BB, dim, dim, 2);
+    nmod_mat_init(CC, dim, dim, 2);
+
+    gf2_mat_randtest(A, state);
+    gf2_mat_randtest(B, state);
+    gf2_mat_get_nmod_mat(AA, A);
+    gf2_mat_get_nmod_mat(BB, B);
+
+    prof_start();
+
+    if (algorithm == 0)
+        for (i = 0; i < count; i++)
+            nmod_mat_mul_classical(CC, AA, BB);
+    else if (algorithm == 1)
+        for (i = 0; i < count; i++)
+            gf2_mat_mul_classical(C, A, B);
+    else if (algorithm == 2)
+        for (i = 0; i < count; i++)
+            gf2_mat_mul_m4rm(C, A, B);
+
+    prof_stop();
+
+    gf2_mat_clear(A);
+    gf2_mat_clear(B);
+    gf2_mat_clear(C);
+    nmod_mat_clear(AA);
+    nmod_mat_clear(BB);
+    nmod_mat_clear(CC);
+
+    FLINT_TEST_CLEANUP(state);
+}
+
+int main(void)
+{
+    double min_nmod, min_classical, min_m4rm, max;
+    mat_mul_t params;
+    slong dim;
+
+    flint_printf("gf2_mat_mul:\n");
+
+    for (dim = 2; dim <= 2048; dim = (slong) ((double) dim * 1.3) + 1)
+    {
+        params.dim = dim;
+
+        min_nmod = 0.0;
+        if (dim <= 512)
+        {
+            params.algorithm = 0;
+            prof_repeat(&min_nmod, &max, sample, &params);
+        }
+
+        params.algorithm = 1;
+        prof_repeat(&min_classical, &max, sample, &params);
+
+        params.algorithm = 2;
+        prof_repeat(&min_m4rm, &max, sample, &params);
+
+        flint_printf("dim = %wd nmod_mat/classical/m4rm "
+                     "%.2f %.2f %.2f (us)\n",
+                     dim, min_nmod, min_classical, min_m4rm);
+    }
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state)
+{
+    slong i, j;
+    int density = n_randint(state, 4);
+    mp_limb_t x;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < mat->stride; j++)
+        {
+            /* vary the density of ones between the matrices */
+            x = n_randlimb(state);
+            if (density >= 1)
+                x &= n_randlimb(state);
+            if (density >= 2)
+                x &= n_randlimb(state) & n_randlimb(state);
+            if (density == 3)
+                x = ~x;
+
+            mat->rows[i][j] = x;
+        }
+
+        if (mat->c % FLINT_BITS != 0)
+            mat->rows[i][mat->stride - 1] &=
+                (UWORD(1) << (mat->c % FLINT_BITS)) - 1;
+    }
+}
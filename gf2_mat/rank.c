@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+slong
+gf2_mat_rank(const gf2_mat_t A)
+{
+    slong rank;
+    gf2_mat_t tmp;
+
+    gf2_mat_init_set(tmp, A);
+    rank = _gf2_mat_rref(tmp, NULL, 0);
+    gf2_mat_clear(tmp);
+
+    return rank;
+}
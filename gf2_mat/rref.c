@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    Method of Four Russians inversion. The columns are processed in groups
+    of up to GF2_MAT_M4RM_BITS. Pivots for a group are found by classical
+    elimination, in which a candidate row is only reduced on the bits of
+    the group until it is chosen. The pivot rows of the group are then
+    reduced against each other, all sums of them are tabulated, and every
+    other row is cleared on the pivot columns by a single table lookup.
+    Rows above the pivots are only reduced if reduced is nonzero.
+*/
+slong
+_gf2_mat_rref(gf2_mat_t A, slong * pivots, int reduced)
+{
+    slong i, j, l, m, n, r, c, t, w, len, np;
+    int k, kk;
+    slong piv[GF2_MAT_M4RM_BITS];
+    mp_limb_t pivbits[GF2_MAT_M4RM_BITS];
+    unsigned int index[WORD(1) << GF2_MAT_M4RM_BITS];
+    mp_limb_t v, x;
+    mp_ptr table, p, q;
+    mp_limb_t ** rows = A->rows;
+
+    m = A->r;
+    n = A->c;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    /* a table should not be much larger than the number of rows */
+    for (k = GF2_MAT_M4RM_BITS; k > 1 && (WORD(1) << k) > m; k--) ;
+
+    table = flint_malloc((WORD(1) << k) * A->stride * sizeof(mp_limb_t));
+
+    r = c = 0;
+
+    while (r < m && c < n)
+    {
+        kk = FLINT_MIN(k, n - c);
+        w = c / FLINT_BITS;
+        len = A->stride - w;
+        np = 0;
+
+        /* find the pivots in columns c, ..., c + kk - 1; all rows from r
+           on are zero before column c */
+        for (j = 0; j < kk && r + np < m; j++)
+        {
+            for (i = r + np; i < m; i++)
+            {
+                v = _gf2_vec_get_bits(rows[i], c, kk);
+
+                for (t = 0; t < np; t++)
+                    if (v & (UWORD(1) << piv[t]))
+                        v ^= pivbits[t];
+
+                if (v & (UWORD(1) << j))
+                    break;
+            }
+
+            if (i == m)
+                continue;
+
+            p = rows[i];
+            rows[i] = rows[r + np];
+            rows[r + np] = p;
+
+            /* reduce the new pivot row by the previous ones... */
+            v = _gf2_vec_get_bits(p, c, kk);
+
+            for (t = 0; t < np; t++)
+            {
+                if (v & (UWORD(1) << piv[t]))
+                {
+                    q = rows[r + t] + w;
+                    for (l = 0; l < len; l++)
+                        p[w + l] ^= q[l];
+                }
+            }
+
+            /* ...and the previous ones by it */
+            for (t = 0; t < np; t++)
+            {
+                q = rows[r + t] + w;
+
+                if (pivbits[t] & (UWORD(1) << j))
+                {
+                    for (l = 0; l < len; l++)
+                        q[l] ^= p[w + l];
+
+                    pivbits[t] = _gf2_vec_get_bits(rows[r + t], c, kk);
+                }
+            }
+
+            piv[np] = j;
+            pivbits[np] = _gf2_vec_get_bits(p, c, kk);
+            np++;
+        }
+
+        if (np == 0)
+        {
+            c += kk;
+            continue;
+        }
+
+        /* table of the sums of the pivot rows, from limb w on */
+        flint_mpn_zero(table, len);
+
+        for (j = 1; j < (WORD(1) << np); j++)
+        {
+            count_trailing_zeros(t, (mp_limb_t) j);
+            p = table + j * len;
+            q = table + (j & (j - 1)) * len;
+
+            for (l = 0; l < len; l++)
+                p[l] = q[l] ^ rows[r + t][w + l];
+        }
+
+        /* which pivot rows to add for given bits in the group */
+        for (x = 0; x < (UWORD(1) << kk); x++)
+        {
+            index[x] = 0;
+            for (t = 0; t < np; t++)
+                if (x & (UWORD(1) << piv[t]))
+                    index[x] |= (1U << t);
+        }
+
+        for (i = reduced ? 0 : r + np; i < m; i++)
+        {
+            if (i >= r && i < r + np)
+                continue;
+
+            x = index[_gf2_vec_get_bits(rows[i], c, kk)];
+
+            if (x != 0)
+            {
+                p = rows[i] + w;
+                q = table + x * len;
+
+                for (l = 0; l < len; l++)
+                    p[l] ^= q[l];
+            }
+        }
+
+        if (pivots != NULL)
+            for (t = 0; t < np; t++)
+                pivots[r + t] = c + piv[t];
+
+        r += np;
+        c += kk;
+    }
+
+    flint_free(table);
+
+    return r;
+}
+
+slong
+gf2_mat_rref(gf2_mat_t A)
+{
+    return _gf2_mat_rref(A, NULL, 1);
+}
@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A)
+{
+    slong i, j, k;
+    mp_limb_t x;
+    mp_srcptr a;
+
+    if (A->c == 0)
+        return;
+
+    for (i = 0; i < A->r; i++)
+    {
+        a = A->rows[i];
+
+        for (j = 0; j < B->stride; j++)
+        {
+            x = 0;
+
+            for (k = FLINT_MIN(FLINT_BITS, A->c - j * FLINT_BITS) - 1;
+                                                                k >= 0; k--)
+                x = (x << 1) | (a[j * FLINT_BITS + k] & 1);
+
+            B->rows[i][j] = x;
+        }
+    }
+}
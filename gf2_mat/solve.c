@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+int
+gf2_mat_solve(gf2_mat_t X, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, n, rank;
+    slong * pivots;
+    gf2_mat_t M;
+    int result;
+
+    n = A->r;
+
+    if (n == 0)
+        return 1;
+
+    /* reduce [A | B] to [I | X] */
+    gf2_mat_init(M, n, n + B->c);
+    gf2_mat_concat_horizontal(M, A, B);
+
+    pivots = flint_malloc(sizeof(slong) * n);
+    rank = _gf2_mat_rref(M, pivots, 1);
+
+    result = (rank == n && pivots[n - 1] == n - 1);
+
+    if (result)
+    {
+        for (i = 0; i < n; i++)
+        {
+            flint_mpn_zero(X->rows[i], X->stride);
+            _gf2_vec_copy_bits(X->rows[i], 0, M->rows[i], n, B->c);
+        }
+    }
+
+    gf2_mat_clear(M);
+    flint_free(pivots);
+
+    return result;
+}
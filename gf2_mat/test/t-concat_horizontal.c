@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("concat_horizontal....");
+    fflush(stdout);
+
+    /* Compare with nmod_mat_concat_horizontal */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t M, N, P, Q;
+        slong m, n1, n2;
+
+        m = n_randint(state, 100);
+        n1 = n_randint(state, 200);
+        n2 = n_randint(state, 200);
+
+        gf2_mat_init(A, m, n1);
+        gf2_mat_init(B, m, n2);
+        gf2_mat_init(C, m, n1 + n2);
+        nmod_mat_init(M, m, n1, 2);
+        nmod_mat_init(N, m, n2, 2);
+        nmod_mat_init(P, m, n1 + n2, 2);
+        nmod_mat_init(Q, m, n1 + n2, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+        gf2_mat_get_nmod_mat(M, A);
+        gf2_mat_get_nmod_mat(N, B);
+        nmod_mat_concat_horizontal(P, M, N);
+
+        gf2_mat_concat_horizontal(C, A, B);
+        gf2_mat_get_nmod_mat(Q, C);
+
+        if (!nmod_mat_equal(P, Q))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(P);
+            nmod_mat_print_pretty(Q);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(P);
+        nmod_mat_clear(Q);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("inv....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, I, AB;
+        nmod_mat_t M;
+        slong n, r;
+        int result;
+
+        n = n_randint(state, 150);
+        r = n_randint(state, 4) ? n : n_randint(state, n + 1);
+
+        gf2_mat_init(A, n, n);
+        gf2_mat_init(B, n, n);
+        gf2_mat_init(I, n, n);
+        gf2_mat_init(AB, n, n);
+        nmod_mat_init(M, n, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        nmod_mat_randops(M, n_randint(state, 1 + n * n), state);
+        gf2_mat_set_nmod_mat(A, M);
+        gf2_mat_one(I);
+
+        result = gf2_mat_inv(B, A);
+
+        if (result != (r == n))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, r = %wd, result = %d\n", n, r, result);
+            abort();
+        }
+
+        if (result)
+        {
+            gf2_mat_mul(AB, A, B);
+
+            /* aliasing */
+            gf2_mat_inv(A, A);
+
+            if (!gf2_mat_equal(AB, I) || !gf2_mat_equal(A, B))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("A A^-1 != I\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(I);
+        gf2_mat_clear(AB);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
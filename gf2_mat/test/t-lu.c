@@ -0,0 +1,96 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lu....");
+    fflush(stdout);
+
+    /* Compare with nmod_mat_lu_classical, which does the same pivoting */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A;
+        nmod_mat_t M, N;
+        slong j, m, n, r1, r2, * P1, * P2;
+        int rank_check;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+        rank_check = n_randint(state, 2);
+
+        gf2_mat_init(A, m, n);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(N, m, n, 2);
+        P1 = flint_malloc(sizeof(slong) * (m + 1));
+        P2 = flint_malloc(sizeof(slong) * (m + 1));
+
+        nmod_mat_randrank(M, state, n_randint(state, FLINT_MIN(m, n) + 1));
+        if (n_randint(state, 2))
+            nmod_mat_randops(M, n_randint(state, 1 + m * n), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        r1 = gf2_mat_lu(P1, A, rank_check);
+        r2 = nmod_mat_lu_classical(P2, M, rank_check);
+
+        gf2_mat_get_nmod_mat(N, A);
+
+        if (r1 != r2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r1 = %wd, r2 = %wd\n", r1, r2);
+            abort();
+        }
+
+        if (!rank_check || r1 != 0)
+        {
+            for (j = 0; j < m; j++)
+            {
+                if (P1[j] != P2[j])
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("wrong permutation\n");
+                    abort();
+                }
+            }
+
+            if (!nmod_mat_equal(M, N))
+            {
+                flint_printf("FAIL:\n");
+                nmod_mat_print_pretty(M);
+                nmod_mat_print_pretty(N);
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        flint_free(P1);
+        flint_free(P2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
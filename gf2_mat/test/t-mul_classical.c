@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_classical....");
+    fflush(stdout);
+
+    /* Compare with nmod_mat_mul_classical */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t M, N, P, Q;
+        slong m, k, n;
+
+        m = n_randint(state, 150);
+        k = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        nmod_mat_init(M, m, k, 2);
+        nmod_mat_init(N, k, n, 2);
+        nmod_mat_init(P, m, n, 2);
+        nmod_mat_init(Q, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+        gf2_mat_get_nmod_mat(M, A);
+        gf2_mat_get_nmod_mat(N, B);
+        nmod_mat_mul_classical(P, M, N);
+
+        gf2_mat_mul_classical(C, A, B);
+        gf2_mat_get_nmod_mat(Q, C);
+
+        if (!nmod_mat_equal(P, Q))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            abort();
+        }
+
+        /* aliasing */
+        if (k == n)
+        {
+            gf2_mat_mul_classical(A, A, B);
+
+            if (!gf2_mat_equal(A, C))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("aliasing\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(P);
+        nmod_mat_clear(Q);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
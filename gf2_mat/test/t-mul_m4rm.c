@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_m4rm....");
+    fflush(stdout);
+
+    /* Compare with classical multiplication */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C, D;
+        slong m, k, n;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        m = n_randint(state, 200);
+        k = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        if (n_randint(state, 10) == 0)
+            m += n_randint(state, 2000);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        gf2_mat_init(D, m, n);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+
+        gf2_mat_mul_m4rm(C, A, B);
+        gf2_mat_mul_classical(D, A, B);
+
+        if (!gf2_mat_equal(C, D))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            abort();
+        }
+
+        /* aliasing */
+        if (k == n)
+        {
+            gf2_mat_mul_m4rm(A, A, B);
+
+            if (!gf2_mat_equal(A, D))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("aliasing\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        gf2_mat_clear(D);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, X, AX;
+        nmod_mat_t M;
+        slong m, n, r, nullity;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(X, n, n);
+        gf2_mat_init(AX, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        nmod_mat_randops(M, n_randint(state, 1 + m * n), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        gf2_mat_randtest(X, state);
+        nullity = gf2_mat_nullspace(X, A);
+
+        if (nullity + r != n || gf2_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong nullity\n");
+            abort();
+        }
+
+        gf2_mat_mul(AX, A, X);
+
+        if (!gf2_mat_is_zero(AX))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("not in the nullspace\n");
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(X);
+        gf2_mat_clear(AX);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank....");
+    fflush(stdout);
+
+    /* Check rank of a matrix with given rank */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A;
+        nmod_mat_t M;
+        slong m, n, r;
+
+        m = n_randint(state, 200);
+        n = n_randint(state, 200);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        nmod_mat_randops(M, n_randint(state, 1 + m * n), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        if (gf2_mat_rank(A) != r)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r = %wd, rank = %wd\n", r, gf2_mat_rank(A));
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
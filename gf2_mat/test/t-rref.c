@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+/* checks that A is in reduced row echelon form with the given rank */
+static int
+check_rref(const gf2_mat_t A, slong rank)
+{
+    slong i, j, k, prev = -1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c && !gf2_mat_get_entry(A, i, j); j++) ;
+
+        if ((j == A->c) != (i >= rank))
+            return 0;
+
+        if (j == A->c)
+            continue;
+
+        if (j <= prev)
+            return 0;
+
+        for (k = 0; k < A->r; k++)
+            if (k != i && gf2_mat_get_entry(A, k, j))
+                return 0;
+
+        prev = j;
+    }
+
+    return 1;
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rref....");
+    fflush(stdout);
+
+    /* Check the form, and that the row space is unchanged */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M, N, MN;
+        slong j, m, n, r1, r2, r3, * pivots;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+        if (n_randint(state, 10) == 0)
+            m += n_randint(state, 500);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(N, m, n, 2);
+        nmod_mat_init(MN, 2 * m, n, 2);
+        pivots = flint_malloc(sizeof(slong) * (FLINT_MIN(m, n) + 1));
+
+        r2 = -1;
+        if (n_randint(state, 2))
+        {
+            gf2_mat_randtest(A, state);
+            gf2_mat_get_nmod_mat(M, A);
+        }
+        else
+        {
+            r2 = n_randint(state, FLINT_MIN(m, n) + 1);
+            nmod_mat_randrank(M, state, r2);
+            nmod_mat_randops(M, n_randint(state, 1 + m * n), state);
+            gf2_mat_set_nmod_mat(A, M);
+        }
+
+        gf2_mat_set(B, A);
+
+        r1 = gf2_mat_rref(A);
+        gf2_mat_get_nmod_mat(N, A);
+        nmod_mat_concat_vertical(MN, M, N);
+
+        if ((r2 != -1 && r1 != r2) || !check_rref(A, r1)
+                || nmod_mat_rank(MN) != r1)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r1 = %wd, r2 = %wd\n", r1, r2);
+            nmod_mat_print_pretty(M);
+            nmod_mat_print_pretty(N);
+            abort();
+        }
+
+        /* the unreduced form has the same rank and pivots */
+        r3 = _gf2_mat_rref(B, pivots, 0);
+
+        for (j = 0; j < r3; j++)
+        {
+            if (!gf2_mat_get_entry(A, j, pivots[j]) ||
+                !gf2_mat_get_entry(B, j, pivots[j]) ||
+                (j > 0 && pivots[j] <= pivots[j - 1]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("wrong pivots\n");
+                abort();
+            }
+        }
+
+        if (r3 != r1 || gf2_mat_rank(B) != r1)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r1 = %wd, r3 = %wd\n", r1, r3);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(MN);
+        flint_free(pivots);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    /* Round trip through nmod_mat, and entries */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M, N;
+        slong j, k, m, n;
+
+        m = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(N, m, n, 2);
+
+        nmod_mat_randtest(M, state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        for (j = 0; j < m; j++)
+        {
+            for (k = 0; k < n; k++)
+            {
+                if (gf2_mat_get_entry(A, j, k) != nmod_mat_entry(M, j, k))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("wrong entry\n");
+                    abort();
+                }
+            }
+        }
+
+        gf2_mat_get_nmod_mat(N, A);
+
+        if (!nmod_mat_equal(M, N))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(M);
+            nmod_mat_print_pretty(N);
+            abort();
+        }
+
+        /* set_entry agrees, and keeps the padding clear */
+        gf2_mat_randtest(A, state);
+        gf2_mat_get_nmod_mat(M, A);
+
+        for (j = 0; j < m; j++)
+            for (k = 0; k < n; k++)
+                gf2_mat_set_entry(B, j, k, nmod_mat_entry(M, j, k));
+
+        if (!gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(B);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    /* Compare with nmod_mat_transpose */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M, MT, N;
+        slong m, n;
+
+        m = n_randint(state, 300);
+        n = n_randint(state, 300);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, n, m);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(MT, n, m, 2);
+        nmod_mat_init(N, n, m, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_get_nmod_mat(M, A);
+        nmod_mat_transpose(MT, M);
+
+        gf2_mat_transpose(B, A);
+        gf2_mat_get_nmod_mat(N, B);
+
+        if (!nmod_mat_equal(MT, N))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(MT);
+            nmod_mat_print_pretty(N);
+            abort();
+        }
+
+        /* aliasing */
+        if (m == n)
+        {
+            gf2_mat_transpose(B, B);
+
+            if (!gf2_mat_equal(A, B))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("aliasing\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(MT);
+        nmod_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "gf2_mat.h"
+
+/*
+    Transposes the FLINT_BITS x FLINT_BITS block a in place, where entry
+    (i, j) is bit j of a[i], by swapping the off-diagonal halves of ever
+    smaller sub-blocks.
+*/
+static void
+_gf2_mat_transpose_block(mp_limb_t * a)
+{
+    int j, k;
+    mp_limb_t m, t;
+
+    m = ~UWORD(0) >> (FLINT_BITS / 2);
+
+    for (j = FLINT_BITS / 2; j != 0; j >>= 1, m ^= (m << j))
+    {
+        for (k = 0; k < FLINT_BITS; k = ((k | j) + 1) & ~j)
+        {
+            t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k] ^= (t << j);
+            a[k | j] ^= t;
+        }
+    }
+}
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    slong i, j, k, rb, cb;
+    mp_limb_t a[FLINT_BITS];
+
+    if (B->r != A->c || B->c != A->r)
+    {
+        flint_printf("Exception (gf2_mat_transpose). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (A == B)
+    {
+        gf2_mat_t T;
+
+        gf2_mat_init(T, A->c, A->r);
+        gf2_mat_transpose(T, A);
+        gf2_mat_swap(B, T);
+        gf2_mat_clear(T);
+
+        return;
+    }
+
+    /* block (i, j) of A becomes block (j, i) of B */
+    for (i = 0; i < B->stride; i++)
+    {
+        rb = FLINT_MIN(FLINT_BITS, A->r - i * FLINT_BITS);
+
+        for (j = 0; j < A->stride; j++)
+        {
+            cb = FLINT_MIN(FLINT_BITS, A->c - j * FLINT_BITS);
+
+            for (k = 0; k < rb; k++)
+                a[k] = A->rows[i * FLINT_BITS + k][j];
+            for ( ; k < FLINT_BITS; k++)
+                a[k] = 0;
+
+            _gf2_mat_transpose_block(a);
+
+            for (k = 0; k < cb; k++)
+                B->rows[j * FLINT_BITS + k][i] = a[k];
+        }
+    }
+}
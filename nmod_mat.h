@@ -286,6 +286,9 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 /* Cutoff between classical and recursive LU decomposition */
 #define NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
+/* Size from which matrices modulo 2 are handled in bit-packed form */
+#define NMOD_MAT_GF2_CUTOFF 8
+
 /*
    Suggested initial modulus size for multimodular algorithms. This should
    be chosen so that we get the most number of bits per cycle
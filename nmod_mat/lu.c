@@ -15,9 +15,36 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 
 slong 
 nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check)
 {
+    if (A->mod.n == 2 && A->r >= NMOD_MAT_GF2_CUTOFF
+                      && A->c >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t B;
+        mp_ptr * rows;
+        slong i, rank;
+
+        gf2_mat_init(B, A->r, A->c);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_lu(P, B, rank_check);
+
+        /* permute the row pointers as nmod_mat_lu_classical would,
+           which nmod_mat_lu_recursive relies on for windows */
+        rows = flint_malloc(sizeof(mp_ptr) * A->r);
+        for (i = 0; i < A->r; i++)
+            rows[i] = A->rows[P[i]];
+        for (i = 0; i < A->r; i++)
+            A->rows[i] = rows[i];
+        flint_free(rows);
+
+        gf2_mat_get_nmod_mat(A, B);
+        gf2_mat_clear(B);
+
+        return rank;
+    }
+
     return nmod_mat_lu_recursive(P, A, rank_check);
 }
@@ -14,6 +14,7 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "gf2_mat.h"
 
 void
 nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
@@ -24,7 +25,25 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
+    if (A->mod.n == 2 && m >= NMOD_MAT_GF2_CUTOFF &&
+        k >= NMOD_MAT_GF2_CUTOFF && n >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t AA, BB, CC;
+
+        gf2_mat_init(AA, m, k);
+        gf2_mat_init(BB, k, n);
+        gf2_mat_init(CC, m, n);
+
+        gf2_mat_set_nmod_mat(AA, A);
+        gf2_mat_set_nmod_mat(BB, B);
+        gf2_mat_mul(CC, AA, BB);
+        gf2_mat_get_nmod_mat(C, CC);
+
+        gf2_mat_clear(AA);
+        gf2_mat_clear(BB);
+        gf2_mat_clear(CC);
+    }
+    else if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
     {
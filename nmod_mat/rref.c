@@ -14,6 +14,7 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "perm.h"
+#include "gf2_mat.h"
 
 slong
 _nmod_mat_rref(nmod_mat_t A, slong * pivots_nonpivots, slong * P)
@@ -109,6 +110,21 @@ slong
 nmod_mat_rref(nmod_mat_t A)
 {
     slong rank, * pivots_nonpivots, * P;
+
+    if (A->mod.n == 2 && A->r >= NMOD_MAT_GF2_CUTOFF
+                      && A->c >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t B;
+
+        gf2_mat_init(B, A->r, A->c);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_rref(B);
+        gf2_mat_get_nmod_mat(A, B);
+        gf2_mat_clear(B);
+
+        return rank;
+    }
+
     pivots_nonpivots = flint_malloc(sizeof(slong) * A->c);
     P = _perm_init(nmod_mat_nrows(A));
 
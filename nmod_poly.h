@@ -46,6 +46,8 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_TREE_THREADED_CUTOFF 2048 /* Subproduct trees: serial -> threaded */
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -111,6 +113,21 @@ typedef struct
 
 typedef nmod_poly_res_struct nmod_poly_res_t[1];
 
+/*
+    A batch of num polynomials of length at most len over the same modulus,
+    stored as a structure of arrays: coefficient j of polynomial i is at
+    coeffs[j*num + i]
+*/
+typedef struct
+{
+    mp_ptr coeffs;
+    slong num;
+    slong len;
+    nmod_t mod;
+} nmod_poly_batch_struct;
+
+typedef nmod_poly_batch_struct nmod_poly_batch_t[1];
+
 typedef struct
 {
     nmod_mat_struct A;
@@ -541,9 +558,27 @@ FLINT_DLL void nmod_poly_mullow(nmod_poly_t res, const nmod_poly_t poly1,
 FLINT_DLL void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1, 
                                mp_srcptr poly2, slong len2, slong n, nmod_t mod);
 
-FLINT_DLL void nmod_poly_mulhigh(nmod_poly_t res, const nmod_poly_t poly1, 
+FLINT_DLL void nmod_poly_mulhigh(nmod_poly_t res, const nmod_poly_t poly1,
                                               const nmod_poly_t poly2, slong n);
 
+FLINT_DLL void _nmod_poly_mulmid_classical(mp_ptr res, mp_srcptr poly1,
+                          slong len1, mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid_classical(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mulmid_KS(mp_ptr out, mp_srcptr in1, slong len1,
+                                      mp_srcptr in2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid_KS(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mulmid(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
 FLINT_DLL void _nmod_poly_mulmod(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, mp_srcptr f,
                             slong lenf, nmod_t mod);
@@ -790,6 +825,10 @@ FLINT_DLL void nmod_poly_evaluate_nmod_vec_iter(mp_ptr ys,
 FLINT_DLL void _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
     slong plen, const mp_ptr * tree, slong len, nmod_t mod);
 
+FLINT_DLL void _nmod_poly_evaluate_nmod_vec_fast_scaled_precomp(mp_ptr vs,
+    mp_srcptr poly, slong plen, const mp_ptr * tree, mp_srcptr rinv,
+    slong len, nmod_t mod);
+
 FLINT_DLL void _nmod_poly_evaluate_nmod_vec_fast(mp_ptr ys, mp_srcptr coeffs, slong len,
     mp_srcptr xs, slong n, nmod_t mod);
 
@@ -827,6 +866,9 @@ FLINT_DLL void _nmod_poly_tree_free(mp_ptr * tree, slong len);
 FLINT_DLL void _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots,
     slong len, nmod_t mod);
 
+FLINT_DLL void _nmod_poly_tree_inv_root(mp_ptr rinv, const mp_ptr * tree,
+    slong len, nmod_t mod);
+
 /* Interpolation  ************************************************************/
 
 FLINT_DLL void _nmod_poly_interpolate_nmod_vec_newton(mp_ptr poly, mp_srcptr xs,
@@ -982,7 +1024,14 @@ FLINT_DLL void nmod_poly_compose_series_horner(nmod_poly_t res,
 FLINT_DLL void _nmod_poly_compose_series_brent_kung(mp_ptr res, mp_srcptr poly1, slong len1, 
                             mp_srcptr poly2, slong len2, slong n, nmod_t mod);
 
-FLINT_DLL void nmod_poly_compose_series_brent_kung(nmod_poly_t res, 
+FLINT_DLL void nmod_poly_compose_series_brent_kung(nmod_poly_t res,
+                    const nmod_poly_t poly1, const nmod_poly_t poly2, slong n);
+
+FLINT_DLL void _nmod_poly_compose_series_kinoshita_li(mp_ptr res,
+                            mp_srcptr poly1, slong len1, mp_srcptr poly2,
+                                          slong len2, slong n, nmod_t mod);
+
+FLINT_DLL void nmod_poly_compose_series_kinoshita_li(nmod_poly_t res,
                     const nmod_poly_t poly1, const nmod_poly_t poly2, slong n);
 
 FLINT_DLL void _nmod_poly_compose_series(mp_ptr res, mp_srcptr poly1, slong len1, 
@@ -1229,6 +1278,54 @@ FLINT_DLL void nmod_poly_deflate(nmod_poly_t result, const nmod_poly_t input,
 FLINT_DLL void nmod_poly_inflate(nmod_poly_t result, const nmod_poly_t input,
     ulong inflation);
 
+/* Batches of polynomials ****************************************************/
+
+FLINT_DLL void nmod_poly_batch_init(nmod_poly_batch_t B,
+                                    slong num, slong len, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_batch_clear(nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_zero(nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_randtest(nmod_poly_batch_t B,
+                                        flint_rand_t state);
+
+FLINT_DLL void nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t B, slong i,
+                                             const nmod_poly_t poly);
+
+FLINT_DLL void nmod_poly_batch_get_nmod_poly(nmod_poly_t poly,
+                                     const nmod_poly_batch_t B, slong i);
+
+FLINT_DLL void _nmod_poly_batch_convolve(mp_ptr res, mp_srcptr poly1,
+                mp_srcptr poly2, slong m, slong j0, slong j1, slong num,
+                                      mp_ptr tmp, int nlimbs, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_batch_mullow(mp_ptr res, mp_srcptr poly1,
+       slong len1, mp_srcptr poly2, slong len2, slong n, slong num, nmod_t mod);
+
+FLINT_DLL void nmod_poly_batch_mul(nmod_poly_batch_t C,
+                  const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void _nmod_poly_batch_rem(mp_ptr R, mp_srcptr A, slong lenA,
+                         mp_srcptr B, slong lenB, mp_srcptr Binv,
+                                                 slong num, nmod_t mod);
+
+FLINT_DLL void nmod_poly_batch_rem(nmod_poly_batch_t R,
+                  const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_mulmod(nmod_poly_batch_t R,
+                  const nmod_poly_batch_t A, const nmod_poly_batch_t B,
+                                          const nmod_poly_batch_t F);
+
+FLINT_DLL void _nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys, mp_srcptr poly,
+                          slong len, mp_srcptr xs, slong num, nmod_t mod);
+
+FLINT_DLL void nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys,
+                              const nmod_poly_batch_t A, mp_srcptr xs);
+
+FLINT_DLL void nmod_poly_batch_gcd(nmod_poly_batch_t G,
+                  const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
 /* Characteristic polynomial and minimal polynomial */
 
 FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+void
+_nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys, mp_srcptr poly, slong len,
+                                   mp_srcptr xs, slong num, nmod_t mod)
+{
+    mp_srcptr a;
+    slong i, j;
+
+    if (len == 0)
+    {
+        _nmod_vec_zero(ys, num);
+        return;
+    }
+
+    /* Horner's rule, for all the polynomials at once */
+    _nmod_vec_set(ys, poly + (len - 1) * num, num);
+
+    for (j = len - 2; j >= 0; j--)
+    {
+        a = poly + j * num;
+
+        for (i = 0; i < num; i++)
+            ys[i] = nmod_add(n_mulmod2_preinv(ys[i], xs[i], mod.n, mod.ninv),
+                             a[i], mod);
+    }
+}
+
+void
+nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys, const nmod_poly_batch_t A,
+                                  mp_srcptr xs)
+{
+    _nmod_poly_batch_evaluate_nmod_vec(ys, A->coeffs, A->len, xs,
+                                       A->num, A->mod);
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    The remainder sequences of different polynomials in the batch have
+    different degree patterns, so the gcds are computed one at a time.
+    The scratch space is shared, so there is no allocation per gcd.
+*/
+void
+nmod_poly_batch_gcd(nmod_poly_batch_t G, const nmod_poly_batch_t A,
+                    const nmod_poly_batch_t B)
+{
+    slong num = A->num, len = FLINT_MAX(A->len, B->len);
+    slong i, j, lenA, lenB, lenG;
+    mp_ptr a, b, g;
+    mp_srcptr p, q;
+
+    if (B->num != num || G->num != num)
+    {
+        flint_printf("Exception (nmod_poly_batch_gcd). "
+                     "Incompatible batch sizes.\n");
+        flint_abort();
+    }
+
+    if (G->len < len)
+    {
+        flint_printf("Exception (nmod_poly_batch_gcd). "
+                     "Output polynomials too short.\n");
+        flint_abort();
+    }
+
+    a = _nmod_vec_init(3 * len + 1);
+    b = a + len;
+    g = b + len;
+
+    for (i = 0; i < num; i++)
+    {
+        for (j = 0; j < A->len; j++)
+            a[j] = A->coeffs[j * num + i];
+        for (j = 0; j < B->len; j++)
+            b[j] = B->coeffs[j * num + i];
+
+        lenA = A->len;
+        lenB = B->len;
+        NMOD_VEC_NORM(a, lenA);
+        NMOD_VEC_NORM(b, lenB);
+
+        p = a;
+        q = b;
+
+        if (lenA < lenB)
+        {
+            p = b;
+            q = a;
+            lenG = lenA;
+            lenA = lenB;
+            lenB = lenG;
+        }
+
+        if (lenA == 0)
+            lenG = 0;
+        else if (lenB == 0)
+        {
+            _nmod_poly_make_monic(g, p, lenA, G->mod);
+            lenG = lenA;
+        }
+        else
+        {
+            lenG = _nmod_poly_gcd(g, p, lenA, q, lenB, G->mod);
+
+            if (g[lenG - 1] != 1)
+                _nmod_poly_make_monic(g, g, lenG, G->mod);
+        }
+
+        for (j = 0; j < lenG; j++)
+            G->coeffs[j * num + i] = g[j];
+        for ( ; j < G->len; j++)
+            G->coeffs[j * num + i] = 0;
+    }
+
+    _nmod_vec_clear(a);
+}
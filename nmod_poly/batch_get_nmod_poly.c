@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_batch_get_nmod_poly(nmod_poly_t poly, const nmod_poly_batch_t B,
+                              slong i)
+{
+    slong j;
+
+    nmod_poly_fit_length(poly, B->len);
+
+    for (j = 0; j < B->len; j++)
+        poly->coeffs[j] = B->coeffs[j * B->num + i];
+
+    _nmod_poly_set_length(poly, B->len);
+    _nmod_poly_normalise(poly);
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_batch_init(nmod_poly_batch_t B, slong num, slong len, mp_limb_t n)
+{
+    B->coeffs = (num * len > 0) ? _nmod_vec_init(num * len) : NULL;
+    _nmod_vec_zero(B->coeffs, num * len);
+    B->num = num;
+    B->len = len;
+    nmod_init(&B->mod, n);
+}
+
+void
+nmod_poly_batch_clear(nmod_poly_batch_t B)
+{
+    if (B->coeffs != NULL)
+        _nmod_vec_clear(B->coeffs);
+}
+
+void
+nmod_poly_batch_zero(nmod_poly_batch_t B)
+{
+    _nmod_vec_zero(B->coeffs, B->num * B->len);
+}
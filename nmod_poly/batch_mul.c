@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    The innermost loops run over the polynomials in the batch, so that they
+    are free of dependencies and the compiler can vectorise them. Products
+    are accumulated without reduction, in nlimbs limbs, and reduced once.
+*/
+void
+_nmod_poly_batch_convolve(mp_ptr res, mp_srcptr poly1, mp_srcptr poly2,
+                          slong m, slong j0, slong j1, slong num,
+                          mp_ptr tmp, int nlimbs, nmod_t mod)
+{
+    mp_ptr s0 = tmp, s1 = tmp + num, s2 = tmp + 2 * num;
+    mp_srcptr a, b;
+    mp_limb_t t0, t1, u0, u1, u2;
+    slong i, j;
+
+    if (j0 > j1)
+    {
+        _nmod_vec_zero(res, num);
+        return;
+    }
+
+    if (nlimbs <= 1)
+    {
+        _nmod_vec_zero(s0, num);
+
+        for (j = j0; j <= j1; j++)
+        {
+            a = poly1 + j * num;
+            b = poly2 + (m - j) * num;
+
+            for (i = 0; i < num; i++)
+                s0[i] += a[i] * b[i];
+        }
+
+        for (i = 0; i < num; i++)
+            NMOD_RED(res[i], s0[i], mod);
+    }
+    else if (nlimbs == 2)
+    {
+        _nmod_vec_zero(s0, 2 * num);
+
+        for (j = j0; j <= j1; j++)
+        {
+            a = poly1 + j * num;
+            b = poly2 + (m - j) * num;
+
+            for (i = 0; i < num; i++)
+            {
+                umul_ppmm(t1, t0, a[i], b[i]);
+                u1 = s1[i];
+                u0 = s0[i];
+                add_ssaaaa(u1, u0, u1, u0, t1, t0);
+                s1[i] = u1;
+                s0[i] = u0;
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            NMOD2_RED2(res[i], s1[i], s0[i], mod);
+    }
+    else
+    {
+        _nmod_vec_zero(s0, 3 * num);
+
+        for (j = j0; j <= j1; j++)
+        {
+            a = poly1 + j * num;
+            b = poly2 + (m - j) * num;
+
+            for (i = 0; i < num; i++)
+            {
+                umul_ppmm(t1, t0, a[i], b[i]);
+                u2 = s2[i];
+                u1 = s1[i];
+                u0 = s0[i];
+                add_sssaaaaaa(u2, u1, u0, u2, u1, u0, 0, t1, t0);
+                s2[i] = u2;
+                s1[i] = u1;
+                s0[i] = u0;
+            }
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            NMOD_RED(u2, s2[i], mod);
+            NMOD_RED3(res[i], u2, s1[i], s0[i], mod);
+        }
+    }
+}
+
+void
+_nmod_poly_batch_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
+        mp_srcptr poly2, slong len2, slong n, slong num, nmod_t mod)
+{
+    mp_ptr tmp;
+    slong m;
+    int nlimbs;
+
+    nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MIN(len1, len2), mod);
+    tmp = _nmod_vec_init(3 * num);
+
+    for (m = 0; m < n; m++)
+        _nmod_poly_batch_convolve(res + m * num, poly1, poly2, m,
+                  FLINT_MAX(0, m - len2 + 1), FLINT_MIN(m, len1 - 1),
+                  num, tmp, nlimbs, mod);
+
+    _nmod_vec_clear(tmp);
+}
+
+void
+nmod_poly_batch_mul(nmod_poly_batch_t C, const nmod_poly_batch_t A,
+                    const nmod_poly_batch_t B)
+{
+    slong n, num = A->num;
+
+    if (B->num != num || C->num != num)
+    {
+        flint_printf("Exception (nmod_poly_batch_mul). "
+                     "Incompatible batch sizes.\n");
+        flint_abort();
+    }
+
+    if (A->len == 0 || B->len == 0)
+    {
+        nmod_poly_batch_zero(C);
+        return;
+    }
+
+    n = FLINT_MIN(C->len, A->len + B->len - 1);
+
+    if (C == A || C == B)
+    {
+        mp_ptr t = _nmod_vec_init(num * n);
+
+        _nmod_poly_batch_mullow(t, A->coeffs, A->len, B->coeffs, B->len,
+                                n, num, C->mod);
+        _nmod_vec_set(C->coeffs, t, num * n);
+
+        _nmod_vec_clear(t);
+    }
+    else
+    {
+        _nmod_poly_batch_mullow(C->coeffs, A->coeffs, A->len,
+                                B->coeffs, B->len, n, num, C->mod);
+    }
+
+    _nmod_vec_zero(C->coeffs + num * n, num * (C->len - n));
+}
@@ -0,0 +1,199 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+/*
+    The quotients are found from the top, each coefficient of their
+    reversals being a convolution with the reversed divisors, and the
+    remainders are A - Q B in the low lenB - 1 coefficients.
+*/
+void
+_nmod_poly_batch_rem(mp_ptr R, mp_srcptr A, slong lenA, mp_srcptr B,
+                     slong lenB, mp_srcptr Binv, slong num, nmod_t mod)
+{
+    mp_ptr rB, rQ, Q, T, tmp;
+    slong i, j, k, lenQ;
+    int nlimbs;
+
+    lenQ = lenA - lenB + 1;
+
+    if (lenQ <= 0)
+    {
+        _nmod_vec_set(R, A, num * lenA);
+        return;
+    }
+
+    if (lenB == 1)
+        return;
+
+    rB = _nmod_vec_init(num * (lenB + 2 * lenQ + lenB - 1 + 3));
+    rQ = rB + num * lenB;
+    Q = rQ + num * lenQ;
+    T = Q + num * lenQ;
+    tmp = T + num * (lenB - 1);
+
+    for (j = 0; j < lenB; j++)
+        _nmod_vec_set(rB + j * num, B + (lenB - 1 - j) * num, num);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MIN(lenQ, lenB), mod);
+
+    for (k = 0; k < lenQ; k++)
+    {
+        mp_ptr q = rQ + k * num;
+        mp_srcptr a = A + (lenA - 1 - k) * num;
+
+        _nmod_poly_batch_convolve(q, rB, rQ, k, 1,
+                        FLINT_MIN(k, lenB - 1), num, tmp, nlimbs, mod);
+
+        for (i = 0; i < num; i++)
+            q[i] = n_mulmod2_preinv(nmod_sub(a[i], q[i], mod), Binv[i],
+                                    mod.n, mod.ninv);
+    }
+
+    for (j = 0; j < lenQ; j++)
+        _nmod_vec_set(Q + j * num, rQ + (lenQ - 1 - j) * num, num);
+
+    _nmod_poly_batch_mullow(T, Q, lenQ, B, lenB - 1, lenB - 1, num, mod);
+    _nmod_vec_sub(R, A, T, num * (lenB - 1), mod);
+
+    _nmod_vec_clear(rB);
+}
+
+/*
+    Inverses of the leading coefficients, which must all be units, with a
+    single modular inversion of their product
+*/
+static mp_ptr
+_nmod_poly_batch_lead_inv(const nmod_poly_batch_t B, const char * fn)
+{
+    mp_srcptr lead = B->coeffs + (B->len - 1) * B->num;
+    mp_ptr Binv, t;
+    mp_limb_t g, u;
+    slong i, num = B->num;
+    nmod_t mod = B->mod;
+
+    Binv = _nmod_vec_init(num);
+
+    if (num == 0)
+        return Binv;
+
+    /* prefix products */
+    t = _nmod_vec_init(num);
+    t[0] = lead[0];
+    for (i = 1; i < num; i++)
+        t[i] = n_mulmod2_preinv(t[i - 1], lead[i], mod.n, mod.ninv);
+
+    g = n_gcdinv(&u, t[num - 1], mod.n);
+
+    if (g != 1)
+    {
+        flint_printf("Exception (%s). Leading coefficient "
+                     "not invertible.\n", fn);
+        flint_abort();
+    }
+
+    for (i = num - 1; i > 0; i--)
+    {
+        Binv[i] = n_mulmod2_preinv(u, t[i - 1], mod.n, mod.ninv);
+        u = n_mulmod2_preinv(u, lead[i], mod.n, mod.ninv);
+    }
+    Binv[0] = u;
+
+    _nmod_vec_clear(t);
+
+    return Binv;
+}
+
+void
+nmod_poly_batch_rem(nmod_poly_batch_t R, const nmod_poly_batch_t A,
+                    const nmod_poly_batch_t B)
+{
+    slong num = A->num, lenr;
+    mp_ptr Binv, t;
+
+    if (B->num != num || R->num != num)
+    {
+        flint_printf("Exception (nmod_poly_batch_rem). "
+                     "Incompatible batch sizes.\n");
+        flint_abort();
+    }
+
+    if (B->len == 0)
+    {
+        flint_printf("Exception (nmod_poly_batch_rem). Division by zero.\n");
+        flint_abort();
+    }
+
+    Binv = _nmod_poly_batch_lead_inv(B, "nmod_poly_batch_rem");
+
+    lenr = FLINT_MIN(FLINT_MIN(A->len, B->len - 1), R->len);
+
+    t = _nmod_vec_init(num * A->len);
+    _nmod_vec_set(t, A->coeffs, num * A->len);
+
+    _nmod_poly_batch_rem(t, t, A->len, B->coeffs, B->len, Binv, num, R->mod);
+
+    _nmod_vec_set(R->coeffs, t, num * lenr);
+    _nmod_vec_zero(R->coeffs + num * lenr, num * (R->len - lenr));
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(Binv);
+}
+
+void
+nmod_poly_batch_mulmod(nmod_poly_batch_t R, const nmod_poly_batch_t A,
+                 const nmod_poly_batch_t B, const nmod_poly_batch_t F)
+{
+    slong num = A->num, lent, lenr;
+    mp_ptr Finv, t;
+
+    if (B->num != num || F->num != num || R->num != num)
+    {
+        flint_printf("Exception (nmod_poly_batch_mulmod). "
+                     "Incompatible batch sizes.\n");
+        flint_abort();
+    }
+
+    if (F->len == 0)
+    {
+        flint_printf("Exception (nmod_poly_batch_mulmod). "
+                     "Division by zero.\n");
+        flint_abort();
+    }
+
+    if (A->len == 0 || B->len == 0)
+    {
+        nmod_poly_batch_zero(R);
+        return;
+    }
+
+    Finv = _nmod_poly_batch_lead_inv(F, "nmod_poly_batch_mulmod");
+
+    lent = A->len + B->len - 1;
+    lenr = FLINT_MIN(FLINT_MIN(lent, F->len - 1), R->len);
+
+    t = _nmod_vec_init(num * lent);
+
+    _nmod_poly_batch_mullow(t, A->coeffs, A->len, B->coeffs, B->len,
+                            lent, num, R->mod);
+    _nmod_poly_batch_rem(t, t, lent, F->coeffs, F->len, Finv, num, R->mod);
+
+    _nmod_vec_set(R->coeffs, t, num * lenr);
+    _nmod_vec_zero(R->coeffs + num * lenr, num * (R->len - lenr));
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(Finv);
+}
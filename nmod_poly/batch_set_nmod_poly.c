@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t B, slong i,
+                              const nmod_poly_t poly)
+{
+    slong j;
+
+    if (poly->length > B->len)
+    {
+        flint_printf("Exception (nmod_poly_batch_set_nmod_poly). "
+                     "Polynomial too long.\n");
+        flint_abort();
+    }
+
+    for (j = 0; j < poly->length; j++)
+        B->coeffs[j * B->num + i] = poly->coeffs[j];
+
+    for ( ; j < B->len; j++)
+        B->coeffs[j * B->num + i] = 0;
+}
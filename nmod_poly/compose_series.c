@@ -20,12 +20,20 @@ void
 _nmod_poly_compose_series(mp_ptr res, mp_srcptr poly1, slong len1, 
                             mp_srcptr poly2, slong len2, slong n, nmod_t mod)
 {
+    /*
+        Kinoshita-Li overtakes Brent-Kung from about n = 2000 when poly1
+        is short, but only from about n = 3500 for len1 of a few hundred
+        and more, where the matrix step of Brent-Kung is most efficient.
+    */
     if (len1 < 24 || len2 < 8)
         _nmod_poly_compose_series_horner(res, poly1, len1,
                                                     poly2, len2, n, mod);
-    else
+    else if (n < (len1 < 128 ? 2000 : 3500))
         _nmod_poly_compose_series_brent_kung(res, poly1, len1,
                                                     poly2, len2, n, mod);
+    else
+        _nmod_poly_compose_series_kinoshita_li(res, poly1, len1,
+                                                    poly2, len2, n, mod);
 }
 
 void
@@ -0,0 +1,204 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Bivariate polynomials with x-length N and y-degree at most e are stored
+    densely as Q[i*(e + 1) + j], the coefficient of x^i y^j.
+
+    The power projection of w with respect to g is the sequence
+    a_j = [x^(n - 1) y^j] rev(w)(x) / (1 - y g(x)). Composition is its
+    transpose: res = M^T f where a = M w. The power projection is computed
+    by the Graeffe iteration P / Q = (P(x, y) Q(-x, y)) / V(x^2, y) of
+    Kinoshita and Li, in which only the numerator depends on w; the routine
+    below is the transpose of the map w -> P, applied to f. It produces
+    the N by (d + 1) bivariate polynomial whose pairing with P gives
+    f applied to the power projection of the numerator P / Q, where
+    Q has y-degree e and everything is truncated at y-degree m.
+*/
+static void
+_nmod_poly_compose_series_kl_rec(mp_ptr P, slong d, mp_srcptr f, slong m,
+                               mp_srcptr Q, slong N, slong e, nmod_t mod)
+{
+    mp_ptr R, V, P2, T, U, W;
+    slong i, j, N2, d2, e2, S, par, len1, len2;
+
+    if (N == 1)
+    {
+        /* Q(0, y) = 1 */
+        _nmod_vec_set(P, f, d + 1);
+        return;
+    }
+
+    par = (N - 1) % 2;
+    N2 = (N - 1) / 2 + 1;
+    d2 = FLINT_MIN(d + e, m);
+    e2 = FLINT_MIN(2 * e, m);
+
+    /* R = Q(-x, y) */
+    R = _nmod_vec_init(N * (e + 1));
+    _nmod_vec_set(R, Q, N * (e + 1));
+    for (i = 1; i < N; i += 2)
+        _nmod_vec_neg(R + i * (e + 1), R + i * (e + 1), e + 1, mod);
+
+    /* V(x^2, y) = Q(x, y) Q(-x, y) by Kronecker substitution */
+    S = 2 * e + 1;
+    len1 = (N - 1) * S + e + 1;
+    T = _nmod_vec_init(3 * N * S);
+    U = T + N * S;
+    W = U + N * S;
+
+    _nmod_vec_zero(U, 2 * N * S);
+    for (i = 0; i < N; i++)
+    {
+        _nmod_vec_set(U + i * S, Q + i * (e + 1), e + 1);
+        _nmod_vec_set(W + i * S, R + i * (e + 1), e + 1);
+    }
+
+    _nmod_poly_mullow(T, U, len1, W, len1, N * S, mod);
+
+    V = _nmod_vec_init(N2 * (e2 + 1));
+    for (i = 0; i < N2; i++)
+        _nmod_vec_set(V + i * (e2 + 1), T + 2 * i * S, e2 + 1);
+
+    _nmod_vec_clear(T);
+
+    P2 = _nmod_vec_init(N2 * (d2 + 1));
+    _nmod_poly_compose_series_kl_rec(P2, d2, f, m, V, N2, e2, mod);
+    _nmod_vec_clear(V);
+
+    /*
+        Transposed multiplication by R: P[a, b] = sum U[a + c, b + k] R[c, k]
+        where U(x, y) = x^par P2(x^2, y), computed as a middle product.
+    */
+    S = d2 + e + 1;
+    len1 = (2 * N - 2) * S + d + e + 1;
+    len2 = (N - 1) * S + e + 1;
+
+    U = _nmod_vec_init(len1 + len2 + (N - 1) * S + d + 1);
+    W = U + len1;
+    T = W + len2;
+
+    _nmod_vec_zero(U, len1 + len2);
+    for (i = 0; 2 * i + par < N; i++)
+        _nmod_vec_set(U + (2 * i + par) * S, P2 + i * (d2 + 1), d2 + 1);
+
+    for (i = 0; i < N; i++)
+        for (j = 0; j <= e; j++)
+            W[(N - 1 - i) * S + e - j] = R[i * (e + 1) + j];
+
+    _nmod_poly_mulmid(T, U, len1, W, len2, mod);
+
+    for (i = 0; i < N; i++)
+        _nmod_vec_set(P + i * (d + 1), T + i * S, d + 1);
+
+    _nmod_vec_clear(U);
+    _nmod_vec_clear(P2);
+    _nmod_vec_clear(R);
+}
+
+void
+_nmod_poly_compose_series_kinoshita_li(mp_ptr res, mp_srcptr poly1,
+        slong len1, mp_srcptr poly2, slong len2, slong n, nmod_t mod)
+{
+    mp_ptr Q, P, f;
+    slong i, m, e;
+
+    if (n == 1)
+    {
+        res[0] = poly1[0];
+        return;
+    }
+
+    m = len1 - 1;
+    e = FLINT_MIN(1, m);
+
+    /* Q = 1 - y g(x) */
+    Q = _nmod_vec_init(n * (e + 1));
+    _nmod_vec_zero(Q, n * (e + 1));
+    Q[0] = 1;
+    if (e == 1)
+        for (i = 1; i < len2; i++)
+            Q[2 * i + 1] = nmod_neg(poly2[i], mod);
+
+    f = _nmod_vec_init(len1);
+    _nmod_vec_set(f, poly1, len1);
+
+    P = _nmod_vec_init(n);
+    _nmod_poly_compose_series_kl_rec(P, 0, f, m, Q, n, e, mod);
+
+    /* the power projection reverses w */
+    for (i = 0; i < n; i++)
+        res[i] = P[n - 1 - i];
+
+    _nmod_vec_clear(P);
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(Q);
+}
+
+void
+nmod_poly_compose_series_kinoshita_li(nmod_poly_t res,
+                    const nmod_poly_t poly1, const nmod_poly_t poly2, slong n)
+{
+    slong len1 = poly1->length;
+    slong len2 = poly2->length;
+    slong lenr;
+
+    if (len2 != 0 && poly2->coeffs[0] != 0)
+    {
+        flint_printf("Exception (nmod_poly_compose_series_kinoshita_li). Inner\n"
+               "polynomial must have zero constant term.\n");
+        flint_abort();
+    }
+
+    if (len1 == 0 || n == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (len2 == 0 || len1 == 1)
+    {
+        nmod_poly_fit_length(res, 1);
+        res->coeffs[0] = poly1->coeffs[0];
+        res->length = 1;
+        _nmod_poly_normalise(res);
+        return;
+    }
+
+    lenr = FLINT_MIN((len1 - 1) * (len2 - 1) + 1, n);
+    len1 = FLINT_MIN(len1, lenr);
+    len2 = FLINT_MIN(len2, lenr);
+
+    if ((res != poly1) && (res != poly2))
+    {
+        nmod_poly_fit_length(res, lenr);
+        _nmod_poly_compose_series_kinoshita_li(res->coeffs, poly1->coeffs,
+                                len1, poly2->coeffs, len2, lenr, res->mod);
+        res->length = lenr;
+        _nmod_poly_normalise(res);
+    }
+    else
+    {
+        nmod_poly_t t;
+        nmod_poly_init2_preinv(t, res->mod.n, res->mod.ninv, lenr);
+        _nmod_poly_compose_series_kinoshita_li(t->coeffs, poly1->coeffs,
+                                len1, poly2->coeffs, len2, lenr, res->mod);
+        t->length = lenr;
+        _nmod_poly_normalise(t);
+        nmod_poly_swap(res, t);
+        nmod_poly_clear(t);
+    }
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -24,14 +25,145 @@ static __inline__ void _nmod_poly_rem_2(mp_ptr r, mp_srcptr a, slong al,
         _nmod_poly_rem(r, a, al, b, bl, mod);
 }
 
+/*
+    If poly is not NULL, reduces (poly, plen) modulo the blocks b0, ..., b1 - 1
+    of level i, writing to u. Otherwise, reduces the pairs of blocks
+    b0, ..., b1 - 1 of level i + 1 in t modulo their children.
+*/
+static void
+_nmod_poly_evaluate_level(mp_ptr u, mp_srcptr t, mp_srcptr poly, slong plen,
+        const mp_ptr * tree, slong len, slong i, slong b0, slong b1,
+        nmod_t mod)
+{
+    slong pow, left;
+    mp_srcptr pa, pb;
+    mp_ptr pc;
+
+    pow = WORD(1) << i;
+
+    if (poly != NULL)
+    {
+        for ( ; b0 < b1; b0++)
+        {
+            left = FLINT_MIN(pow, len - b0 * pow);
+            _nmod_poly_rem(u + b0 * pow, poly, plen,
+                           tree[i] + b0 * (pow + 1), left + 1, mod);
+        }
+
+        return;
+    }
+
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + b0 * (2 * pow + 2);
+    pb = t + b0 * 2 * pow;
+    pc = u + b0 * 2 * pow;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        _nmod_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, mod);
+        _nmod_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, mod);
+
+        pa += 2 * pow + 2;
+        pb += 2 * pow;
+        pc += 2 * pow;
+        left -= 2 * pow;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            _nmod_poly_rem(pc, pb, left, pa, pow + 1, mod);
+            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, mod);
+        }
+        else if (left > 0)
+            _nmod_vec_set(pc, pb, left);
+    }
+}
+
+typedef struct
+{
+    mp_ptr u;
+    mp_srcptr t;
+    mp_srcptr poly;
+    slong plen;
+    const mp_ptr * tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    nmod_t mod;
+}
+evaluate_level_arg_t;
+
+void *
+_nmod_poly_evaluate_level_worker(void * arg_ptr)
+{
+    evaluate_level_arg_t arg = *((evaluate_level_arg_t *) arg_ptr);
+
+    _nmod_poly_evaluate_level(arg.u, arg.t, arg.poly, arg.plen, arg.tree,
+                              arg.len, arg.i, arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_nmod_poly_evaluate_level_threaded(mp_ptr u, mp_srcptr t, mp_srcptr poly,
+        slong plen, const mp_ptr * tree, slong len, slong i, nmod_t mod)
+{
+    slong blocks, j, num_threads;
+    pthread_t * threads;
+    evaluate_level_arg_t * args;
+
+    /* the blocks of level i, or the pairs of blocks of level i + 1 */
+    blocks = (poly != NULL) ? ((len - 1) >> i) + 1 : ((len - 1) >> (i + 1)) + 1;
+
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, blocks);
+
+    if (num_threads <= 1)
+    {
+        _nmod_poly_evaluate_level(u, t, poly, plen, tree, len, i,
+                                                           0, blocks, mod);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(evaluate_level_arg_t) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        args[j].u = u;
+        args[j].t = t;
+        args[j].poly = poly;
+        args[j].plen = plen;
+        args[j].tree = tree;
+        args[j].len = len;
+        args[j].i = i;
+        args[j].b0 = (blocks * j) / num_threads;
+        args[j].b1 = (blocks * (j + 1)) / num_threads;
+        args[j].mod = mod;
+
+        pthread_create(&threads[j], NULL,
+                       _nmod_poly_evaluate_level_worker, &args[j]);
+    }
+
+    for (j = 0; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
     slong plen, const mp_ptr * tree, slong len, nmod_t mod)
 {
-    slong height, i, j, pow, left;
+    slong height, i;
     slong tree_height;
-    slong tlen;
-    mp_ptr t, u, swap, pa, pb, pc;
+    mp_ptr t, u, swap;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
@@ -50,48 +182,19 @@ _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
     t = _nmod_vec_init(len);
     u = _nmod_vec_init(len);
 
-    left = len;
-
     /* Initial reduction. We allow the polynomial to be larger
        or smaller than the number of points. */
     height = FLINT_BIT_COUNT(plen - 1) - 1;
     tree_height = FLINT_CLOG2(len);
     while (height >= tree_height)
         height--;
-    pow = WORD(1) << height;
 
-    for (i = j = 0; i < len; i += pow, j += (pow + 1))
-    {
-        tlen = ((i + pow) <= len) ? pow : len % pow;
-        _nmod_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, mod);
-    }
+    _nmod_poly_evaluate_level_threaded(t, NULL, poly, plen,
+                                       tree, len, height, mod);
 
     for (i = height - 1; i >= 0; i--)
     {
-        pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
-
-        while (left >= 2 * pow)
-        {
-            _nmod_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, mod);
-            _nmod_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, mod);
-
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
-
-        if (left > pow)
-        {
-            _nmod_poly_rem(pc, pb, left, pa, pow + 1, mod);
-            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, mod);
-        }
-        else if (left > 0)
-            _nmod_vec_set(pc, pb, left);
+        _nmod_poly_evaluate_level_threaded(u, t, NULL, 0, tree, len, i, mod);
 
         swap = t;
         t = u;
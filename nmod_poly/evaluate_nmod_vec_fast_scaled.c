@@ -0,0 +1,251 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Scaled remainder tree. Instead of f mod P, each node P of the subproduct
+    tree holds the first deg(P) coefficients c_1, c_2, ... of the expansion
+    of f/P in 1/x, stored in reverse order. If P = Q R, the values for Q are
+    given by the middle product of those for P with R, as R (f mod P)/P and
+    (f mod Q)/Q only differ by a polynomial. At a leaf x - a the single
+    value would be f(a). Only the root needs a power series inverse, which can
+    be precomputed by _nmod_poly_tree_inv_root.
+*/
+
+/*
+    Below this block size the remainder tree is faster, so the scaled values
+    are converted to remainders, f mod P being given by the top deg(P)
+    coefficients of P times the scaled values.
+*/
+#define NMOD_POLY_SCALED_TREE_CUTOFF 64
+
+static void
+_nmod_poly_evaluate_block(mp_ptr vs, mp_srcptr c, slong len,
+                   const mp_ptr * tree, slong i0, slong start, nmod_t mod)
+{
+    mp_ptr * sub, r;
+    slong i;
+
+    sub = flint_malloc(sizeof(mp_ptr) * (i0 + 1));
+    r = _nmod_vec_init(2 * len);
+
+    /* the blocks of the subtree for the points start, ..., start + len - 1
+       are contiguous at each level */
+    for (i = 0; i <= i0; i++)
+        sub[i] = tree[i] + start + (start >> i);
+
+    _nmod_poly_mulhigh(r, sub[i0], len + 1, c, len, len, mod);
+    _nmod_poly_evaluate_nmod_vec_fast_precomp(vs, r + len, len,
+                                       (const mp_ptr *) sub, len, mod);
+
+    _nmod_vec_clear(r);
+    flint_free(sub);
+}
+
+/*
+    If i0 is nonzero, finishes the blocks b0, ..., b1 - 1 of level i0 with
+    the remainder tree. Otherwise, computes the scaled values of the
+    children in tree[i] of the pairs of blocks b0, ..., b1 - 1 of level
+    i + 1 in t, writing to u.
+*/
+static void
+_nmod_poly_evaluate_scaled_level(mp_ptr u, mp_srcptr t, const mp_ptr * tree,
+        slong len, slong i, slong i0, slong b0, slong b1, nmod_t mod)
+{
+    slong pow, left;
+    mp_srcptr pa, pb;
+    mp_ptr pc;
+
+    if (i0 != 0)
+    {
+        pow = WORD(1) << i0;
+
+        for ( ; b0 < b1; b0++)
+            _nmod_poly_evaluate_block(u + b0 * pow, t + b0 * pow,
+                   FLINT_MIN(pow, len - b0 * pow), tree, i0, b0 * pow, mod);
+
+        return;
+    }
+
+    pow = WORD(1) << i;
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + b0 * (2 * pow + 2);
+    pb = t + b0 * 2 * pow;
+    pc = u + b0 * 2 * pow;
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        _nmod_poly_mulmid(pc, pb, 2 * pow, pa + pow + 1, pow + 1, mod);
+        _nmod_poly_mulmid(pc + pow, pb, 2 * pow, pa, pow + 1, mod);
+
+        pa += 2 * pow + 2;
+        pb += 2 * pow;
+        pc += 2 * pow;
+        left -= 2 * pow;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+        {
+            _nmod_poly_mulmid(pc, pb, left, pa + pow + 1, left - pow + 1, mod);
+            _nmod_poly_mulmid(pc + pow, pb, left, pa, pow + 1, mod);
+        }
+        else if (left > 0)
+            _nmod_vec_set(pc, pb, left);
+    }
+}
+
+typedef struct
+{
+    mp_ptr u;
+    mp_srcptr t;
+    const mp_ptr * tree;
+    slong len;
+    slong i;
+    slong i0;
+    slong b0;
+    slong b1;
+    nmod_t mod;
+}
+scaled_level_arg_t;
+
+void *
+_nmod_poly_evaluate_scaled_level_worker(void * arg_ptr)
+{
+    scaled_level_arg_t arg = *((scaled_level_arg_t *) arg_ptr);
+
+    _nmod_poly_evaluate_scaled_level(arg.u, arg.t, arg.tree, arg.len,
+                                  arg.i, arg.i0, arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_nmod_poly_evaluate_scaled_level_threaded(mp_ptr u, mp_srcptr t,
+        const mp_ptr * tree, slong len, slong i, slong i0, nmod_t mod)
+{
+    slong blocks, j, num_threads;
+    pthread_t * threads;
+    scaled_level_arg_t * args;
+
+    /* the blocks of level i0, or the pairs of blocks of level i + 1 */
+    blocks = (i0 != 0) ? ((len - 1) >> i0) + 1 : ((len - 1) >> (i + 1)) + 1;
+
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, blocks);
+
+    if (num_threads <= 1)
+    {
+        _nmod_poly_evaluate_scaled_level(u, t, tree, len, i, i0,
+                                                          0, blocks, mod);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(scaled_level_arg_t) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        args[j].u = u;
+        args[j].t = t;
+        args[j].tree = tree;
+        args[j].len = len;
+        args[j].i = i;
+        args[j].i0 = i0;
+        args[j].b0 = (blocks * j) / num_threads;
+        args[j].b1 = (blocks * (j + 1)) / num_threads;
+        args[j].mod = mod;
+
+        pthread_create(&threads[j], NULL,
+                       _nmod_poly_evaluate_scaled_level_worker, &args[j]);
+    }
+
+    for (j = 0; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+_nmod_poly_evaluate_nmod_vec_fast_scaled_precomp(mp_ptr vs, mp_srcptr poly,
+    slong plen, const mp_ptr * tree, mp_srcptr rinv, slong len, nmod_t mod)
+{
+    slong height, i, pow;
+    mp_ptr t, u, swap;
+
+    height = FLINT_CLOG2(len);
+
+    /* the root inverse and the top levels only pay off for large trees */
+    if (len < 16 * NMOD_POLY_SCALED_TREE_CUTOFF || plen < 2)
+    {
+        _nmod_poly_evaluate_nmod_vec_fast_precomp(vs, poly, plen,
+                                                            tree, len, mod);
+        return;
+    }
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+
+    if (plen > len)
+    {
+        mp_ptr P, r;
+
+        pow = WORD(1) << (height - 1);
+
+        P = _nmod_vec_init(len + 1);
+        r = _nmod_vec_init(len);
+
+        _nmod_poly_mul(P, tree[height - 1], pow + 1,
+                          tree[height - 1] + (pow + 1), len - pow + 1, mod);
+        _nmod_poly_rem(r, poly, plen, P, len + 1, mod);
+
+        _nmod_poly_evaluate_nmod_vec_fast_scaled_precomp(vs, r, len,
+                                                        tree, rinv, len, mod);
+
+        _nmod_vec_clear(P);
+        _nmod_vec_clear(r);
+        _nmod_vec_clear(t);
+        _nmod_vec_clear(u);
+        return;
+    }
+
+    /* root: the coefficients of 1/x^(len - plen + 1), ..., 1/x^len of
+       f/P are those of rev(f) / rev(P) */
+    _nmod_poly_reverse(u, poly, plen, plen);
+    _nmod_poly_mullow(t, u, plen, rinv, plen, plen, mod);
+    _nmod_poly_reverse(t, t, plen, plen);
+    _nmod_vec_zero(t + plen, len - plen);
+
+    for (i = height - 1; (WORD(1) << i) >= NMOD_POLY_SCALED_TREE_CUTOFF; i--)
+    {
+        _nmod_poly_evaluate_scaled_level_threaded(u, t, tree, len, i, 0, mod);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    /* finish each block with the remainder tree */
+    _nmod_poly_evaluate_scaled_level_threaded(vs, t, tree, len, 0, i + 1, mod);
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
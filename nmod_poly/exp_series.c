@@ -53,14 +53,14 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
         l = m - 1;         /* shifted for derivative */
 
         /* g := exp(-h) + O(x^m) */
-        _nmod_poly_mullow(T, f, m, g, m2, m, mod);
+        _nmod_poly_mulmid(T + m2 - 1, f, m, g, m2, mod);
         _nmod_poly_mullow(g + m2, g, m2, T + m2, m - m2, m - m2, mod);
         _nmod_vec_neg(g + m2, g + m2, m - m2, mod);
 
         /* U := h' + g (f' - f h') + O(x^(n-1))
            Note: should replace h' by h' mod x^(m-1) */
         _nmod_vec_zero(f + m, n - m);
-        _nmod_poly_mullow(T, f, n, hprime, n, n, mod);     /* should be mulmid */
+        _nmod_poly_mulmid(T + l, hprime, n, f, m, mod);
         _nmod_poly_derivative(U, f, n, mod); U[n - 1] = 0; /* should skip low terms */
         _nmod_vec_sub(U + l, U + l, T + l, n - l, mod);
         _nmod_poly_mullow(T + l, g, n - m, U + l, n - m, n - m, mod);
@@ -75,7 +75,7 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
         /* not needed if we only want exp(x) */
         if (i == 0 && inverse)
         {
-            _nmod_poly_mullow(T, f, n, g, m, n, mod);
+            _nmod_poly_mulmid(T + m - 1, f, n, g, m, mod);
             _nmod_poly_mullow(g + m, g, m, T + m, n - m, n - m, mod);
             _nmod_vec_neg(g + m, g + m, n - m, mod);
         }
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -46,50 +47,120 @@ _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree, slong len, nmod_
     _nmod_vec_clear(tmp);
 }
 
+/* combines the pairs of blocks b0, ..., b1 - 1 of level i + 1 */
+static void
+_nmod_poly_interpolate_level(mp_ptr poly, const mp_ptr * tree, slong len,
+                                   slong i, slong b0, slong b1, nmod_t mod)
+{
+    mp_ptr t, u, pa, pb;
+    slong pow, left;
+
+    pow = WORD(1) << i;
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + b0 * (2 * pow + 2);
+    pb = poly + b0 * 2 * pow;
+
+    t = _nmod_vec_init(2 * pow);
+    u = _nmod_vec_init(2 * pow);
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, mod);
+        _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, mod);
+        _nmod_vec_add(pb, t, u, 2 * pow, mod);
+
+        left -= 2 * pow;
+        pa += 2 * pow + 2;
+        pb += 2 * pow;
+    }
+
+    if (b0 < b1 && left > pow)
+    {
+        _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, mod);
+        _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, mod);
+        _nmod_vec_add(pb, t, u, left, mod);
+    }
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+typedef struct
+{
+    mp_ptr poly;
+    const mp_ptr * tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    nmod_t mod;
+}
+interpolate_level_arg_t;
+
+void *
+_nmod_poly_interpolate_level_worker(void * arg_ptr)
+{
+    interpolate_level_arg_t arg = *((interpolate_level_arg_t *) arg_ptr);
+
+    _nmod_poly_interpolate_level(arg.poly, arg.tree, arg.len, arg.i,
+                                 arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcptr ys,
     const mp_ptr * tree, mp_srcptr weights, slong len, nmod_t mod)
 {
-    mp_ptr t, u, pa, pb;
-    slong i, pow, left;
+    slong i, j, pairs, num_threads;
+    pthread_t * threads;
+    interpolate_level_arg_t * args;
 
     if (len == 0)
         return;
 
-    t = _nmod_vec_init(len);
-    u = _nmod_vec_init(len);
-
     for (i = 0; i < len; i++)
         poly[i] = nmod_mul(weights[i], ys[i], mod);
 
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(interpolate_level_arg_t) * num_threads);
+
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
-        pow = (WORD(1) << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        slong nt;
 
-        while (left >= 2 * pow)
-        {
-            _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, mod);
-            _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, mod);
-            _nmod_vec_add(pb, t, u, 2 * pow, mod);
+        pairs = ((len - 1) >> (i + 1)) + 1;
+        nt = FLINT_MIN(num_threads, pairs);
 
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
+        if (nt <= 1)
+        {
+            _nmod_poly_interpolate_level(poly, tree, len, i, 0, pairs, mod);
+            continue;
         }
 
-        if (left > pow)
+        for (j = 0; j < nt; j++)
         {
-            _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, mod);
-            _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, mod);
-            _nmod_vec_add(pb, t, u, left, mod);
+            args[j].poly = poly;
+            args[j].tree = tree;
+            args[j].len = len;
+            args[j].i = i;
+            args[j].b0 = (pairs * j) / nt;
+            args[j].b1 = (pairs * (j + 1)) / nt;
+            args[j].mod = mod;
+
+            pthread_create(&threads[j], NULL,
+                           _nmod_poly_interpolate_level_worker, &args[j]);
         }
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
     }
 
-    _nmod_vec_clear(t);
-    _nmod_vec_clear(u);
+    flint_free(threads);
+    flint_free(args);
 }
 
 
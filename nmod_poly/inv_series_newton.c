@@ -64,7 +64,13 @@ _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong Qlen, slong n, nmod
             Qnlen = FLINT_MIN(Qlen, n);
             Wlen = FLINT_MIN(Qnlen + m - 1, n);
             W2len = Wlen - m;
-            MULLOW(W, Q, Qnlen, Qinv, m, Wlen, mod);
+            /* only the coefficients m, ..., Wlen - 1 of Q Qinv are needed */
+            if (Qnlen == n)
+                _nmod_poly_mulmid(W + m - 1, Q, n, Qinv, m, mod);
+            else
+            {
+                MULLOW(W, Q, Qnlen, Qinv, m, Wlen, mod);
+            }
             MULLOW(Qinv + m, Qinv, m, W + m, W2len, n - m, mod);
             _nmod_vec_neg(Qinv + m, Qinv + m, n - m, mod);
         }
@@ -0,0 +1,83 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/* Assumes len1 >= len2 > 0 */
+void
+_nmod_poly_mulmid(mp_ptr res, mp_srcptr poly1, slong len1,
+                              mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    slong bits, len_out = len1 - len2 + 1;
+
+    if (len2 <= 20 || len_out <= 20)
+    {
+        _nmod_poly_mulmid_classical(res, poly1, len1, poly2, len2, mod);
+        return;
+    }
+
+    bits = 2 * (FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(len2) + 2;
+
+    /* for short products the multiplication modulo 2^N + 1 is not
+       competitive with a low product, which uses mpn_mul */
+    if (len1 * bits > 2000 * FLINT_BITS)
+    {
+        _nmod_poly_mulmid_KS(res, poly1, len1, poly2, len2, mod);
+    }
+    else
+    {
+        mp_ptr t = _nmod_vec_init(len1);
+
+        _nmod_poly_mullow(t, poly1, len1, poly2, len2, len1, mod);
+        _nmod_vec_set(res, t + len2 - 1, len_out);
+
+        _nmod_vec_clear(t);
+    }
+}
+
+void
+nmod_poly_mulmid(nmod_poly_t res,
+                 const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len_out;
+
+    if (poly1->length == 0 || poly2->length == 0
+        || poly1->length < poly2->length)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length - poly2->length + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        _nmod_poly_mulmid(temp->coeffs, poly1->coeffs, poly1->length,
+                          poly2->coeffs, poly2->length, poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        _nmod_poly_mulmid(res->coeffs, poly1->coeffs, poly1->length,
+                          poly2->coeffs, poly2->length, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
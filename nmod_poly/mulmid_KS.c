@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fft.h"
+
+/*
+    Let poly1 and poly2 be packed into integers with fields of b' = b + 2
+    bits, where 2^b bounds the coefficients of the full product. Working
+    modulo 2^N + 1 with N >= len1*b', write N = K*b' + r. If poly1 is shifted
+    left by r bits, the product coefficients of index k >= K wrap around onto
+    the fields (k - K)*b' with a minus sign. As K >= len1, these only land
+    below the field len2 - 1, i.e. below the wanted coefficients. Adding
+    2^(s - 1) with s = r + (len2 - 1)*b' makes everything below bit s
+    nonnegative without a carry into the middle coefficients, which can then
+    be read off from bit s. Thus we only need a product modulo 2^N + 1 of
+    about len1 coefficients instead of a full product of len1 + len2.
+*/
+
+/* Assumes len1 >= len2 > 0 */
+void
+_nmod_poly_mulmid_KS(mp_ptr out, mp_srcptr in1, slong len1,
+                              mp_srcptr in2, slong len2, nmod_t mod)
+{
+    mp_bitcnt_t bits, bits1, bits2, r, s;
+    slong limbs, t, q;
+    mp_ptr A, B, R, tt;
+
+    if (len2 == 1)
+    {
+        _nmod_vec_scalar_mul_nmod(out, in1, len1, in2[0], mod);
+        return;
+    }
+
+    bits1 = _nmod_vec_max_bits(in1, len1);
+    bits2 = (in1 == in2) ? bits1 : _nmod_vec_max_bits(in2, len2);
+
+    if (bits1 == 0 || bits2 == 0)
+    {
+        _nmod_vec_zero(out, len1 - len2 + 1);
+        return;
+    }
+
+    bits = bits1 + bits2 + FLINT_BIT_COUNT(len2) + 2;
+
+    limbs = (len1 * bits - 1) / FLINT_BITS + 1;
+    limbs = fft_adjust_limbs(limbs);
+
+    r = (limbs * FLINT_BITS) % bits;
+    s = r + (len2 - 1) * bits;
+
+    A = flint_calloc(5 * (limbs + 1), sizeof(mp_limb_t));
+    B = A + (limbs + 1);
+    R = B + (limbs + 1);
+    tt = R + (limbs + 1);
+
+    /* A = poly1(2^bits) * 2^r */
+    q = r / FLINT_BITS;
+    t = (len1 * bits - 1) / FLINT_BITS + 1;
+    _nmod_poly_bit_pack(A + q, in1, len1, bits);
+    if (r % FLINT_BITS != 0)
+    {
+        mp_limb_t cy = mpn_lshift(A + q, A + q, t, r % FLINT_BITS);
+        if (q + t <= limbs)
+            A[q + t] = cy;
+    }
+
+    _nmod_poly_bit_pack(B, in2, len2, bits);
+
+    fft_mulmod_2expp1(R, A, B, limbs, FLINT_BITS, tt);
+
+    /* add the bias 2^(s - 1); the sum lies in (0, 2^N), or exceeds 2^N + 1 */
+    mpn_add_1(R + (s - 1) / FLINT_BITS, R + (s - 1) / FLINT_BITS,
+              limbs + 1 - (s - 1) / FLINT_BITS,
+              UWORD(1) << ((s - 1) % FLINT_BITS));
+    if (R[limbs] != 0)
+    {
+        R[limbs]--;
+        mpn_sub_1(R, R, limbs + 1, 1);
+    }
+
+    /* read the middle coefficients from bit s */
+    q = s / FLINT_BITS;
+    if (s % FLINT_BITS != 0)
+        mpn_rshift(A, R + q, limbs - q, s % FLINT_BITS);
+    else
+        flint_mpn_copyi(A, R + q, limbs - q);
+    A[limbs - q] = 0;
+
+    _nmod_poly_bit_unpack(out, len1 - len2 + 1, A, bits, mod);
+
+    flint_free(A);
+}
+
+void
+nmod_poly_mulmid_KS(nmod_poly_t res,
+                    const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len_out;
+
+    if (poly1->length == 0 || poly2->length == 0
+        || poly1->length < poly2->length)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length - poly2->length + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        _nmod_poly_mulmid_KS(temp->coeffs, poly1->coeffs, poly1->length,
+                             poly2->coeffs, poly2->length, poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        _nmod_poly_mulmid_KS(res->coeffs, poly1->coeffs, poly1->length,
+                             poly2->coeffs, poly2->length, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
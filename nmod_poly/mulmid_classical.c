@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/* Assumes poly1 and poly2 are not length 0 and len1 >= len2 */
+void
+_nmod_poly_mulmid_classical(mp_ptr res, mp_srcptr poly1, slong len1,
+                            mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    slong i, j, nlimbs;
+    mp_limb_t s;
+
+    if (len2 == 1)
+    {
+        _nmod_vec_scalar_mul_nmod(res, poly1, len1, poly2[0], mod);
+        return;
+    }
+
+    nlimbs = _nmod_vec_dot_bound_limbs(len2, mod);
+
+    /* res[i] = sum_j poly1[i + len2 - 1 - j] * poly2[j] */
+    for (i = 0; i < len1 - len2 + 1; i++)
+    {
+        NMOD_VEC_DOT(s, j, len2, poly1[i + len2 - 1 - j], poly2[j],
+                                                                mod, nlimbs);
+        res[i] = s;
+    }
+}
+
+void
+nmod_poly_mulmid_classical(nmod_poly_t res,
+                           const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len_out;
+
+    if (poly1->length == 0 || poly2->length == 0
+        || poly1->length < poly2->length)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length - poly2->length + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        _nmod_poly_mulmid_classical(temp->coeffs, poly1->coeffs,
+              poly1->length, poly2->coeffs, poly2->length, poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        _nmod_poly_mulmid_classical(res->coeffs, poly1->coeffs,
+              poly1->length, poly2->coeffs, poly2->length, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
@@ -20,7 +20,11 @@
 void
 _nmod_poly_revert_series(mp_ptr Qinv, mp_srcptr Q, slong n, nmod_t mod)
 {
-    _nmod_poly_revert_series_lagrange_fast(Qinv, Q, n, mod);
+    /* Newton iteration benefits from the fast composition for large n */
+    if (n < 8000)
+        _nmod_poly_revert_series_lagrange_fast(Qinv, Q, n, mod);
+    else
+        _nmod_poly_revert_series_newton(Qinv, Q, n, mod);
 }
 
 void
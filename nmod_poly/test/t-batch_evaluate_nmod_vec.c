@@ -0,0 +1,76 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("batch_evaluate_nmod_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A;
+        nmod_poly_t a;
+        mp_ptr xs, ys;
+        mp_limb_t n;
+        slong j, num, len;
+
+        n = n_randtest_not_zero(state);
+        num = n_randint(state, 20);
+        len = n_randint(state, 30);
+
+        nmod_poly_batch_init(A, num, len, n);
+        nmod_poly_init(a, n);
+        xs = _nmod_vec_init(num);
+        ys = _nmod_vec_init(num);
+
+        nmod_poly_batch_randtest(A, state);
+        _nmod_vec_randtest(xs, state, num, A->mod);
+
+        nmod_poly_batch_evaluate_nmod_vec(ys, A, xs);
+
+        result = 1;
+        for (j = 0; j < num && result; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            result = (ys[j] == nmod_poly_evaluate_nmod(a, xs[j]));
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, num = %wd, j = %wd\n", n, num, j - 1);
+            nmod_poly_print(a), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_clear(a);
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
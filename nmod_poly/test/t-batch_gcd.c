@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("batch_gcd....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A, B, G;
+        nmod_poly_t a, b, g, h;
+        mp_limb_t n;
+        slong j, num, len1, len2;
+        int alias;
+
+        n = n_randtest_prime(state, 0);
+        num = n_randint(state, 20);
+        len1 = n_randint(state, 30);
+        len2 = n_randint(state, 30);
+        alias = (len1 == len2) ? n_randint(state, 2) : 0;
+
+        nmod_poly_batch_init(A, num, len1, n);
+        nmod_poly_batch_init(B, num, len2, n);
+        nmod_poly_batch_init(G, num, FLINT_MAX(len1, len2), n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(g, n);
+        nmod_poly_init(h, n);
+
+        /* polynomials with common factors */
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_randtest(g, state,
+                        n_randint(state, FLINT_MIN(len1, len2) / 2 + 1) + 1);
+            nmod_poly_randtest(a, state, len1 - g->length + 1);
+            nmod_poly_randtest(b, state, len2 - g->length + 1);
+            nmod_poly_mul(a, a, g);
+            nmod_poly_mul(b, b, g);
+            nmod_poly_batch_set_nmod_poly(A, j, a);
+            nmod_poly_batch_set_nmod_poly(B, j, b);
+        }
+
+        if (alias)
+        {
+            _nmod_vec_set(G->coeffs, A->coeffs, num * len1);
+            nmod_poly_batch_gcd(G, G, B);
+        }
+        else
+            nmod_poly_batch_gcd(G, A, B);
+
+        result = 1;
+        for (j = 0; j < num && result; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(g, G, j);
+            nmod_poly_gcd(h, a, b);
+
+            result = nmod_poly_equal(g, h);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, num = %wd, j = %wd\n", n, num, j - 1);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            nmod_poly_print(g), flint_printf("\n\n");
+            nmod_poly_print(h), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(G);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(g);
+        nmod_poly_clear(h);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("batch_mul....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A, B, C;
+        nmod_poly_t a, b, c, d;
+        mp_limb_t n;
+        slong j, num, len1, len2, len3;
+        int alias;
+
+        n = n_randtest_not_zero(state);
+        num = n_randint(state, 20);
+        len1 = n_randint(state, 30);
+        len2 = n_randint(state, 30);
+        len3 = n_randint(state, 60);
+        alias = n_randint(state, 3);
+
+        if (alias == 1)
+            len3 = len1;
+        else if (alias == 2)
+            len3 = len2;
+
+        nmod_poly_batch_init(A, num, len1, n);
+        nmod_poly_batch_init(B, num, len2, n);
+        nmod_poly_batch_init(C, num, len3, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        nmod_poly_batch_randtest(A, state);
+        nmod_poly_batch_randtest(B, state);
+        nmod_poly_batch_randtest(C, state);
+
+        if (alias == 0)
+        {
+            nmod_poly_batch_mul(C, A, B);
+        }
+        else if (alias == 1)
+        {
+            _nmod_vec_set(C->coeffs, A->coeffs, num * len1);
+            nmod_poly_batch_mul(C, C, B);
+        }
+        else
+        {
+            _nmod_vec_set(C->coeffs, B->coeffs, num * len2);
+            nmod_poly_batch_mul(C, A, C);
+        }
+
+        /* products longer than C are truncated to its length */
+        result = 1;
+        for (j = 0; j < num && result; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(c, C, j);
+            nmod_poly_mullow(d, a, b, len3);
+
+            result = nmod_poly_equal(c, d);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, num = %wd, j = %wd, alias = %d\n",
+                         n, num, j - 1, alias);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            nmod_poly_print(c), flint_printf("\n\n");
+            nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(C);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    /* Check that the full products are obtained if C is long enough */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A, B, C;
+        nmod_poly_t a, b, c, d;
+        mp_limb_t n;
+        slong j, num, len1, len2, len3;
+
+        n = n_randtest_not_zero(state);
+        num = n_randint(state, 20);
+        len1 = 1 + n_randint(state, 30);
+        len2 = 1 + n_randint(state, 30);
+        len3 = len1 + len2 - 1 + n_randint(state, 3);
+
+        nmod_poly_batch_init(A, num, len1, n);
+        nmod_poly_batch_init(B, num, len2, n);
+        nmod_poly_batch_init(C, num, len3, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        nmod_poly_batch_randtest(A, state);
+        nmod_poly_batch_randtest(B, state);
+        nmod_poly_batch_randtest(C, state);
+
+        nmod_poly_batch_mul(C, A, B);
+
+        result = 1;
+        for (j = 0; j < num && result; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(c, C, j);
+            nmod_poly_mul(d, a, b);
+
+            result = nmod_poly_equal(c, d);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL (full product):\n");
+            flint_printf("n = %wu, num = %wd, j = %wd\n", n, num, j - 1);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            nmod_poly_print(c), flint_printf("\n\n");
+            nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(C);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("batch_mulmod....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A, B, F, R, S;
+        nmod_poly_t a, b, f, r, s, t;
+        mp_limb_t n;
+        slong j, num, len1, len2, len3;
+
+        n = n_randtest_prime(state, 0);
+        num = n_randint(state, 20);
+        len1 = n_randint(state, 30);
+        len2 = n_randint(state, 30);
+        len3 = n_randint(state, 30) + 1;
+
+        nmod_poly_batch_init(A, num, len1, n);
+        nmod_poly_batch_init(B, num, len2, n);
+        nmod_poly_batch_init(F, num, len3, n);
+        nmod_poly_batch_init(R, num, len3 - 1 + n_randint(state, 3), n);
+        nmod_poly_batch_init(S, num, FLINT_MIN(len1, len3 - 1), n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(r, n);
+        nmod_poly_init(s, n);
+        nmod_poly_init(t, n);
+
+        nmod_poly_batch_randtest(A, state);
+        nmod_poly_batch_randtest(B, state);
+        nmod_poly_batch_randtest(R, state);
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_randtest(f, state, len3);
+            nmod_poly_set_coeff_ui(f, len3 - 1, n_randint(state, n - 1) + 1);
+            nmod_poly_batch_set_nmod_poly(F, j, f);
+        }
+
+        nmod_poly_batch_mulmod(R, A, B, F);
+        nmod_poly_batch_rem(S, A, F);
+
+        result = 1;
+        for (j = 0; j < num && result; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(f, F, j);
+            nmod_poly_batch_get_nmod_poly(r, R, j);
+            nmod_poly_batch_get_nmod_poly(s, S, j);
+
+            nmod_poly_mul(t, a, b);
+            nmod_poly_rem(t, t, f);
+            result = nmod_poly_equal(r, t);
+
+            nmod_poly_rem(t, a, f);
+            result = result && nmod_poly_equal(s, t);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, num = %wd, j = %wd\n", n, num, j - 1);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            nmod_poly_print(f), flint_printf("\n\n");
+            nmod_poly_print(r), flint_printf("\n\n");
+            nmod_poly_print(s), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(F);
+        nmod_poly_batch_clear(R);
+        nmod_poly_batch_clear(S);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(f);
+        nmod_poly_clear(r);
+        nmod_poly_clear(s);
+        nmod_poly_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
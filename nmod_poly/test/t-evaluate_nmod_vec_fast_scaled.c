@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2010 William Hart
+    Copyright (C) 2011, 2012 Fredrik Johansson
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_nmod_vec_fast_scaled....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t P;
+        mp_ptr x, y, z, rinv;
+        mp_ptr * tree;
+        mp_limb_t mod;
+        slong j, n, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = n_randint(state, 100);
+        n = n_randint(state, 100);
+        if (i % 20 == 0)
+        {
+            npoints = 1000 + n_randint(state, 1000);
+            n = n_randint(state, 3000);
+        }
+
+        nmod_poly_init(P, mod);
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+        z = _nmod_vec_init(npoints);
+        rinv = _nmod_vec_init(npoints);
+
+        nmod_poly_randtest(P, state, n);
+
+        for (j = 0; j < npoints; j++)
+            x[j] = n_randint(state, mod);
+
+        nmod_poly_evaluate_nmod_vec_iter(y, P, x, npoints);
+        tree = _nmod_poly_tree_alloc(npoints);
+        _nmod_poly_tree_build(tree, x, npoints, P->mod);
+        _nmod_poly_tree_inv_root(rinv, tree, npoints, P->mod);
+        _nmod_poly_evaluate_nmod_vec_fast_scaled_precomp(z, P->coeffs,
+                                   P->length, tree, rinv, npoints, P->mod);
+        _nmod_poly_tree_free(tree, npoints);
+
+        result = _nmod_vec_equal(y, z, npoints);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mod=%wu, n=%wd, npoints=%wd\n\n", mod, n, npoints);
+            flint_printf("P: "); nmod_poly_print(P); flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(P);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+        _nmod_vec_clear(rinv);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
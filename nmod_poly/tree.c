@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -44,11 +45,66 @@ void _nmod_poly_tree_free(mp_ptr * tree, slong len)
     }
 }
 
+/* computes tree[i + 1] from tree[i] for the pairs of blocks b0, ..., b1 - 1 */
+static void
+_nmod_poly_tree_build_level(mp_ptr * tree, slong len, slong i,
+                                        slong b0, slong b1, nmod_t mod)
+{
+    slong pow, left;
+    mp_ptr pa, pb;
+
+    pow = WORD(1) << i;
+    left = len - b0 * 2 * pow;
+    pa = tree[i] + b0 * (2 * pow + 2);
+    pb = tree[i + 1] + b0 * (2 * pow + 1);
+
+    for ( ; b0 < b1 && left >= 2 * pow; b0++)
+    {
+        _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, mod);
+        left -= 2 * pow;
+        pa += 2 * pow + 2;
+        pb += 2 * pow + 1;
+    }
+
+    if (b0 < b1)
+    {
+        if (left > pow)
+            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, mod);
+        else if (left > 0)
+            _nmod_vec_set(pb, pa, left + 1);
+    }
+}
+
+typedef struct
+{
+    mp_ptr * tree;
+    slong len;
+    slong i;
+    slong b0;
+    slong b1;
+    nmod_t mod;
+}
+tree_build_arg_t;
+
+void *
+_nmod_poly_tree_build_worker(void * arg_ptr)
+{
+    tree_build_arg_t arg = *((tree_build_arg_t *) arg_ptr);
+
+    _nmod_poly_tree_build_level(arg.tree, arg.len, arg.i,
+                                arg.b0, arg.b1, arg.mod);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
 {
-    slong height, pow, left, i;
-    mp_ptr pa, pb;
+    slong height, pairs, i, j, num_threads;
+    mp_ptr pa;
+    pthread_t * threads;
+    tree_build_arg_t * args;
 
     if (len == 0)
         return;
@@ -86,24 +142,73 @@ _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
         }
     }
 
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                            1 : flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(tree_build_arg_t) * num_threads);
+
+    /* the products at each level are independent, so the pairs of blocks
+       are split between the threads */
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
-        pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        slong nt;
 
-        while (left >= 2 * pow)
+        pairs = ((len - 1) >> (i + 1)) + 1;
+        nt = FLINT_MIN(num_threads, pairs);
+
+        if (nt <= 1)
         {
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, mod);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
+            _nmod_poly_tree_build_level(tree, len, i, 0, pairs, mod);
+            continue;
         }
 
-        if (left > pow)
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, mod);
-        else if (left > 0)
-            _nmod_vec_set(pb, pa, left + 1);
+        for (j = 0; j < nt; j++)
+        {
+            args[j].tree = tree;
+            args[j].len = len;
+            args[j].i = i;
+            args[j].b0 = (pairs * j) / nt;
+            args[j].b1 = (pairs * (j + 1)) / nt;
+            args[j].mod = mod;
+
+            pthread_create(&threads[j], NULL,
+                           _nmod_poly_tree_build_worker, &args[j]);
+        }
+
+        for (j = 0; j < nt; j++)
+            pthread_join(threads[j], NULL);
     }
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+_nmod_poly_tree_inv_root(mp_ptr rinv, const mp_ptr * tree, slong len,
+                                                                   nmod_t mod)
+{
+    slong height, n;
+    mp_ptr P;
+
+    if (len == 0)
+        return;
+
+    if (len == 1)
+    {
+        rinv[0] = 1;
+        return;
+    }
+
+    height = FLINT_CLOG2(len);
+    n = WORD(1) << (height - 1);
+
+    /* the top level product is not stored in the tree */
+    P = _nmod_vec_init(len + 1);
+    _nmod_poly_mul(P, tree[height - 1], n + 1,
+                      tree[height - 1] + (n + 1), len - n + 1, mod);
+
+    _nmod_poly_reverse(P, P, len + 1, len + 1);
+    _nmod_poly_inv_series(rinv, P, len + 1, len, mod);
+
+    _nmod_vec_clear(P);
 }
@@ -136,6 +136,10 @@ FLINT_DLL void nmod_poly_mat_print(const nmod_poly_mat_t mat, const char * x);
 
 FLINT_DLL slong nmod_poly_mat_max_length(const nmod_poly_mat_t A);
 
+/* Truncation ****************************************************************/
+
+FLINT_DLL void nmod_poly_mat_truncate(nmod_poly_mat_t A, slong len);
+
 /* Scalar arithmetic *********************************************************/
 
 FLINT_DLL void nmod_poly_mat_scalar_mul_nmod_poly(nmod_poly_mat_t B,
@@ -166,6 +170,9 @@ FLINT_DLL void nmod_poly_mat_mul_classical(nmod_poly_mat_t C, const nmod_poly_ma
 FLINT_DLL void nmod_poly_mat_mul_KS(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     const nmod_poly_mat_t B);
 
+FLINT_DLL void nmod_poly_mat_mullow(nmod_poly_mat_t C, const nmod_poly_mat_t A,
+    const nmod_poly_mat_t B, slong len);
+
 FLINT_DLL void nmod_poly_mat_sqr(nmod_poly_mat_t B, const nmod_poly_mat_t A);
 
 FLINT_DLL void nmod_poly_mat_sqr_classical(nmod_poly_mat_t B, const nmod_poly_mat_t A);
@@ -206,6 +213,8 @@ FLINT_DLL void nmod_poly_mat_det_fflu(nmod_poly_t det, const nmod_poly_mat_t A);
 
 FLINT_DLL void nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A);
 
+FLINT_DLL void nmod_poly_mat_det_dixon(nmod_poly_t det, const nmod_poly_mat_t A);
+
 FLINT_DLL slong nmod_poly_mat_rank(const nmod_poly_mat_t A);
 
 /* Inverse *******************************************************************/
@@ -229,6 +238,9 @@ FLINT_DLL void nmod_poly_mat_solve_fflu_precomp(nmod_poly_mat_t X,
                     const slong * perm,
                     const nmod_poly_mat_t FFLU, const nmod_poly_mat_t B);
 
+FLINT_DLL int nmod_poly_mat_solve_dixon(nmod_poly_mat_t X, nmod_poly_t den,
+                    const nmod_poly_mat_t A, const nmod_poly_mat_t B);
+
 #ifdef __cplusplus
 }
 #endif
@@ -37,12 +37,12 @@ nmod_poly_mat_det(nmod_poly_t det, const nmod_poly_mat_t A)
         nmod_poly_sub(det, det, tmp);
         nmod_poly_clear(tmp);
     }
-    else if (n < 15)  /* should be entry sensitive too */
+    else if (n < 8)  /* should be entry sensitive too */
     {
         nmod_poly_mat_det_fflu(det, A);
     }
     else
     {
-        nmod_poly_mat_det_interpolate(det, A);
+        nmod_poly_mat_det_dixon(det, A);
     }
 }
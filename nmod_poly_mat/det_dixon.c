@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+void
+nmod_poly_mat_det_dixon(nmod_poly_t det, const nmod_poly_mat_t A)
+{
+    nmod_poly_mat_t b, x;
+    nmod_poly_t d, c;
+    nmod_mat_t X;
+    flint_rand_t state;
+    mp_limb_t mod, pt, dv;
+    mp_ptr xs, ys;
+    slong i, j, n, len, D, Dr, Dc, e;
+
+    n = A->r;
+    mod = nmod_poly_mat_modulus(A);
+
+    if (n == 0)
+    {
+        nmod_poly_one(det);
+        return;
+    }
+
+    /* degree bound for det(A) from the row and column degrees */
+    Dr = Dc = 0;
+    for (i = 0; i < n; i++)
+    {
+        slong rd = -1, cd = -1;
+
+        for (j = 0; j < n; j++)
+        {
+            rd = FLINT_MAX(rd, nmod_poly_mat_entry(A, i, j)->length - 1);
+            cd = FLINT_MAX(cd, nmod_poly_mat_entry(A, j, i)->length - 1);
+        }
+
+        if (rd < 0 || cd < 0)
+        {
+            nmod_poly_zero(det);
+            return;
+        }
+
+        Dr += rd;
+        Dc += cd;
+    }
+
+    D = FLINT_MIN(Dr, Dc);
+
+    /* Not enough points to interpolate the cofactor */
+    if ((ulong) D >= mod)
+    {
+        nmod_poly_mat_det_fflu(det, A);
+        return;
+    }
+
+    nmod_poly_mat_init(b, n, 1, mod);
+    nmod_poly_mat_init(x, n, 1, mod);
+    nmod_poly_init(d, mod);
+
+    /*
+        For random b, the denominator d of A^{-1} b is the largest invariant
+        factor of A with high probability. It always divides det(A).
+    */
+    flint_randinit(state);
+    for (i = 0; i < n; i++)
+        nmod_poly_set_coeff_ui(nmod_poly_mat_entry(b, i, 0), 0,
+                               1 + n_randint(state, mod - 1));
+    flint_randclear(state);
+
+    if (!nmod_poly_mat_solve_dixon(x, d, A, b))
+    {
+        nmod_poly_zero(det);
+    }
+    else
+    {
+        /* the cofactor det(A) / d has degree at most e */
+        e = D - nmod_poly_degree(d);
+        len = e + 1;
+
+        xs = _nmod_vec_init(len);
+        ys = _nmod_vec_init(len);
+        nmod_mat_init(X, n, n, mod);
+        nmod_poly_init(c, mod);
+
+        for (i = 0, pt = 0; i < len; pt++)
+        {
+            dv = nmod_poly_evaluate_nmod(d, pt);
+
+            if (dv == 0)
+                continue;
+
+            nmod_poly_mat_evaluate_nmod(X, A, pt);
+            xs[i] = pt;
+            ys[i] = n_mulmod2_preinv(nmod_mat_det(X), n_invmod(dv, mod),
+                                     mod, d->mod.ninv);
+            i++;
+        }
+
+        nmod_poly_interpolate_nmod_vec(c, xs, ys, len);
+        nmod_poly_mul(det, d, c);
+
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+        nmod_mat_clear(X);
+        nmod_poly_clear(c);
+    }
+
+    nmod_poly_mat_clear(b);
+    nmod_poly_mat_clear(x);
+    nmod_poly_clear(d);
+}
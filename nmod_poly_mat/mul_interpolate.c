@@ -9,24 +9,156 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "flint.h"
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
+typedef struct
+{
+    const nmod_poly_mat_struct * P;
+    nmod_mat_struct * P_mod;
+    nmod_mat_struct * A_mod;
+    nmod_mat_struct * B_mod;
+    mp_ptr * tree;
+    mp_srcptr weights;
+    slong len;
+    slong i0;
+    slong i1;
+    nmod_t mod;
+}
+mul_interpolate_arg_t;
+
+/* evaluates the entries i0, ..., i1 - 1 of P (in row major order) */
+void *
+_nmod_poly_mat_mul_interpolate_evaluate_worker(void * arg_ptr)
+{
+    mul_interpolate_arg_t arg = *((mul_interpolate_arg_t *) arg_ptr);
+    slong i, j, k, e;
+    mp_ptr tt;
+
+    tt = _nmod_vec_init(arg.len);
+
+    for (e = arg.i0; e < arg.i1; e++)
+    {
+        i = e / arg.P->c;
+        j = e % arg.P->c;
+
+        _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
+            nmod_poly_mat_entry(arg.P, i, j)->coeffs,
+            nmod_poly_mat_entry(arg.P, i, j)->length,
+            arg.tree, arg.len, arg.mod);
+
+        for (k = 0; k < arg.len; k++)
+            arg.P_mod[k].rows[i][j] = tt[k];
+    }
+
+    _nmod_vec_clear(tt);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* the pointwise products at the points i0, ..., i1 - 1 */
+void *
+_nmod_poly_mat_mul_interpolate_pointwise_worker(void * arg_ptr)
+{
+    mul_interpolate_arg_t arg = *((mul_interpolate_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.i0; k < arg.i1; k++)
+        nmod_mat_mul(arg.P_mod + k, arg.A_mod + k, arg.B_mod + k);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* interpolates the entries i0, ..., i1 - 1 of P (in row major order) */
+void *
+_nmod_poly_mat_mul_interpolate_interpolate_worker(void * arg_ptr)
+{
+    mul_interpolate_arg_t arg = *((mul_interpolate_arg_t *) arg_ptr);
+    slong i, j, k, e;
+    mp_ptr tt;
+
+    tt = _nmod_vec_init(arg.len);
+
+    for (e = arg.i0; e < arg.i1; e++)
+    {
+        nmod_poly_struct * poly;
+
+        i = e / arg.P->c;
+        j = e % arg.P->c;
+
+        for (k = 0; k < arg.len; k++)
+            tt[k] = arg.P_mod[k].rows[i][j];
+
+        poly = nmod_poly_mat_entry(arg.P, i, j);
+        nmod_poly_fit_length(poly, arg.len);
+        _nmod_poly_interpolate_nmod_vec_fast_precomp(poly->coeffs,
+            tt, arg.tree, arg.weights, arg.len, arg.mod);
+        poly->length = arg.len;
+        _nmod_poly_normalise(poly);
+    }
+
+    _nmod_vec_clear(tt);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* runs the worker on num items split between the threads */
+static void
+_nmod_poly_mat_mul_interpolate_run(void * (* worker)(void *),
+                      mul_interpolate_arg_t * arg, slong num, slong threads)
+{
+    pthread_t * thr;
+    mul_interpolate_arg_t * args;
+    slong i, nt;
+
+    nt = FLINT_MIN(threads, num);
+
+    if (nt <= 1)
+    {
+        arg->i0 = 0;
+        arg->i1 = num;
+        worker(arg);
+        return;
+    }
+
+    thr = flint_malloc(sizeof(pthread_t) * nt);
+    args = flint_malloc(sizeof(mul_interpolate_arg_t) * nt);
+
+    for (i = 0; i < nt; i++)
+    {
+        args[i] = *arg;
+        args[i].i0 = (num * i) / nt;
+        args[i].i1 = (num * (i + 1)) / nt;
+
+        pthread_create(&thr[i], NULL, worker, &args[i]);
+    }
+
+    for (i = 0; i < nt; i++)
+        pthread_join(thr[i], NULL);
+
+    flint_free(thr);
+    flint_free(args);
+}
+
 void
 nmod_poly_mat_mul_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     const nmod_poly_mat_t B)
 {
-    slong i, j, k;
+    slong i, num_threads;
     slong A_len, B_len, len;
 
-    nmod_mat_t *C_mod, *A_mod, *B_mod;
+    nmod_mat_struct *C_mod, *A_mod, *B_mod;
 
     mp_ptr xs;
-    mp_ptr tt, uu;
     mp_ptr * tree;
     mp_ptr weights;
     nmod_t mod;
+    mul_interpolate_arg_t arg;
 
     if (B->r == 0)
     {
@@ -54,82 +186,67 @@ nmod_poly_mat_mul_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     }
 
     xs = _nmod_vec_init(len);
-    tt = _nmod_vec_init(len);
-    uu = _nmod_vec_init(len);
     weights = _nmod_vec_init(len);
 
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    B_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    C_mod = flint_malloc(sizeof(nmod_mat_t) * len);
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * len);
+    B_mod = flint_malloc(sizeof(nmod_mat_struct) * len);
+    C_mod = flint_malloc(sizeof(nmod_mat_struct) * len);
 
     for (i = 0; i < len; i++)
     {
         xs[i] = i;
-        nmod_mat_init(A_mod[i], A->r, A->c, mod.n);
-        nmod_mat_init(B_mod[i], B->r, B->c, mod.n);
-        nmod_mat_init(C_mod[i], C->r, C->c, mod.n);
+        nmod_mat_init(A_mod + i, A->r, A->c, mod.n);
+        nmod_mat_init(B_mod + i, B->r, B->c, mod.n);
+        nmod_mat_init(C_mod + i, C->r, C->c, mod.n);
     }
 
     tree = _nmod_poly_tree_alloc(len);
     _nmod_poly_tree_build(tree, xs, len, mod);
     _nmod_poly_interpolation_weights(weights, tree, len, mod);
 
-    for (i = 0; i < A->r; i++)
-    {
-        for (j = 0; j < A->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(A, i, j)->coeffs, 
-                nmod_poly_mat_entry(A, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                A_mod[k]->rows[i][j] = tt[k];
-        }
-    }
+    num_threads = flint_get_num_threads();
 
-    for (i = 0; i < B->r; i++)
-    {
-        for (j = 0; j < B->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(B, i, j)->coeffs, 
-                nmod_poly_mat_entry(B, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                B_mod[k]->rows[i][j] = tt[k];
-        }
-    }
+    arg.A_mod = A_mod;
+    arg.B_mod = B_mod;
+    arg.tree = tree;
+    arg.weights = weights;
+    arg.len = len;
+    arg.mod = mod;
 
-    for (i = 0; i < len; i++)
-        nmod_mat_mul(C_mod[i], A_mod[i], B_mod[i]);
+    /*
+        Each entry is transformed once, then the len pointwise products
+        are independent; the entries and the points are split between
+        the threads.
+    */
+    arg.P = A;
+    arg.P_mod = A_mod;
+    _nmod_poly_mat_mul_interpolate_run(
+        _nmod_poly_mat_mul_interpolate_evaluate_worker,
+        &arg, A->r * A->c, num_threads);
 
-    for (i = 0; i < C->r; i++)
-    {
-        for (j = 0; j < C->c; j++)
-        {
-            nmod_poly_struct * poly;
-
-            for (k = 0; k < len; k++)
-                tt[k] = C_mod[k]->rows[i][j];
-
-            poly = nmod_poly_mat_entry(C, i, j);
-            nmod_poly_fit_length(poly, len);
-            _nmod_poly_interpolate_nmod_vec_fast_precomp(poly->coeffs,
-                tt, tree, weights, len, mod);
-            poly->length = len;
-            _nmod_poly_normalise(poly);
-        }
-    }
+    arg.P = B;
+    arg.P_mod = B_mod;
+    _nmod_poly_mat_mul_interpolate_run(
+        _nmod_poly_mat_mul_interpolate_evaluate_worker,
+        &arg, B->r * B->c, num_threads);
+
+    arg.P_mod = C_mod;
+    _nmod_poly_mat_mul_interpolate_run(
+        _nmod_poly_mat_mul_interpolate_pointwise_worker,
+        &arg, len, num_threads);
+
+    arg.P = C;
+    _nmod_poly_mat_mul_interpolate_run(
+        _nmod_poly_mat_mul_interpolate_interpolate_worker,
+        &arg, C->r * C->c, num_threads);
 
     _nmod_poly_tree_free(tree, len);
 
     for (i = 0; i < len; i++)
     {
-        nmod_mat_clear(A_mod[i]);
-        nmod_mat_clear(B_mod[i]);
-        nmod_mat_clear(C_mod[i]);
+        nmod_mat_clear(A_mod + i);
+        nmod_mat_clear(B_mod + i);
+        nmod_mat_clear(C_mod + i);
     }
 
     flint_free(A_mod);
@@ -137,7 +254,5 @@ nmod_poly_mat_mul_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     flint_free(C_mod);
 
     _nmod_vec_clear(xs);
-    _nmod_vec_clear(tt);
-    _nmod_vec_clear(uu);
     _nmod_vec_clear(weights);
 }
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+#define MULLOW_CLASSICAL_MAX_DIM 10
+
+void
+nmod_poly_mat_mullow(nmod_poly_mat_t C, const nmod_poly_mat_t A,
+    const nmod_poly_mat_t B, slong len)
+{
+    slong ar, bc, br, dim;
+    slong i, j, k;
+
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0 || len < 1)
+    {
+        nmod_poly_mat_zero(C);
+        return;
+    }
+
+    if (C == A || C == B)
+    {
+        nmod_poly_mat_t T;
+        nmod_poly_mat_init(T, ar, bc, nmod_poly_mat_modulus(A));
+        nmod_poly_mat_mullow(T, A, B, len);
+        nmod_poly_mat_swap(C, T);
+        nmod_poly_mat_clear(T);
+        return;
+    }
+
+    dim = FLINT_MIN(FLINT_MIN(ar, br), bc);
+
+    if (dim < MULLOW_CLASSICAL_MAX_DIM)
+    {
+        nmod_poly_t t;
+
+        nmod_poly_init(t, nmod_poly_mat_modulus(A));
+
+        for (i = 0; i < ar; i++)
+        {
+            for (j = 0; j < bc; j++)
+            {
+                nmod_poly_mullow(nmod_poly_mat_entry(C, i, j),
+                                 nmod_poly_mat_entry(A, i, 0),
+                                 nmod_poly_mat_entry(B, 0, j), len);
+
+                for (k = 1; k < br; k++)
+                {
+                    nmod_poly_mullow(t, nmod_poly_mat_entry(A, i, k),
+                                        nmod_poly_mat_entry(B, k, j), len);
+
+                    nmod_poly_add(nmod_poly_mat_entry(C, i, j),
+                                  nmod_poly_mat_entry(C, i, j), t);
+                }
+            }
+        }
+
+        nmod_poly_clear(t);
+    }
+    else
+    {
+        /* the full product of the truncated inputs, then truncate */
+        nmod_poly_mat_t TA, TB;
+        int trunc_A, trunc_B;
+
+        trunc_A = (nmod_poly_mat_max_length(A) > len);
+        trunc_B = (nmod_poly_mat_max_length(B) > len);
+
+        if (trunc_A)
+        {
+            nmod_poly_mat_init_set(TA, A);
+            nmod_poly_mat_truncate(TA, len);
+        }
+
+        if (trunc_B)
+        {
+            nmod_poly_mat_init_set(TB, B);
+            nmod_poly_mat_truncate(TB, len);
+        }
+
+        nmod_poly_mat_mul(C, trunc_A ? TA : A, trunc_B ? TB : B);
+        nmod_poly_mat_truncate(C, len);
+
+        if (trunc_A)
+            nmod_poly_mat_clear(TA);
+        if (trunc_B)
+            nmod_poly_mat_clear(TB);
+    }
+}
@@ -18,5 +18,8 @@ int
 nmod_poly_mat_solve(nmod_poly_mat_t X, nmod_poly_t den,
                     const nmod_poly_mat_t A, const nmod_poly_mat_t B)
 {
-    return nmod_poly_mat_solve_fflu(X, den, A, B);
+    if (nmod_poly_mat_nrows(A) < 8)
+        return nmod_poly_mat_solve_fflu(X, den, A, B);
+    else
+        return nmod_poly_mat_solve_dixon(X, den, A, B);
 }
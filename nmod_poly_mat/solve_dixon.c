@@ -0,0 +1,383 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+static void
+_nmod_poly_mat_taylor_shift(nmod_poly_mat_t B, const nmod_poly_mat_t A,
+                                                                 mp_limb_t c)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            nmod_poly_taylor_shift(nmod_poly_mat_entry(B, i, j),
+                                   nmod_poly_mat_entry(A, i, j), c);
+}
+
+/*
+    Finds q with q(0) != 0 and deg(q) <= den_deg such that q t mod x^N
+    has degree at most num_deg, where num_deg + den_deg < N. This is the
+    first remainder of degree at most num_deg in the Euclidean algorithm
+    applied to x^N and t, together with its cofactor.
+*/
+static int
+_nmod_poly_series_reconstruct(nmod_poly_t q, const nmod_poly_t t,
+                                            slong N, slong num_deg, slong den_deg)
+{
+    nmod_poly_t r0, r1, t0, t1, quo, rem;
+    int success;
+
+    if (nmod_poly_degree(t) <= num_deg)
+    {
+        nmod_poly_one(q);
+        return 1;
+    }
+
+    nmod_poly_init_preinv(r0, t->mod.n, t->mod.ninv);
+    nmod_poly_init_preinv(r1, t->mod.n, t->mod.ninv);
+    nmod_poly_init_preinv(t0, t->mod.n, t->mod.ninv);
+    nmod_poly_init_preinv(t1, t->mod.n, t->mod.ninv);
+    nmod_poly_init_preinv(quo, t->mod.n, t->mod.ninv);
+    nmod_poly_init_preinv(rem, t->mod.n, t->mod.ninv);
+
+    nmod_poly_set_coeff_ui(r0, N, 1);
+    nmod_poly_set(r1, t);
+    nmod_poly_one(t1);
+
+    while (nmod_poly_degree(r1) > num_deg)
+    {
+        nmod_poly_divrem(quo, rem, r0, r1);
+        nmod_poly_swap(r0, r1);
+        nmod_poly_swap(r1, rem);
+
+        nmod_poly_mul(quo, quo, t1);
+        nmod_poly_sub(t0, t0, quo);
+        nmod_poly_swap(t0, t1);
+    }
+
+    success = (nmod_poly_degree(t1) <= den_deg) && (t1->coeffs[0] != 0);
+
+    if (success)
+        nmod_poly_swap(q, t1);
+
+    nmod_poly_clear(r0);
+    nmod_poly_clear(r1);
+    nmod_poly_clear(t0);
+    nmod_poly_clear(t1);
+    nmod_poly_clear(quo);
+    nmod_poly_clear(rem);
+
+    return success;
+}
+
+/*
+    Returns 0 if some row or column of A is zero, and otherwise sets
+    den_deg to the smaller of the row and column degree bounds for det(A)
+    and num_deg to a bound for the degrees of the entries of adj(A) B.
+*/
+static int
+_nmod_poly_mat_cramer_bounds(slong * den_deg, slong * num_deg,
+                             const nmod_poly_mat_t A, const nmod_poly_mat_t B)
+{
+    slong i, j, n, len, Blen, cmin, Dr, Dc, Nr, Nc;
+    slong * rd, * cd;
+    int result = 1;
+
+    n = A->r;
+    rd = flint_malloc(2 * n * sizeof(slong));
+    cd = rd + n;
+
+    for (i = 0; i < 2 * n; i++)
+        rd[i] = -1;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            len = nmod_poly_mat_entry(A, i, j)->length;
+            rd[i] = FLINT_MAX(rd[i], len - 1);
+            cd[j] = FLINT_MAX(cd[j], len - 1);
+        }
+    }
+
+    Blen = nmod_poly_mat_max_length(B);
+
+    Dr = Dc = Nr = 0;
+    cmin = WORD_MAX;
+
+    for (i = 0; i < n; i++)
+    {
+        if (rd[i] < 0 || cd[i] < 0)
+        {
+            result = 0;
+            break;
+        }
+
+        Dr += rd[i];
+        Dc += cd[i];
+        Nr += FLINT_MAX(rd[i], Blen - 1);
+        cmin = FLINT_MIN(cmin, cd[i]);
+    }
+
+    if (result)
+    {
+        Nc = Dc - cmin + FLINT_MAX(Blen - 1, 0);
+        *den_deg = FLINT_MIN(Dr, Dc);
+        *num_deg = FLINT_MIN(Nr, Nc);
+    }
+
+    flint_free(rd);
+
+    return result;
+}
+
+static void
+_nmod_poly_mat_get_coeff_mat(nmod_mat_t C, const nmod_poly_mat_t A, slong k)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            nmod_mat_entry(C, i, j) = nmod_poly_get_coeff_ui(
+                                        nmod_poly_mat_entry(A, i, j), k);
+}
+
+/*
+    Sets S to the x-adic expansion of A^{-1} B to precision N, given the
+    inverse of the constant term of A. Writing A = A_0 + ... + A_d x^d,
+    step t solves for the coefficient y_t = A_0^{-1} r_t and subtracts
+    A_l y_t from the residues r_{t+l}; only the d + 1 pending residues
+    are kept, in a ring buffer. All the work is in nmod_mat products.
+*/
+static void
+_nmod_poly_mat_solve_series(nmod_poly_mat_t S, const nmod_poly_mat_t A,
+                            const nmod_mat_t A0inv, const nmod_poly_mat_t B,
+                            slong N)
+{
+    nmod_mat_struct * Ac, * R;
+    nmod_mat_t y;
+    mp_limb_t mod = nmod_poly_mat_modulus(A);
+    slong i, j, l, n, m, d, t;
+
+    n = A->r;
+    m = B->c;
+    d = FLINT_MAX(nmod_poly_mat_max_length(A) - 1, 0);
+
+    Ac = flint_malloc((2 * d + 1) * sizeof(nmod_mat_struct));
+    R = Ac + d;
+
+    for (l = 0; l < d; l++)
+    {
+        nmod_mat_init(Ac + l, n, n, mod);
+        _nmod_poly_mat_get_coeff_mat(Ac + l, A, l + 1);
+    }
+
+    for (l = 0; l <= d; l++)
+    {
+        nmod_mat_init(R + l, n, m, mod);
+        _nmod_poly_mat_get_coeff_mat(R + l, B, l);
+    }
+
+    nmod_mat_init(y, n, m, mod);
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < m; j++)
+            nmod_poly_fit_length(nmod_poly_mat_entry(S, i, j), N);
+
+    for (t = 0; t < N; t++)
+    {
+        nmod_mat_struct * r = R + (t % (d + 1));
+
+        nmod_mat_mul(y, A0inv, r);
+
+        for (i = 0; i < n; i++)
+            for (j = 0; j < m; j++)
+                nmod_poly_mat_entry(S, i, j)->coeffs[t]
+                    = nmod_mat_entry(y, i, j);
+
+        /* the slot of r_t is reused for r_{t + d + 1} */
+        _nmod_poly_mat_get_coeff_mat(r, B, t + d + 1);
+
+        for (l = 1; l <= d; l++)
+        {
+            r = R + ((t + l) % (d + 1));
+            nmod_mat_submul(r, r, Ac + l - 1, y);
+        }
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            nmod_poly_struct * s = nmod_poly_mat_entry(S, i, j);
+            s->length = N;
+            _nmod_poly_normalise(s);
+        }
+    }
+
+    for (l = 0; l < d; l++)
+        nmod_mat_clear(Ac + l);
+    for (l = 0; l <= d; l++)
+        nmod_mat_clear(R + l);
+    flint_free(Ac);
+    nmod_mat_clear(y);
+}
+
+int
+nmod_poly_mat_solve_dixon(nmod_poly_mat_t X, nmod_poly_t den,
+                    const nmod_poly_mat_t A, const nmod_poly_mat_t B)
+{
+    nmod_poly_mat_t As, Bs, S;
+    nmod_mat_t A0;
+    nmod_poly_t q, t;
+    mp_limb_t a, mod;
+    slong i, j, n, m, D, Nn, N, tries;
+    flint_rand_t state;
+    int found;
+
+    if (nmod_poly_mat_is_empty(B))
+    {
+        nmod_poly_one(den);
+        return 1;
+    }
+
+    n = A->r;
+    m = B->c;
+    mod = nmod_poly_mat_modulus(A);
+
+    if (!_nmod_poly_mat_cramer_bounds(&D, &Nn, A, B))
+    {
+        nmod_poly_zero(den);
+        return 0;
+    }
+
+    /* find a point at which A is invertible, trying x = 0 first */
+    nmod_mat_init(A0, n, n, mod);
+    flint_randinit(state);
+
+    found = 0;
+    a = 0;
+    for (tries = 0; tries < 4 && (ulong) tries < mod; tries++)
+    {
+        if (tries != 0)
+            a = n_randint(state, mod);
+
+        nmod_poly_mat_evaluate_nmod(A0, A, a);
+
+        if (nmod_mat_inv(A0, A0))
+        {
+            found = 1;
+            break;
+        }
+    }
+
+    flint_randclear(state);
+
+    if (!found)
+    {
+        nmod_mat_clear(A0);
+
+        if (X == B)
+        {
+            /* solve_fflu does not support aliasing */
+            int result;
+            nmod_poly_mat_init(S, n, m, mod);
+            result = nmod_poly_mat_solve_fflu(S, den, A, B);
+            nmod_poly_mat_swap(X, S);
+            nmod_poly_mat_clear(S);
+            return result;
+        }
+
+        return nmod_poly_mat_solve_fflu(X, den, A, B);
+    }
+
+    /* A is nonsingular, since A(a) is */
+    if (nmod_poly_mat_is_zero(B))
+    {
+        nmod_mat_clear(A0);
+        nmod_poly_mat_zero(X);
+        nmod_poly_one(den);
+        return 1;
+    }
+
+    nmod_poly_mat_init(As, n, n, mod);
+    nmod_poly_mat_init(Bs, n, m, mod);
+    nmod_poly_mat_init(S, n, m, mod);
+
+    if (a != 0)
+    {
+        _nmod_poly_mat_taylor_shift(As, A, a);
+        _nmod_poly_mat_taylor_shift(Bs, B, a);
+    }
+    else
+    {
+        nmod_poly_mat_set(As, A);
+        nmod_poly_mat_set(Bs, B);
+    }
+
+    N = D + Nn + 1;
+    _nmod_poly_mat_solve_series(S, As, A0, Bs, N);
+
+    /*
+        The denominator of each entry of A^{-1} B divides det(A), so the
+        denominator q of den S_ij has degree at most D - deg(den), while
+        the numerator has degree at most Nn + deg(den).
+    */
+    nmod_poly_init(q, mod);
+    nmod_poly_init(t, mod);
+    nmod_poly_one(den);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            slong dd = nmod_poly_degree(den);
+
+            nmod_poly_mullow(t, den, nmod_poly_mat_entry(S, i, j), N);
+
+            if (!_nmod_poly_series_reconstruct(q, t, N, Nn + dd, D - dd))
+            {
+                flint_printf("Exception (nmod_poly_mat_solve_dixon). "
+                             "Rational reconstruction failed.\n");
+                flint_abort();
+            }
+
+            nmod_poly_mul(den, den, q);
+        }
+    }
+
+    nmod_poly_make_monic(den, den);
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < m; j++)
+            nmod_poly_mullow(nmod_poly_mat_entry(X, i, j), den,
+                             nmod_poly_mat_entry(S, i, j), N);
+
+    if (a != 0)
+    {
+        _nmod_poly_mat_taylor_shift(X, X, nmod_neg(a, den->mod));
+        nmod_poly_taylor_shift(den, den, nmod_neg(a, den->mod));
+    }
+
+    nmod_poly_clear(q);
+    nmod_poly_clear(t);
+    nmod_poly_mat_clear(As);
+    nmod_poly_mat_clear(Bs);
+    nmod_poly_mat_clear(S);
+    nmod_mat_clear(A0);
+
+    return 1;
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("det_dixon....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A;
+        nmod_poly_t a, b;
+        slong n, deg;
+        mp_limb_t mod;
+
+        mod = n_randtest_prime(state, 0);
+        n = n_randint(state, 12);
+        deg = 1 + n_randint(state, 6);
+
+        nmod_poly_mat_init(A, n, n, mod);
+
+        nmod_poly_init(a, mod);
+        nmod_poly_init(b, mod);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                nmod_poly_mat_randtest(A, state, deg);
+                break;
+            case 1:
+                nmod_poly_mat_randtest_sparse(A, state, deg,
+                                              n_randint(state, 100) * 0.01);
+                break;
+            default:
+            {
+                /* products tend to have nontrivial invariant factors */
+                nmod_poly_mat_t C;
+                nmod_poly_mat_init(C, n, n, mod);
+                nmod_poly_mat_randtest(A, state, 1 + n_randint(state, 3));
+                nmod_poly_mat_randtest(C, state, 1 + n_randint(state, 3));
+                nmod_poly_mat_mul(A, A, C);
+                nmod_poly_mat_mul(A, A, C);
+                nmod_poly_mat_clear(C);
+            }
+        }
+
+        nmod_poly_mat_det_fflu(a, A);
+        nmod_poly_mat_det_dixon(b, A);
+
+        if (!nmod_poly_equal(a, b))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("determinants don't agree!\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("det_fflu(A):\n");
+            nmod_poly_print(a);
+            flint_printf("\ndet_dixon(A):\n");
+            nmod_poly_print(b);
+            flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+
+        nmod_poly_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
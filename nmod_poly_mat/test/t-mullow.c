@@ -0,0 +1,168 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mullow....");
+    fflush(stdout);
+
+    /* Compare with mul */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, B, C, D;
+        mp_limb_t mod;
+        slong m, n, k, deg, len;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        mod = n_randtest_prime(state, 0);
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        k = n_randint(state, 20);
+        deg = 1 + n_randint(state, 30);
+        len = n_randint(state, 40);
+
+        nmod_poly_mat_init(A, m, n, mod);
+        nmod_poly_mat_init(B, n, k, mod);
+        nmod_poly_mat_init(C, m, k, mod);
+        nmod_poly_mat_init(D, m, k, mod);
+
+        nmod_poly_mat_randtest(A, state, deg);
+        nmod_poly_mat_randtest(B, state, deg);
+        nmod_poly_mat_randtest(C, state, deg);  /* noise in output */
+
+        nmod_poly_mat_mullow(C, A, B, len);
+        nmod_poly_mat_mul_classical(D, A, B);
+        nmod_poly_mat_truncate(D, len);
+
+        if (!nmod_poly_mat_equal(C, D))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("B:\n");
+            nmod_poly_mat_print(B, "x");
+            flint_printf("C:\n");
+            nmod_poly_mat_print(C, "x");
+            flint_printf("D:\n");
+            nmod_poly_mat_print(D, "x");
+            flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(C);
+        nmod_poly_mat_clear(D);
+    }
+
+    /* Check aliasing C and A */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, B, C;
+        mp_limb_t mod;
+        slong m, n, deg, len;
+
+        mod = n_randtest_prime(state, 0);
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        deg = 1 + n_randint(state, 10);
+        len = n_randint(state, 20);
+
+        nmod_poly_mat_init(A, m, n, mod);
+        nmod_poly_mat_init(B, n, n, mod);
+        nmod_poly_mat_init(C, m, n, mod);
+
+        nmod_poly_mat_randtest(A, state, deg);
+        nmod_poly_mat_randtest(B, state, deg);
+        nmod_poly_mat_randtest(C, state, deg);  /* noise in output */
+
+        nmod_poly_mat_mullow(C, A, B, len);
+        nmod_poly_mat_mullow(A, A, B, len);
+
+        if (!nmod_poly_mat_equal(C, A))
+        {
+            flint_printf("FAIL (aliasing A):\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("B:\n");
+            nmod_poly_mat_print(B, "x");
+            flint_printf("C:\n");
+            nmod_poly_mat_print(C, "x");
+            flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(C);
+    }
+
+    /* Check aliasing C and B */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, B, C;
+        mp_limb_t mod;
+        slong m, n, deg, len;
+
+        mod = n_randtest_prime(state, 0);
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        deg = 1 + n_randint(state, 10);
+        len = n_randint(state, 20);
+
+        nmod_poly_mat_init(A, m, m, mod);
+        nmod_poly_mat_init(B, m, n, mod);
+        nmod_poly_mat_init(C, m, n, mod);
+
+        nmod_poly_mat_randtest(A, state, deg);
+        nmod_poly_mat_randtest(B, state, deg);
+        nmod_poly_mat_randtest(C, state, deg);  /* noise in output */
+
+        nmod_poly_mat_mullow(C, A, B, len);
+        nmod_poly_mat_mullow(B, A, B, len);
+
+        if (!nmod_poly_mat_equal(C, B))
+        {
+            flint_printf("FAIL (aliasing B):\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("B:\n");
+            nmod_poly_mat_print(B, "x");
+            flint_printf("C:\n");
+            nmod_poly_mat_print(C, "x");
+            flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(C);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_dixon....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, X, B, AX, Bden;
+        nmod_poly_t den, det, r;
+        slong n, m, deg;
+        float density;
+        int solved;
+        mp_limb_t mod;
+
+        mod = n_randtest_prime(state, 0);
+        n = n_randint(state, 15);
+        m = n_randint(state, 5);
+        deg = 1 + n_randint(state, 8);
+        density = n_randint(state, 100) * 0.01;
+
+        nmod_poly_mat_init(A, n, n, mod);
+        nmod_poly_mat_init(B, n, m, mod);
+        nmod_poly_mat_init(X, n, m, mod);
+        nmod_poly_mat_init(AX, n, m, mod);
+        nmod_poly_mat_init(Bden, n, m, mod);
+        nmod_poly_init(den, mod);
+        nmod_poly_init(det, mod);
+        nmod_poly_init(r, mod);
+
+        if (n_randint(state, 2))
+        {
+            nmod_poly_mat_randtest_sparse(A, state, deg, density);
+        }
+        else
+        {
+            /* products tend to have nontrivial invariant factors */
+            nmod_poly_mat_t C;
+            nmod_poly_mat_init(C, n, n, mod);
+            nmod_poly_mat_randtest(A, state, 1 + n_randint(state, 3));
+            nmod_poly_mat_randtest(C, state, 1 + n_randint(state, 3));
+            nmod_poly_mat_mul(A, A, C);
+            nmod_poly_mat_clear(C);
+        }
+
+        nmod_poly_mat_randtest_sparse(B, state, deg, density);
+
+        solved = nmod_poly_mat_solve_dixon(X, den, A, B);
+        nmod_poly_mat_det_fflu(det, A);
+
+        if (m == 0 || n == 0)
+        {
+            if (solved == 0)
+            {
+                flint_printf("FAIL: expected empty system to pass\n");
+                abort();
+            }
+        }
+        else
+        {
+            if (solved != !nmod_poly_is_zero(det))
+            {
+                flint_printf("FAIL: return value does not match det(A)\n");
+                abort();
+            }
+
+            if (solved)
+            {
+                nmod_poly_rem(r, det, den);
+
+                if (!nmod_poly_is_zero(r))
+                {
+                    flint_printf("FAIL: den does not divide det(A)\n");
+                    flint_printf("den:\n"); nmod_poly_print(den);
+                    flint_printf("\n\n");
+                    flint_printf("det:\n"); nmod_poly_print(det);
+                    flint_printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        if (solved != !nmod_poly_is_zero(den))
+        {
+            flint_printf("FAIL: return value does not match denominator\n");
+            abort();
+        }
+
+        nmod_poly_mat_mul(AX, A, X);
+        nmod_poly_mat_scalar_mul_nmod_poly(Bden, B, den);
+
+        if (solved && !nmod_poly_mat_equal(AX, Bden))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("B:\n");
+            nmod_poly_mat_print(B, "x");
+            flint_printf("X:\n");
+            nmod_poly_mat_print(X, "x");
+            flint_printf("AX:\n");
+            nmod_poly_mat_print(AX, "x");
+            flint_printf("Bden:\n");
+            nmod_poly_mat_print(Bden, "x");
+            abort();
+        }
+
+        nmod_poly_clear(den);
+        nmod_poly_clear(det);
+        nmod_poly_clear(r);
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(X);
+        nmod_poly_mat_clear(AX);
+        nmod_poly_mat_clear(Bden);
+    }
+
+    /* Check aliasing X and B */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, X, B;
+        nmod_poly_t den1, den2;
+        slong n, m, deg;
+        int solved1, solved2;
+        mp_limb_t mod;
+
+        mod = n_randtest_prime(state, 0);
+        n = n_randint(state, 10);
+        m = n_randint(state, 5);
+        deg = 1 + n_randint(state, 8);
+
+        nmod_poly_mat_init(A, n, n, mod);
+        nmod_poly_mat_init(B, n, m, mod);
+        nmod_poly_mat_init(X, n, m, mod);
+        nmod_poly_init(den1, mod);
+        nmod_poly_init(den2, mod);
+
+        nmod_poly_mat_randtest(A, state, deg);
+        nmod_poly_mat_randtest(B, state, deg);
+
+        solved1 = nmod_poly_mat_solve_dixon(X, den1, A, B);
+        solved2 = nmod_poly_mat_solve_dixon(B, den2, A, B);
+
+        if (solved1 != solved2 || (solved1 &&
+            (!nmod_poly_equal(den1, den2) || !nmod_poly_mat_equal(X, B))))
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            flint_printf("X:\n");
+            nmod_poly_mat_print(X, "x");
+            flint_printf("B:\n");
+            nmod_poly_mat_print(B, "x");
+            abort();
+        }
+
+        nmod_poly_clear(den1);
+        nmod_poly_clear(den2);
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(X);
+    }
+
+    /* Singular A with B = 0 */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_mat_t A, X, B;
+        nmod_poly_t den, c;
+        slong j, n, m, deg;
+        mp_limb_t mod;
+
+        mod = n_randtest_prime(state, 0);
+        n = 2 + n_randint(state, 14);
+        m = 1 + n_randint(state, 4);
+        deg = 1 + n_randint(state, 8);
+
+        nmod_poly_mat_init(A, n, n, mod);
+        nmod_poly_mat_init(B, n, m, mod);
+        nmod_poly_mat_init(X, n, m, mod);
+        nmod_poly_init(den, mod);
+        nmod_poly_init(c, mod);
+
+        /* the last row is a multiple of the first one */
+        nmod_poly_mat_randtest(A, state, deg);
+        nmod_poly_randtest_not_zero(c, state, 1 + n_randint(state, 3));
+        for (j = 0; j < n; j++)
+            nmod_poly_mul(nmod_poly_mat_entry(A, n - 1, j),
+                          nmod_poly_mat_entry(A, 0, j), c);
+
+        if (nmod_poly_mat_solve_dixon(X, den, A, B) != 0
+            || nmod_poly_mat_solve(X, den, A, B) != 0)
+        {
+            flint_printf("FAIL (singular A, zero B):\n");
+            flint_printf("A:\n");
+            nmod_poly_mat_print(A, "x");
+            abort();
+        }
+
+        nmod_poly_clear(den);
+        nmod_poly_clear(c);
+        nmod_poly_mat_clear(A);
+        nmod_poly_mat_clear(B);
+        nmod_poly_mat_clear(X);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
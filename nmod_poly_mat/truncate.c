@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+void
+nmod_poly_mat_truncate(nmod_poly_mat_t A, slong len)
+{
+    slong i, j;
+
+    for (i = 0; i < nmod_poly_mat_nrows(A); i++)
+        for (j = 0; j < nmod_poly_mat_ncols(A); j++)
+            nmod_poly_truncate(nmod_poly_mat_entry(A, i, j), len);
+}
@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage: the nonzero entries of row i are
+    entries[k] in column cols[k] for row_starts[i] <= k < row_starts[i + 1],
+    with the columns strictly increasing.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong * cols;
+    slong * row_starts;
+    slong r;
+    slong c;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+/* nmod_sparse_mat_t allows reference-like semantics for nmod_sparse_mat_struct */
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t mat)
+{
+   return mat->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t mat)
+{
+   return mat->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t mat)
+{
+   return mat->row_starts[mat->r];
+}
+
+/* Memory management */
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t mat, slong rows,
+                                    slong cols, mp_limb_t n);
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t mat);
+FLINT_DLL void _nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz);
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t mat,
+                                   const nmod_sparse_mat_t src);
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t mat);
+
+NMOD_SPARSE_MAT_INLINE
+void nmod_sparse_mat_swap(nmod_sparse_mat_t mat1, nmod_sparse_mat_t mat2)
+{
+    nmod_sparse_mat_struct t = *mat1;
+    *mat1 = *mat2;
+    *mat2 = t;
+}
+
+/* Conversions */
+FLINT_DLL void nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat,
+    const slong * rows, const slong * cols, mp_srcptr vals, slong len);
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t mat,
+                                            const nmod_mat_t A);
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                            const nmod_sparse_mat_t mat);
+
+/* Random matrix generation */
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t mat,
+                                        flint_rand_t state, slong nnz);
+
+/* Comparison and transpose */
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t mat1,
+                                    const nmod_sparse_mat_t mat2);
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                         const nmod_sparse_mat_t A);
+
+/* Matrix-vector multiplication */
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+                                       mp_srcptr x);
+FLINT_DLL void nmod_sparse_mat_mul_vec_transpose(mp_ptr y,
+                                  const nmod_sparse_mat_t A, mp_srcptr x);
+
+/* Structured Gaussian elimination */
+FLINT_DLL slong _nmod_sparse_mat_eliminate_singletons(slong * elim_rows,
+                slong * elim_cols, char * row_alive, char * col_alive,
+                const nmod_sparse_mat_t A);
+FLINT_DLL void _nmod_sparse_mat_get_alive(nmod_sparse_mat_t S,
+                const nmod_sparse_mat_t A, const char * row_alive,
+                const slong * col_index);
+FLINT_DLL slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_nullspace(nmod_mat_t X,
+                                          const nmod_sparse_mat_t A);
+
+/* Wiedemann's algorithm */
+FLINT_DLL slong _nmod_sparse_mat_berlekamp_massey(mp_ptr poly, mp_srcptr seq,
+                                                  slong len, nmod_t mod);
+FLINT_DLL slong _nmod_sparse_mat_minpoly_vec(mp_ptr poly,
+                   const nmod_sparse_mat_t A, mp_srcptr u, mp_srcptr v);
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+                   const nmod_sparse_mat_t A, mp_srcptr b);
+FLINT_DLL int nmod_sparse_mat_nullvector_wiedemann(mp_ptr x,
+                   const nmod_sparse_mat_t A);
+FLINT_DLL void _nmod_sparse_mat_precond_mul_vec(mp_ptr y,
+                   const nmod_sparse_mat_t A, mp_srcptr d1, mp_srcptr d2,
+                   mp_srcptr x, mp_ptr t);
+FLINT_DLL slong _nmod_sparse_mat_precond_minpoly_vec(mp_ptr poly,
+                   const nmod_sparse_mat_t A, mp_srcptr d1, mp_srcptr d2,
+                   mp_srcptr u, mp_srcptr v);
+FLINT_DLL slong nmod_sparse_mat_rank_wiedemann(const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_nullspace_wiedemann(nmod_mat_t X,
+                   const nmod_sparse_mat_t A);
+
+/* Number of random projections tried by the Wiedemann functions */
+#define NMOD_SPARSE_MAT_WIEDEMANN_TRIES 10
+
+/*
+    Largest number of entries of the dense matrix which rank and nullspace
+    build from what is left after singleton elimination; larger systems
+    are handled by Wiedemann's algorithm
+*/
+#define NMOD_SPARSE_MAT_DENSE_CUTOFF (WORD(1) << 22)
+
+/* Number of nonzero entries needed for multiplication to use threads */
+#define NMOD_SPARSE_MAT_THREAD_CUTOFF (WORD(1) << 14)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
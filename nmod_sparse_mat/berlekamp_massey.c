@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+slong
+_nmod_sparse_mat_berlekamp_massey(mp_ptr poly, mp_srcptr seq, slong len,
+                                                                nmod_t mod)
+{
+    slong i, j, L, LB, m;
+    mp_limb_t b, d, q;
+    mp_ptr C, B, T;
+
+    /*
+        connection polynomial C with 1 + C_1 z + ... + C_L z^L, and the
+        one B of degree at most LB from before the last length change
+    */
+    C = _nmod_vec_init(len + 1);
+    B = _nmod_vec_init(len + 1);
+    T = _nmod_vec_init(len + 1);
+
+    _nmod_vec_zero(C, len + 1);
+    _nmod_vec_zero(B, len + 1);
+    C[0] = B[0] = 1;
+
+    L = LB = 0;
+    m = 1;
+    b = 1;
+
+    for (i = 0; i < len; i++)
+    {
+        /* discrepancy */
+        d = seq[i];
+        for (j = 1; j <= L; j++)
+            NMOD_ADDMUL(d, C[j], seq[i - j], mod);
+
+        if (d == 0)
+        {
+            m++;
+            continue;
+        }
+
+        q = nmod_div(d, b, mod);
+
+        /* C -= q z^m B, which has degree at most max(L, m + LB) */
+        if (2 * L <= i)
+        {
+            _nmod_vec_set(T, C, L + 1);
+
+            for (j = 0; j <= LB; j++)
+                C[j + m] = nmod_sub(C[j + m], nmod_mul(q, B[j], mod), mod);
+
+            LB = L;
+            L = i + 1 - L;
+            _nmod_vec_set(B, T, LB + 1);
+            b = d;
+            m = 1;
+        }
+        else
+        {
+            for (j = 0; j <= LB; j++)
+                C[j + m] = nmod_sub(C[j + m], nmod_mul(q, B[j], mod), mod);
+
+            m++;
+        }
+    }
+
+    /* the minimal polynomial is the reverse of C */
+    for (j = 0; j <= L; j++)
+        poly[j] = C[L - j];
+
+    _nmod_vec_clear(C);
+    _nmod_vec_clear(B);
+    _nmod_vec_clear(T);
+
+    return L;
+}
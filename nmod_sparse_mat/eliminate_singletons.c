@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    A column with a single entry, in row i, lets the equation of row i be
+    solved for that variable, so row i and the column can be removed. A row
+    with a single entry, in column j, forces x_j = 0, so the row and column
+    can be removed and column j dropped from the other rows. Removing
+    either can create new singletons, which are kept in a queue. Empty rows
+    are removed as well.
+*/
+slong
+_nmod_sparse_mat_eliminate_singletons(slong * elim_rows, slong * elim_cols,
+            char * row_alive, char * col_alive, const nmod_sparse_mat_t A)
+{
+    slong i, j, k, l, e, r, c, head, tail, num;
+    slong * row_weight, * col_weight, * queue;
+    nmod_sparse_mat_t At;
+
+    r = A->r;
+    c = A->c;
+
+    nmod_sparse_mat_init(At, c, r, A->mod.n);
+    nmod_sparse_mat_transpose(At, A);
+
+    row_weight = flint_malloc(FLINT_MAX(r, 1) * sizeof(slong));
+    col_weight = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+    queue = flint_malloc((r + c + 2 * nmod_sparse_mat_nnz(A) + 1)
+                                                            * sizeof(slong));
+
+    head = tail = 0;
+
+    /* rows are queued as i and columns as r + j */
+    for (i = 0; i < r; i++)
+    {
+        row_alive[i] = 1;
+        row_weight[i] = A->row_starts[i + 1] - A->row_starts[i];
+        if (row_weight[i] <= 1)
+            queue[tail++] = i;
+    }
+
+    for (j = 0; j < c; j++)
+    {
+        col_alive[j] = 1;
+        col_weight[j] = At->row_starts[j + 1] - At->row_starts[j];
+        if (col_weight[j] == 1)
+            queue[tail++] = r + j;
+    }
+
+    num = 0;
+
+    while (head < tail)
+    {
+        e = queue[head++];
+
+        if (e < r)
+        {
+            i = e;
+
+            if (!row_alive[i] || row_weight[i] > 1)
+                continue;
+
+            row_alive[i] = 0;
+
+            if (row_weight[i] == 0)
+                continue;
+
+            /* x_j = 0 */
+            for (k = A->row_starts[i]; !col_alive[A->cols[k]]; k++) ;
+            j = A->cols[k];
+
+            elim_rows[num] = -1;
+            elim_cols[num] = j;
+            num++;
+
+            col_alive[j] = 0;
+
+            for (k = At->row_starts[j]; k < At->row_starts[j + 1]; k++)
+            {
+                l = At->cols[k];
+
+                if (row_alive[l] && --row_weight[l] <= 1)
+                    queue[tail++] = l;
+            }
+        }
+        else
+        {
+            j = e - r;
+
+            if (!col_alive[j] || col_weight[j] != 1)
+                continue;
+
+            /* solve the equation of row i for x_j */
+            for (k = At->row_starts[j]; !row_alive[At->cols[k]]; k++) ;
+            i = At->cols[k];
+
+            elim_rows[num] = i;
+            elim_cols[num] = j;
+            num++;
+
+            row_alive[i] = 0;
+            col_alive[j] = 0;
+
+            for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            {
+                l = A->cols[k];
+
+                if (col_alive[l] && --col_weight[l] == 1)
+                    queue[tail++] = r + l;
+            }
+        }
+    }
+
+    flint_free(row_weight);
+    flint_free(col_weight);
+    flint_free(queue);
+    nmod_sparse_mat_clear(At);
+
+    return num;
+}
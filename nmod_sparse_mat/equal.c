@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+int
+nmod_sparse_mat_equal(const nmod_sparse_mat_t mat1,
+                      const nmod_sparse_mat_t mat2)
+{
+    slong i, nnz;
+
+    if (mat1->r != mat2->r || mat1->c != mat2->c)
+        return 0;
+
+    for (i = 0; i <= mat1->r; i++)
+        if (mat1->row_starts[i] != mat2->row_starts[i])
+            return 0;
+
+    nnz = nmod_sparse_mat_nnz(mat1);
+
+    for (i = 0; i < nnz; i++)
+        if (mat1->cols[i] != mat2->cols[i]
+                || mat1->entries[i] != mat2->entries[i])
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+_nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz)
+{
+    if (nnz > mat->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2 * mat->alloc);
+
+        mat->entries = flint_realloc(mat->entries, nnz * sizeof(mp_limb_t));
+        mat->cols = flint_realloc(mat->cols, nnz * sizeof(slong));
+        mat->alloc = nnz;
+    }
+}
@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+_nmod_sparse_mat_get_alive(nmod_sparse_mat_t S, const nmod_sparse_mat_t A,
+                           const char * row_alive, const slong * col_index)
+{
+    slong i, k, rr, nnz;
+
+    for (i = nnz = 0; i < A->r; i++)
+        if (row_alive[i])
+            for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+                nnz += (col_index[A->cols[k]] >= 0);
+
+    _nmod_sparse_mat_fit_nnz(S, nnz);
+
+    for (i = rr = nnz = 0; i < A->r; i++)
+    {
+        if (!row_alive[i])
+            continue;
+
+        S->row_starts[rr++] = nnz;
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            if (col_index[A->cols[k]] >= 0)
+            {
+                S->cols[nnz] = col_index[A->cols[k]];
+                S->entries[nnz] = A->entries[k];
+                nnz++;
+            }
+        }
+    }
+
+    S->row_starts[rr] = nnz;
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+slong
+_nmod_sparse_mat_minpoly_vec(mp_ptr poly, const nmod_sparse_mat_t A,
+                                                mp_srcptr u, mp_srcptr v)
+{
+    slong i, n, L;
+    int nlimbs;
+    mp_ptr seq, w, t, tmp;
+
+    n = A->r;
+    nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+
+    seq = _nmod_vec_init(2 * n);
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    /* seq[i] = u^T A^i v */
+    _nmod_vec_set(w, v, n);
+
+    for (i = 0; i < 2 * n; i++)
+    {
+        seq[i] = _nmod_vec_dot(u, w, n, A->mod, nlimbs);
+
+        if (i + 1 < 2 * n)
+        {
+            nmod_sparse_mat_mul_vec(t, A, w);
+            tmp = t;
+            t = w;
+            w = tmp;
+        }
+    }
+
+    L = _nmod_sparse_mat_berlekamp_massey(poly, seq, 2 * n, A->mod);
+
+    _nmod_vec_clear(seq);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+
+    return L;
+}
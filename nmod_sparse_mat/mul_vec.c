@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "nmod_sparse_mat.h"
+
+/* sets y[i] for i0 <= i < i1, accumulating each row in three limbs */
+static void
+_nmod_sparse_mat_mul_vec_range(mp_ptr y, const nmod_sparse_mat_t A,
+                               mp_srcptr x, slong i0, slong i1)
+{
+    slong i, k;
+    mp_limb_t s0, s1, s2, hi, lo;
+
+    for (i = i0; i < i1; i++)
+    {
+        s0 = s1 = s2 = 0;
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            umul_ppmm(hi, lo, A->entries[k], x[A->cols[k]]);
+            add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, hi, lo);
+        }
+
+        NMOD_RED3(y[i], s2, s1, s0, A->mod);
+    }
+}
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    slong i0;
+    slong i1;
+}
+mul_vec_arg_t;
+
+static void *
+_nmod_sparse_mat_mul_vec_worker(void * arg_ptr)
+{
+    mul_vec_arg_t arg = *((mul_vec_arg_t *) arg_ptr);
+
+    _nmod_sparse_mat_mul_vec_range(arg.y, arg.A, arg.x, arg.i0, arg.i1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    slong i, r, nnz, num_threads;
+    pthread_t * threads;
+    mul_vec_arg_t * args;
+
+    r = A->r;
+    nnz = nmod_sparse_mat_nnz(A);
+    num_threads = FLINT_MIN(flint_get_num_threads(), r);
+
+    if (num_threads <= 1 || nnz < NMOD_SPARSE_MAT_THREAD_CUTOFF)
+    {
+        _nmod_sparse_mat_mul_vec_range(y, A, x, 0, r);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(mul_vec_arg_t) * num_threads);
+
+    /* split the rows so that each thread gets about the same number of
+       nonzero entries */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].y = y;
+        args[i].A = A;
+        args[i].x = x;
+        args[i].i0 = (i == 0) ? 0 : args[i - 1].i1;
+        args[i].i1 = args[i].i0;
+
+        while (args[i].i1 < r && A->row_starts[args[i].i1]
+                                            < (nnz * (i + 1)) / num_threads)
+            args[i].i1++;
+
+        if (i == num_threads - 1)
+            args[i].i1 = r;
+
+        pthread_create(&threads[i], NULL,
+                       _nmod_sparse_mat_mul_vec_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
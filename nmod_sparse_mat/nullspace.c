@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A)
+{
+    slong i, j, k, e, t, rr, cc, num, nullity;
+    slong * elim_rows, * elim_cols, * col_index, * cols_left;
+    char * row_alive, * col_alive;
+    mp_limb_t s, piv;
+    mp_ptr x;
+    nmod_mat_t N;
+
+    elim_rows = flint_malloc((FLINT_MIN(A->r, A->c) + 1) * sizeof(slong));
+    elim_cols = flint_malloc((FLINT_MIN(A->r, A->c) + 1) * sizeof(slong));
+    col_index = flint_malloc((A->c + 1) * sizeof(slong));
+    cols_left = flint_malloc((A->c + 1) * sizeof(slong));
+    row_alive = flint_malloc(A->r + 1);
+    col_alive = flint_malloc(A->c + 1);
+
+    num = _nmod_sparse_mat_eliminate_singletons(elim_rows, elim_cols,
+                                                row_alive, col_alive, A);
+
+    for (i = rr = 0; i < A->r; i++)
+        rr += row_alive[i];
+    for (j = cc = 0; j < A->c; j++)
+    {
+        col_index[j] = -1;
+        if (col_alive[j])
+        {
+            col_index[j] = cc;
+            cols_left[cc++] = j;
+        }
+    }
+
+    nmod_mat_init(N, cc, FLINT_MIN(cc, X->c), A->mod.n);
+
+    if (cc == 0 || rr <= NMOD_SPARSE_MAT_DENSE_CUTOFF / cc)
+    {
+        /* dense nullspace of what is left */
+        nmod_mat_t B;
+
+        nmod_mat_init(B, rr, cc, A->mod.n);
+
+        for (i = rr = 0; i < A->r; i++)
+        {
+            if (!row_alive[i])
+                continue;
+
+            for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+                if (col_alive[A->cols[k]])
+                    nmod_mat_entry(B, rr, col_index[A->cols[k]])
+                        = A->entries[k];
+
+            rr++;
+        }
+
+        nullity = nmod_mat_nullspace(N, B);
+
+        nmod_mat_clear(B);
+    }
+    else
+    {
+        /* too large for dense elimination */
+        nmod_sparse_mat_t S;
+
+        nmod_sparse_mat_init(S, rr, cc, A->mod.n);
+        _nmod_sparse_mat_get_alive(S, A, row_alive, col_index);
+
+        nullity = nmod_sparse_mat_nullspace_wiedemann(N, S);
+
+        nmod_sparse_mat_clear(S);
+
+        if (nullity < 0)
+        {
+            flint_printf("Exception (nmod_sparse_mat_nullspace). "
+                         "Wiedemann's algorithm failed.\n");
+            flint_abort();
+        }
+    }
+
+    nmod_mat_zero(X);
+    x = _nmod_vec_init(A->c);
+
+    /* extend each vector to the eliminated variables, in reverse order;
+       the variables forced to be zero stay zero */
+    for (t = 0; t < nullity; t++)
+    {
+        _nmod_vec_zero(x, A->c);
+
+        for (j = 0; j < cc; j++)
+            x[cols_left[j]] = nmod_mat_entry(N, j, t);
+
+        for (e = num - 1; e >= 0; e--)
+        {
+            i = elim_rows[e];
+            j = elim_cols[e];
+
+            if (i < 0)
+                continue;
+
+            s = 0;
+            piv = 0;
+
+            for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            {
+                if (A->cols[k] == j)
+                    piv = A->entries[k];
+                else
+                    NMOD_ADDMUL(s, A->entries[k], x[A->cols[k]], A->mod);
+            }
+
+            /* x_j = -s / piv */
+            x[j] = nmod_neg(nmod_div(s, piv, A->mod), A->mod);
+        }
+
+        for (j = 0; j < A->c; j++)
+            nmod_mat_entry(X, j, t) = x[j];
+    }
+
+    _nmod_vec_clear(x);
+    nmod_mat_clear(N);
+    flint_free(elim_rows);
+    flint_free(elim_cols);
+    flint_free(col_index);
+    flint_free(cols_left);
+    flint_free(row_alive);
+    flint_free(col_alive);
+
+    return nullity;
+}
@@ -0,0 +1,168 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    Writing the minimal polynomial of a projection of the sequence B^i v,
+    for B = D1 A^T D2 A D1 as in nmod_sparse_mat_rank_wiedemann, as
+    f = x^e g with g(0) != 0 and e > 0, the last nonzero vector among
+    w = g(B) v, B w, ..., B^(e - 1) w is usually in the kernel of B, and
+    then D1 times it is in the kernel of A. Random kernel vectors are
+    collected until there are c - deg(f) + 1 independent ones. As this is
+    at least the nullity of A, they then form a basis.
+*/
+slong
+nmod_sparse_mat_nullspace_wiedemann(nmod_mat_t X, const nmod_sparse_mat_t A)
+{
+    slong i, j, n, L, e, k, num, s, tries, nullity;
+    slong * piv;
+    mp_ptr f, d1, d2, u, v, w, t, z, E, r;
+    nmod_t mod = A->mod;
+    flint_rand_t state;
+
+    n = A->c;
+
+    if (n == 0)
+        return 0;
+
+    flint_randinit(state);
+
+    f = _nmod_vec_init(2 * FLINT_MIN(n, A->r + 1) + 1);
+    d1 = _nmod_vec_init(n);
+    d2 = _nmod_vec_init(FLINT_MAX(A->r, 1));
+    z = _nmod_vec_init(FLINT_MAX(A->r, 1));
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    nullity = -1;
+
+    for (tries = 0; tries < NMOD_SPARSE_MAT_WIEDEMANN_TRIES && nullity < 0;
+                                                                    tries++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            d1[i] = 1 + n_randint(state, mod.n - 1);
+            u[i] = n_randint(state, mod.n);
+            v[i] = n_randint(state, mod.n);
+        }
+
+        for (i = 0; i < A->r; i++)
+            d2[i] = 1 + n_randint(state, mod.n - 1);
+
+        L = _nmod_sparse_mat_precond_minpoly_vec(f, A, d1, d2, u, v);
+
+        for (e = 0; e < L && f[e] == 0; e++) ;
+
+        /* an upper bound for the nullity */
+        k = n - L + (e > 0);
+
+        if (k == 0)
+        {
+            nmod_mat_zero(X);
+            nullity = 0;
+            break;
+        }
+
+        if (e == 0 || k > X->c)
+            continue;
+
+        E = _nmod_vec_init(k * n);
+        piv = flint_malloc(k * sizeof(slong));
+        nmod_mat_zero(X);
+
+        for (s = num = 0; s < k + NMOD_SPARSE_MAT_WIEDEMANN_TRIES && num < k;
+                                                                        s++)
+        {
+            for (i = 0; i < n; i++)
+                v[i] = n_randint(state, mod.n);
+
+            /* Horner evaluation of w = g(B) v */
+            _nmod_vec_scalar_mul_nmod(w, v, n, f[L], mod);
+
+            for (i = L - 1; i >= e; i--)
+            {
+                _nmod_sparse_mat_precond_mul_vec(t, A, d1, d2, w, z);
+                _nmod_vec_scalar_addmul_nmod(t, v, n, f[i], mod);
+                _nmod_vec_swap(w, t, n);
+            }
+
+            if (_nmod_vec_is_zero(w, n))
+                continue;
+
+            /* multiply by B until zero is reached */
+            for (j = 0; j < e; j++)
+            {
+                _nmod_sparse_mat_precond_mul_vec(t, A, d1, d2, w, z);
+
+                if (_nmod_vec_is_zero(t, n))
+                    break;
+
+                _nmod_vec_swap(w, t, n);
+            }
+
+            if (j == e)
+                continue;
+
+            /* t = D1 w, checked against A */
+            for (i = 0; i < n; i++)
+                t[i] = nmod_mul(d1[i], w[i], mod);
+
+            nmod_sparse_mat_mul_vec(z, A, t);
+
+            if (!_nmod_vec_is_zero(z, A->r))
+                continue;
+
+            /* reduce against the vectors found so far */
+            r = E + num * n;
+            _nmod_vec_set(r, t, n);
+
+            for (i = 0; i < num; i++)
+                if (r[piv[i]] != 0)
+                    _nmod_vec_scalar_addmul_nmod(r, E + i * n, n,
+                                               nmod_neg(r[piv[i]], mod), mod);
+
+            for (j = 0; j < n && r[j] == 0; j++) ;
+
+            if (j == n)
+                continue;
+
+            piv[num] = j;
+            _nmod_vec_scalar_mul_nmod(r, r, n, n_invmod(r[j], mod.n), mod);
+
+            for (i = 0; i < n; i++)
+                nmod_mat_entry(X, i, num) = t[i];
+
+            num++;
+        }
+
+        if (num == k)
+            nullity = k;
+
+        _nmod_vec_clear(E);
+        flint_free(piv);
+    }
+
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(d1);
+    _nmod_vec_clear(d2);
+    _nmod_vec_clear(z);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+
+    flint_randclear(state);
+
+    return nullity;
+}
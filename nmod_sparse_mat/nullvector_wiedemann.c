@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    If the minimal polynomial of the sequence u^T A^i v is f = x^k g with
+    g(0) != 0 then, with high probability, w = g(A) v satisfies A^k w = 0,
+    and the last nonzero vector among w, A w, ..., A^k w is in the kernel.
+*/
+int
+nmod_sparse_mat_nullvector_wiedemann(mp_ptr x, const nmod_sparse_mat_t A)
+{
+    slong i, j, k, n, L, tries;
+    int success = 0;
+    mp_ptr f, u, v, w, t;
+    flint_rand_t state;
+
+    n = A->r;
+
+    if (n == 0)
+        return 0;
+
+    flint_randinit(state);
+
+    f = _nmod_vec_init(n + 1);
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    for (tries = 0; tries < NMOD_SPARSE_MAT_WIEDEMANN_TRIES && !success;
+                                                                    tries++)
+    {
+        _nmod_vec_randtest(u, state, n, A->mod);
+        _nmod_vec_randtest(v, state, n, A->mod);
+
+        L = _nmod_sparse_mat_minpoly_vec(f, A, u, v);
+
+        for (k = 0; k < L && f[k] == 0; k++) ;
+
+        if (k == 0)
+            continue;
+
+        /* w = g(A) v */
+        _nmod_vec_scalar_mul_nmod(w, v, n, f[L], A->mod);
+
+        for (i = L - 1; i >= k; i--)
+        {
+            nmod_sparse_mat_mul_vec(t, A, w);
+            _nmod_vec_scalar_addmul_nmod(t, v, n, f[i], A->mod);
+            _nmod_vec_swap(w, t, n);
+        }
+
+        if (_nmod_vec_is_zero(w, n))
+            continue;
+
+        /* multiply by A until zero is reached */
+        for (j = 0; j < k && !success; j++)
+        {
+            nmod_sparse_mat_mul_vec(t, A, w);
+
+            if (_nmod_vec_is_zero(t, n))
+            {
+                _nmod_vec_set(x, w, n);
+                success = 1;
+            }
+            else
+                _nmod_vec_swap(w, t, n);
+        }
+    }
+
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+
+    flint_randclear(state);
+
+    return success;
+}
@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+slong
+_nmod_sparse_mat_precond_minpoly_vec(mp_ptr poly, const nmod_sparse_mat_t A,
+            mp_srcptr d1, mp_srcptr d2, mp_srcptr u, mp_srcptr v)
+{
+    slong i, n, len, L;
+    int nlimbs;
+    mp_ptr seq, w, t, s;
+
+    n = A->c;
+    nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+
+    /* the Krylov spaces of B have dimension at most rank(A) + 1 */
+    len = 2 * FLINT_MIN(n, A->r + 1);
+
+    seq = _nmod_vec_init(len);
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+    s = _nmod_vec_init(FLINT_MAX(A->r, 1));
+
+    /* seq[i] = u^T B^i v */
+    _nmod_vec_set(w, v, n);
+
+    for (i = 0; i < len; i++)
+    {
+        seq[i] = _nmod_vec_dot(u, w, n, A->mod, nlimbs);
+
+        if (i + 1 < len)
+        {
+            _nmod_sparse_mat_precond_mul_vec(t, A, d1, d2, w, s);
+            _nmod_vec_swap(w, t, n);
+        }
+    }
+
+    L = _nmod_sparse_mat_berlekamp_massey(poly, seq, len, A->mod);
+
+    _nmod_vec_clear(seq);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(s);
+
+    return L;
+}
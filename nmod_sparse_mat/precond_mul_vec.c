@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+_nmod_sparse_mat_precond_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+            mp_srcptr d1, mp_srcptr d2, mp_srcptr x, mp_ptr t)
+{
+    slong i;
+
+    for (i = 0; i < A->c; i++)
+        y[i] = nmod_mul(d1[i], x[i], A->mod);
+
+    nmod_sparse_mat_mul_vec(t, A, y);
+
+    for (i = 0; i < A->r; i++)
+        t[i] = nmod_mul(d2[i], t[i], A->mod);
+
+    nmod_sparse_mat_mul_vec_transpose(y, A, t);
+
+    for (i = 0; i < A->c; i++)
+        y[i] = nmod_mul(d1[i], y[i], A->mod);
+}
@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t mat, flint_rand_t state,
+                                                                slong nnz)
+{
+    slong t, * rows, * cols;
+    mp_ptr vals;
+
+    if (mat->r == 0 || mat->c == 0 || mat->mod.n == 1)
+    {
+        nmod_sparse_mat_zero(mat);
+        return;
+    }
+
+    rows = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(slong));
+    cols = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(slong));
+    vals = _nmod_vec_init(FLINT_MAX(nnz, 1));
+
+    for (t = 0; t < nnz; t++)
+    {
+        rows[t] = n_randint(state, mat->r);
+        cols[t] = n_randint(state, mat->c);
+        vals[t] = 1 + n_randint(state, mat->mod.n - 1);
+    }
+
+    nmod_sparse_mat_set_entries(mat, rows, cols, vals, nnz);
+
+    flint_free(rows);
+    flint_free(cols);
+    _nmod_vec_clear(vals);
+}
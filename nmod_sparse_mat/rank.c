@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A)
+{
+    slong i, k, rr, cc, num, rank;
+    slong * elim_rows, * elim_cols, * col_index;
+    char * row_alive, * col_alive;
+
+    elim_rows = flint_malloc((FLINT_MIN(A->r, A->c) + 1) * sizeof(slong));
+    elim_cols = flint_malloc((FLINT_MIN(A->r, A->c) + 1) * sizeof(slong));
+    col_index = flint_malloc((A->c + 1) * sizeof(slong));
+    row_alive = flint_malloc(A->r + 1);
+    col_alive = flint_malloc(A->c + 1);
+
+    /* each eliminated singleton accounts for one pivot */
+    num = _nmod_sparse_mat_eliminate_singletons(elim_rows, elim_cols,
+                                                row_alive, col_alive, A);
+
+    for (i = rr = 0; i < A->r; i++)
+        rr += row_alive[i];
+    for (i = cc = 0; i < A->c; i++)
+        col_index[i] = col_alive[i] ? cc++ : -1;
+
+    if (cc == 0 || rr <= NMOD_SPARSE_MAT_DENSE_CUTOFF / cc)
+    {
+        /* the rank of what is left is found by dense elimination */
+        nmod_mat_t B;
+
+        nmod_mat_init(B, rr, cc, A->mod.n);
+
+        for (i = rr = 0; i < A->r; i++)
+        {
+            if (!row_alive[i])
+                continue;
+
+            for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+                if (col_alive[A->cols[k]])
+                    nmod_mat_entry(B, rr, col_index[A->cols[k]])
+                        = A->entries[k];
+
+            rr++;
+        }
+
+        rank = num + nmod_mat_rank(B);
+
+        nmod_mat_clear(B);
+    }
+    else
+    {
+        /* too large for dense elimination */
+        nmod_sparse_mat_t S;
+
+        nmod_sparse_mat_init(S, rr, cc, A->mod.n);
+        _nmod_sparse_mat_get_alive(S, A, row_alive, col_index);
+
+        rank = num + nmod_sparse_mat_rank_wiedemann(S);
+
+        nmod_sparse_mat_clear(S);
+    }
+
+    flint_free(elim_rows);
+    flint_free(elim_cols);
+    flint_free(col_index);
+    flint_free(row_alive);
+    flint_free(col_alive);
+
+    return rank;
+}
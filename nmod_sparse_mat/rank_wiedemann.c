@@ -0,0 +1,72 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    With random nonsingular diagonal D1 and D2, the minimal polynomial of
+    B = D1 A^T D2 A D1 has degree rank(A) + 1, or rank(A) if A has full
+    column rank, with high probability. In any case the Krylov space of a
+    vector v has dimension at most rank(A) + 1, and at most rank(A) if the
+    minimal polynomial f of a projection of the sequence B^i v has
+    f(0) != 0, since then v lies in the image of B. So the estimate
+    deg(f) - [f(0) = 0] never exceeds the rank.
+*/
+slong
+nmod_sparse_mat_rank_wiedemann(const nmod_sparse_mat_t A)
+{
+    slong i, k, n, L, est, rank;
+    mp_ptr f, d1, d2, u, v;
+    flint_rand_t state;
+
+    n = A->c;
+
+    if (A->r == 0 || n == 0)
+        return 0;
+
+    flint_randinit(state);
+
+    f = _nmod_vec_init(2 * FLINT_MIN(n, A->r + 1) + 1);
+    d1 = _nmod_vec_init(n);
+    d2 = _nmod_vec_init(A->r);
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+
+    rank = 0;
+
+    /* the largest of two independent estimates */
+    for (k = 0; k < 2; k++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            d1[i] = 1 + n_randint(state, A->mod.n - 1);
+            u[i] = n_randint(state, A->mod.n);
+            v[i] = n_randint(state, A->mod.n);
+        }
+
+        for (i = 0; i < A->r; i++)
+            d2[i] = 1 + n_randint(state, A->mod.n - 1);
+
+        L = _nmod_sparse_mat_precond_minpoly_vec(f, A, d1, d2, u, v);
+        est = L - (L > 0 && f[0] == 0);
+        rank = FLINT_MAX(rank, est);
+    }
+
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(d1);
+    _nmod_vec_clear(d2);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+
+    flint_randclear(state);
+
+    return rank;
+}
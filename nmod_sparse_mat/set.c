@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t mat, const nmod_sparse_mat_t src)
+{
+    slong i, nnz = nmod_sparse_mat_nnz(src);
+
+    if (mat == src)
+        return;
+
+    _nmod_sparse_mat_fit_nnz(mat, nnz);
+
+    for (i = 0; i <= src->r; i++)
+        mat->row_starts[i] = src->row_starts[i];
+
+    for (i = 0; i < nnz; i++)
+    {
+        mat->cols[i] = src->cols[i];
+        mat->entries[i] = src->entries[i];
+    }
+}
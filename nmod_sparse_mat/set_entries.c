@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat, const slong * rows,
+                    const slong * cols, mp_srcptr vals, slong len)
+{
+    slong i, j, k, t, nnz;
+    slong * count, * perm, * perm2;
+    mp_limb_t v, w;
+
+    /* counting sort by column followed by a stable counting sort by row,
+       so that the entries of each row end up sorted by column */
+    count = flint_calloc(FLINT_MAX(mat->r, mat->c) + 1, sizeof(slong));
+    perm = flint_malloc(FLINT_MAX(len, 1) * sizeof(slong));
+    perm2 = flint_malloc(FLINT_MAX(len, 1) * sizeof(slong));
+
+    for (t = 0; t < len; t++)
+        count[cols[t] + 1]++;
+    for (k = 0; k < mat->c; k++)
+        count[k + 1] += count[k];
+    for (t = 0; t < len; t++)
+        perm[count[cols[t]]++] = t;
+
+    for (k = 0; k <= mat->r; k++)
+        count[k] = 0;
+    for (t = 0; t < len; t++)
+        count[rows[t] + 1]++;
+    for (k = 0; k < mat->r; k++)
+        count[k + 1] += count[k];
+    for (t = 0; t < len; t++)
+        perm2[count[rows[perm[t]]]++] = perm[t];
+
+    /* merge repeated positions and drop zeros */
+    _nmod_sparse_mat_fit_nnz(mat, len);
+
+    for (i = t = nnz = 0; i < mat->r; i++)
+    {
+        mat->row_starts[i] = nnz;
+
+        while (t < len && rows[perm2[t]] == i)
+        {
+            j = cols[perm2[t]];
+            NMOD_RED(v, vals[perm2[t]], mat->mod);
+
+            for (t++; t < len && rows[perm2[t]] == i
+                                            && cols[perm2[t]] == j; t++)
+            {
+                NMOD_RED(w, vals[perm2[t]], mat->mod);
+                v = nmod_add(v, w, mat->mod);
+            }
+
+            if (v != 0)
+            {
+                mat->cols[nnz] = j;
+                mat->entries[nnz] = v;
+                nnz++;
+            }
+        }
+    }
+
+    mat->row_starts[mat->r] = nnz;
+
+    flint_free(count);
+    flint_free(perm);
+    flint_free(perm2);
+}
@@ -0,0 +1,76 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    If f is the minimal polynomial of the sequence u^T A^i b then, with
+    high probability, f(A) b = 0. If f(0) != 0 this gives
+    b = -A (f_1 + f_2 A + ... + f_L A^(L-1)) b / f(0).
+*/
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                                mp_srcptr b)
+{
+    slong i, k, n, L;
+    int success = 0;
+    mp_ptr f, u, t;
+    flint_rand_t state;
+
+    n = A->r;
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    flint_randinit(state);
+
+    f = _nmod_vec_init(n + 1);
+    u = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    for (k = 0; k < NMOD_SPARSE_MAT_WIEDEMANN_TRIES && !success; k++)
+    {
+        _nmod_vec_randtest(u, state, n, A->mod);
+
+        L = _nmod_sparse_mat_minpoly_vec(f, A, u, b);
+
+        if (L == 0 || f[0] == 0)
+            continue;
+
+        /* Horner evaluation of the quotient (f - f(0)) / x at A */
+        _nmod_vec_scalar_mul_nmod(x, b, n, f[L], A->mod);
+
+        for (i = L - 1; i >= 1; i--)
+        {
+            nmod_sparse_mat_mul_vec(t, A, x);
+            _nmod_vec_scalar_addmul_nmod(t, b, n, f[i], A->mod);
+            _nmod_vec_swap(x, t, n);
+        }
+
+        _nmod_vec_scalar_mul_nmod(x, x, n,
+                nmod_neg(n_invmod(f[0], A->mod.n), A->mod), A->mod);
+
+        /* check the solution */
+        nmod_sparse_mat_mul_vec(t, A, x);
+        success = _nmod_vec_equal(t, b, n);
+    }
+
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(t);
+
+    flint_randclear(state);
+
+    return success;
+}
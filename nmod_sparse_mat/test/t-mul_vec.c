@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    /* Compare with dense matrix multiplication */
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, Y;
+        slong i, m, n;
+        mp_limb_t mod;
+        mp_ptr x, y;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        if (n_randint(state, 10) == 0)
+        {
+            m += n_randint(state, 500);
+            n += n_randint(state, 500);
+        }
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(X, n, 1, mod);
+        nmod_mat_init(Y, m, 1, mod);
+        x = _nmod_vec_init(n + 1);
+        y = _nmod_vec_init(m + 1);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, m * n + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        _nmod_vec_randtest(x, state, n, M->mod);
+
+        for (i = 0; i < n; i++)
+            nmod_mat_entry(X, i, 0) = x[i];
+
+        nmod_sparse_mat_mul_vec(y, M, x);
+        nmod_mat_mul(Y, A, X);
+
+        for (i = 0; i < m; i++)
+        {
+            if (y[i] != nmod_mat_entry(Y, i, 0))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("m = %wd, n = %wd, i = %wd\n", m, n, i);
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec_transpose....");
+    fflush(stdout);
+
+    /* Compare with multiplication by the transpose */
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M, T;
+        slong m, n;
+        mp_limb_t mod;
+        mp_ptr x, y, z;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_sparse_mat_init(T, n, m, mod);
+        x = _nmod_vec_init(m + 1);
+        y = _nmod_vec_init(n + 1);
+        z = _nmod_vec_init(n + 1);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, m * n + 1));
+        nmod_sparse_mat_transpose(T, M);
+        _nmod_vec_randtest(x, state, m, M->mod);
+
+        nmod_sparse_mat_mul_vec_transpose(y, M, x);
+        nmod_sparse_mat_mul_vec(z, T, x);
+
+        if (!_nmod_vec_equal(y, z, n))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd\n", m, n);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(T);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
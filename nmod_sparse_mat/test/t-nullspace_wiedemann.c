@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace_wiedemann....");
+    fflush(stdout);
+
+    /* Check A X = 0, the rank of X and the nullity, for moduli large
+       enough for the preconditioners to work with high probability */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, AX;
+        slong m, n, nullity;
+        mp_limb_t mod;
+
+        m = n_randint(state, 40);
+        n = n_randint(state, 40);
+        mod = n_randprime(state, FLINT_BITS / 2 +
+                                 n_randint(state, FLINT_BITS / 2), 0);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(X, n, n, mod);
+
+        nmod_sparse_mat_randtest(M, state,
+                                 n_randint(state, 3 * (m + n) + 1) +
+                                 (n_randint(state, 4) == 0 ? m * n / 4 : 0));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        nullity = nmod_sparse_mat_nullspace_wiedemann(X, M);
+
+        if (nullity != n - nmod_mat_rank(A) || nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong nullity\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_init(AX, m, n, mod);
+        nmod_mat_mul(AX, A, X);
+
+        if (!nmod_mat_is_zero(AX))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("not in the nullspace\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(X);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(AX);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
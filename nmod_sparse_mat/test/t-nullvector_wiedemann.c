@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullvector_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        slong n, rank;
+        mp_limb_t mod;
+        mp_ptr x, y;
+        int success;
+
+        n = n_randint(state, 40);
+        if (n_randint(state, 20) == 0)
+            n += n_randint(state, 400);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, n, n, mod);
+        nmod_mat_init(A, n, n, mod);
+        x = _nmod_vec_init(n + 1);
+        y = _nmod_vec_init(n + 1);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 4 * n + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        rank = nmod_mat_rank(A);
+
+        success = nmod_sparse_mat_nullvector_wiedemann(x, M);
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (_nmod_vec_is_zero(x, n) || !_nmod_vec_is_zero(y, n))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("not a nonzero kernel vector\n");
+                abort();
+            }
+        }
+        else if (mod > 1000 && rank < n)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("no kernel vector found for singular matrix\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank_wiedemann....");
+    fflush(stdout);
+
+    /* Compare with the dense rank, for moduli large enough for the
+       preconditioners to work with high probability */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        slong m, n, r1, r2;
+        mp_limb_t mod;
+
+        m = n_randint(state, 40);
+        n = n_randint(state, 40);
+        mod = n_randprime(state, FLINT_BITS / 2 +
+                                 n_randint(state, FLINT_BITS / 2), 0);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+
+        /* from very sparse, with many singletons, to fairly dense */
+        nmod_sparse_mat_randtest(M, state,
+                                 n_randint(state, 3 * (m + n) + 1) +
+                                 (n_randint(state, 4) == 0 ? m * n / 4 : 0));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        r1 = nmod_sparse_mat_rank_wiedemann(M);
+        r2 = nmod_mat_rank(A);
+
+        if (r1 != r2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r1 = %wd, r2 = %wd\n", r1, r2);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    /* Compare with accumulating the entries in a dense matrix */
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, B;
+        slong t, m, n, len, * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        len = (m == 0 || n == 0) ? 0 : n_randint(state, 2 * m * n + 1);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+
+        rows = flint_malloc((len + 1) * sizeof(slong));
+        cols = flint_malloc((len + 1) * sizeof(slong));
+        vals = _nmod_vec_init(len + 1);
+
+        for (t = 0; t < len; t++)
+        {
+            rows[t] = n_randint(state, m);
+            cols[t] = n_randint(state, n);
+            vals[t] = n_randtest(state);
+            nmod_mat_entry(A, rows[t], cols[t]) = nmod_add(
+                nmod_mat_entry(A, rows[t], cols[t]),
+                n_mod2_preinv(vals[t], A->mod.n, A->mod.ninv), A->mod);
+        }
+
+        nmod_sparse_mat_set_entries(M, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(B, M);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        /* rows sorted and no zero entries stored */
+        for (t = 0; t < m; t++)
+        {
+            slong k;
+
+            for (k = M->row_starts[t]; k < M->row_starts[t + 1]; k++)
+            {
+                if (M->entries[k] == 0 || (k > M->row_starts[t]
+                                           && M->cols[k - 1] >= M->cols[k]))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("not in canonical form\n");
+                    abort();
+                }
+            }
+        }
+
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    /* Round trip through a dense matrix */
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M, M2;
+        nmod_mat_t A, B;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_sparse_mat_init(M2, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+
+        nmod_mat_randtest(A, state);
+        if (n_randint(state, 2))
+            nmod_mat_randrank(A, state, n_randint(state, FLINT_MIN(m, n) + 1));
+
+        nmod_sparse_mat_set_nmod_mat(M, A);
+        nmod_sparse_mat_get_nmod_mat(B, M);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_randtest(M2, state, n_randint(state, m * n + 1));
+        nmod_sparse_mat_set(M2, M);
+
+        if (!nmod_sparse_mat_equal(M, M2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("set/equal\n");
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(M2);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
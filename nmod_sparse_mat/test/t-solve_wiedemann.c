@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        slong i, n;
+        mp_limb_t mod;
+        mp_ptr x, b, y;
+        int success;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        n = n_randint(state, 40);
+        if (n_randint(state, 20) == 0)
+            n += n_randint(state, 400);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, n, n, mod);
+        nmod_mat_init(A, n, n, mod);
+        x = _nmod_vec_init(n + 1);
+        b = _nmod_vec_init(n + 1);
+        y = _nmod_vec_init(n + 1);
+
+        /* a random sparse matrix with a nonzero diagonal is usually
+           nonsingular */
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 4 * n + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        for (i = 0; i < n; i++)
+            if (nmod_mat_entry(A, i, i) == 0)
+                nmod_mat_entry(A, i, i) = 1;
+        nmod_sparse_mat_set_nmod_mat(M, A);
+
+        _nmod_vec_randtest(b, state, n, M->mod);
+
+        success = nmod_sparse_mat_solve_wiedemann(x, M, b);
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (!_nmod_vec_equal(y, b, n))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("wrong solution\n");
+                abort();
+            }
+        }
+        else if (mod > 1000 && nmod_mat_rank(A) == n)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("no solution found for nonsingular matrix\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    /* Compare with dense transpose, and check transposing twice */
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M, T;
+        nmod_mat_t A, AT, B;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_sparse_mat_init(T, n, m, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(AT, n, m, mod);
+        nmod_mat_init(B, n, m, mod);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, m * n + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        nmod_mat_transpose(AT, A);
+
+        nmod_sparse_mat_transpose(T, M);
+        nmod_sparse_mat_get_nmod_mat(B, T);
+
+        if (!nmod_mat_equal(AT, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(AT);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        /* aliasing */
+        nmod_sparse_mat_transpose(T, T);
+
+        if (!nmod_sparse_mat_equal(T, M))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("transpose of transpose\n");
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(T);
+        nmod_mat_clear(A);
+        nmod_mat_clear(AT);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*
+    Copyright (C) 2017 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, j, k, nnz = nmod_sparse_mat_nnz(A);
+    nmod_sparse_mat_t T;
+
+    nmod_sparse_mat_init(T, A->c, A->r, A->mod.n);
+    _nmod_sparse_mat_fit_nnz(T, nnz);
+
+    /* counting sort of the entries by column, the rows of A being visited
+       in order so that the rows of T come out sorted */
+    for (k = 0; k < nnz; k++)
+        T->row_starts[A->cols[k] + 1]++;
+    for (j = 0; j < A->c; j++)
+        T->row_starts[j + 1] += T->row_starts[j];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            j = T->row_starts[A->cols[k]]++;
+            T->cols[j] = i;
+            T->entries[j] = A->entries[k];
+        }
+    }
+
+    /* the row starts have been shifted along by one row */
+    for (j = A->c; j > 0; j--)
+        T->row_starts[j] = T->row_starts[j - 1];
+    T->row_starts[0] = 0;
+
+    nmod_sparse_mat_swap(B, T);
+    nmod_sparse_mat_clear(T);
+}
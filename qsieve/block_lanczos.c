@@ -22,6 +22,7 @@ benefit from your work.
 
 
 #include "qsieve.h"
+#include "gf2_mat.h"
 
 #define BIT(x) (((uint64_t)(1)) << (x))
 
@@ -553,28 +554,17 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 }
 
 /*-----------------------------------------------------------------------*/
-static void transpose_vector(slong ncols, uint64_t *v, uint64_t **trans) {
+static void set_vector_cols(gf2_mat_t X, slong col, uint64_t *v) {
 
-	/* Hideously inefficent routine to transpose a
-	   vector v[] of 64-bit words into a 2-D array
-	   trans[][] of 64-bit words */
+	/* Sets columns col, ..., col + 63 of the ncols x 128
+	   matrix X to the vector v[] of 64-bit words */
 
-	slong i, j;
-	slong col;
-	uint64_t mask, word;
+	slong i, t;
 
-	for (i = 0; i < ncols; i++) {
-		col = i / 64;
-		mask = bitmask[i % 64];
-		word = v[i];
-		j = 0;
-		while (word) {
-			if (word & 1)
-				trans[j][col] |= mask;
-			word = word >> 1;
-			j++;
-		}
-	}
+	for (i = 0; i < X->r; i++)
+		for (t = 0; t < 64 / FLINT_BITS; t++)
+			X->rows[i][col / FLINT_BITS + t] = 
+					(mp_limb_t)(v[i] >> (t * FLINT_BITS));
 }
 
 /*-----------------------------------------------------------------------*/
@@ -599,99 +589,64 @@ void combine_cols(slong ncols,
 	   v[] and av[] can be NULL, in which case the elimination
 	   process assumes 64 dependencies instead of 128 */
 
-	slong i, j, k, bitpos, col, col_words, num_deps;
-	uint64_t mask;
-	uint64_t *matrix[128], *amatrix[128], *tmp;
+	slong i, j, k, t, rank, num_deps, col_limbs;
+	slong pivots[128];
+	gf2_mat_t X, T, M;
 
 	num_deps = 128;
 	if (v == NULL || av == NULL)
 		num_deps = 64;
 
-	col_words = (ncols + 63) / 64;
-
-	for (i = 0; i < num_deps; i++) {
-		matrix[i] = (uint64_t *)flint_calloc((size_t)col_words, 
-					     sizeof(uint64_t));
-		amatrix[i] = (uint64_t *)flint_calloc((size_t)col_words, 
-					      sizeof(uint64_t));
-	}
-
 	/* operations on columns can more conveniently become 
 	   operations on rows if all the vectors are first
-	   transposed */
-
-	transpose_vector(ncols, x, matrix);
-	transpose_vector(ncols, ax, amatrix);
-	if (num_deps == 128) {
-		transpose_vector(ncols, v, matrix + 64);
-		transpose_vector(ncols, av, amatrix + 64);
-	}
-
-	/* Keep eliminating rows until the unprocessed part
-	   of amatrix[][] is all zero. The rows where this
-	   happens correspond to linearly dependent vectors
-	   in the nullspace */
-
-	for (i = bitpos = 0; i < num_deps && bitpos < ncols; bitpos++) {
-
-		/* find the next pivot row */
-
-		mask = bitmask[bitpos % 64];
-		col = bitpos / 64;
-		for (j = i; j < num_deps; j++) {
-			if (amatrix[j][col] & mask) {
-				tmp = matrix[i];
-				matrix[i] = matrix[j];
-				matrix[j] = tmp;
-				tmp = amatrix[i];
-				amatrix[i] = amatrix[j];
-				amatrix[j] = tmp;
-				break;
-			}
-		}
-		if (j == num_deps)
-			continue;
-
-		/* a pivot was found; eliminate it from the
-		   remaining rows */
-
-		for (j++; j < num_deps; j++) {
-			if (amatrix[j][col] & mask) {
-
-				/* Note that the entire row, *not*
-				   just the nonzero part of it, must
-				   be eliminated; this is because the
-				   corresponding (dense) row of matrix[][]
-				   must have the same operation applied */
-
-				for (k = 0; k < col_words; k++) {
-					amatrix[j][k] ^= amatrix[i][k];
-					matrix[j][k] ^= matrix[i][k];
-				}
-			}
-		}
-		i++;
-	}
+	   transposed; the rows of M are those of [ax | av]^T
+	   followed by those of [x | v]^T, each starting on a
+	   new limb */
+
+	gf2_mat_init(X, ncols, num_deps);
+	gf2_mat_init(T, num_deps, ncols);
+	col_limbs = T->stride;
+	gf2_mat_init(M, num_deps, 2 * col_limbs * FLINT_BITS);
+
+	set_vector_cols(X, 0, ax);
+	if (num_deps == 128)
+		set_vector_cols(X, 64, av);
+	gf2_mat_transpose(T, X);
+	for (i = 0; i < num_deps; i++)
+		flint_mpn_copyi(M->rows[i], T->rows[i], col_limbs);
+
+	set_vector_cols(X, 0, x);
+	if (num_deps == 128)
+		set_vector_cols(X, 64, v);
+	gf2_mat_transpose(T, X);
+	for (i = 0; i < num_deps; i++)
+		flint_mpn_copyi(M->rows[i] + col_limbs, T->rows[i], col_limbs);
+
+	/* Bring M to echelon form. Pivots are taken in the
+	   [ax | av] part first, and the rows after those with
+	   a pivot there are zero in that part, so they
+	   correspond to linearly dependent vectors in the
+	   nullspace */
+
+	rank = _gf2_mat_rref(M, pivots, 0);
+	for (i = 0; i < rank && pivots[i] < ncols; i++) ;
 
 	/* transpose rows i to 64 back into x[] */
 
-	for (j = 0; j < ncols; j++) {
-		uint64_t word = 0;
-
-		col = j / 64;
-		mask = bitmask[j % 64];
+	gf2_mat_zero(T);
+	for (k = i; k < 64; k++)
+		flint_mpn_copyi(T->rows[k], M->rows[k] + col_limbs, col_limbs);
+	gf2_mat_transpose(X, T);
 
-		for (k = i; k < 64; k++) {
-			if (matrix[k][col] & mask)
-				word |= bitmask[k];
-		}
-		x[j] = word;
+	for (j = 0; j < ncols; j++) {
+		x[j] = 0;
+		for (t = 0; t < 64 / FLINT_BITS; t++)
+			x[j] |= ((uint64_t) X->rows[j][t]) << (t * FLINT_BITS);
 	}
 
-	for (i = 0; i < num_deps; i++) {
-		flint_free(matrix[i]);
-		flint_free(amatrix[i]);
-	}
+	gf2_mat_clear(X);
+	gf2_mat_clear(T);
+	gf2_mat_clear(M);
 }
 
 /*-----------------------------------------------------------------------*/